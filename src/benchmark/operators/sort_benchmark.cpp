@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -19,4 +20,19 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Sort)(benchmark::State& state) {
   }
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SortMultiColumn)(benchmark::State& state) {
+  _clear_cache();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0} /* "a" */, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1} /* "b" */, OrderByMode::Descending}};
+
+  auto warm_up = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+    sort->execute();
+  }
+}
+
 }  // namespace opossum
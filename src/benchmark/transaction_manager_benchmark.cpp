@@ -0,0 +1,86 @@
+#include <memory>
+#include <mutex>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto TABLE_NAME = "transaction_manager_benchmark";
+
+// The threads of a benchmark only synchronize at the start of their measurement loops, so the tables are created once
+// for all benchmarks (instead of by the first thread).
+const std::shared_ptr<Table>& values_to_insert() {
+  static auto once_flag = std::once_flag{};
+  static auto values = std::shared_ptr<Table>{};
+
+  std::call_once(once_flag, []() {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    values = std::make_shared<Table>(column_definitions, TableType::Data);
+    values->append({1});
+    Hyrise::get().storage_manager.add_table(
+        TABLE_NAME, std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes));
+  });
+
+  return values;
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Microbenchmarks for the commit pipeline of the TransactionManager. Run them with multiple threads to measure the
+ * contention on the registry of active snapshots and on the ordering of commit ids, e.g.:
+ *   ./hyriseMicroBenchmarks --benchmark_filter=BM_Transaction
+ */
+
+// Creating and destroying a transaction context registers and deregisters its snapshot commit id
+void BM_TransactionContextLifecycle(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context();
+    benchmark::DoNotOptimize(transaction_context);
+  }
+}
+BENCHMARK(BM_TransactionContextLifecycle)->ThreadRange(1, 32)->UseRealTime();
+
+// Short OLTP transactions that insert a single row each. Every commit acquires a commit id and has to wait for all
+// transactions with a lower commit id to be committed.
+void BM_TransactionCommitInsert(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto& values = values_to_insert();
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context();
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(TABLE_NAME, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+
+    transaction_context->commit();
+  }
+}
+BENCHMARK(BM_TransactionCommitInsert)->ThreadRange(1, 32)->UseRealTime();
+
+// Reading the lowest active snapshot commit id (as done by the MvccDeletePlugin) while other threads run transactions
+void BM_TransactionLowestActiveSnapshot(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context();
+    benchmark::DoNotOptimize(transaction_manager.get_lowest_active_snapshot_commit_id());
+  }
+}
+BENCHMARK(BM_TransactionLowestActiveSnapshot)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
@@ -77,11 +77,24 @@ void AbstractTableGenerator::generate_and_store() {
    * Encode the Tables
    */
   std::cout << "- Encoding tables if necessary" << std::endl;
+  const auto indexes_by_table = _benchmark_config->indexes ? _indexes_by_table() : IndexesByTable{};
   for (auto& [table_name, table_info] : table_info_by_name) {
     std::cout << "-  Encoding '" << table_name << "' - " << std::flush;
     Timer per_table_timer;
-    table_info.re_encoded =
-        BenchmarkTableEncoder::encode(table_name, table_info.table, _benchmark_config->encoding_config);
+
+    // The indexes created below require dictionary segments
+    auto indexed_column_ids = std::vector<ColumnID>{};
+    const auto indexes_iter = indexes_by_table.find(table_name);
+    if (indexes_iter != indexes_by_table.end()) {
+      for (const auto& index_columns : indexes_iter->second) {
+        for (const auto& index_column : index_columns) {
+          indexed_column_ids.emplace_back(table_info.table->column_id_by_name(index_column));
+        }
+      }
+    }
+
+    table_info.re_encoded = BenchmarkTableEncoder::encode(table_name, table_info.table,
+                                                          _benchmark_config->encoding_config, indexed_column_ids);
     std::cout << (table_info.re_encoded ? "encoding applied" : "no encoding necessary");
     std::cout << " (" << per_table_timer.lap_formatted() << ")" << std::endl;
   }
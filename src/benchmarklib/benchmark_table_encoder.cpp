@@ -1,7 +1,9 @@
 #include "benchmark_table_encoder.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include "constant_mappings.hpp"
 #include "encoding_config.hpp"
@@ -10,6 +12,7 @@
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -81,7 +84,8 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
 namespace opossum {
 
 bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                                   const EncodingConfig& encoding_config) {
+                                   const EncodingConfig& encoding_config,
+                                   const std::vector<ColumnID>& indexed_column_ids) {
   /**
    * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
    */
@@ -93,6 +97,9 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   ChunkEncodingSpec chunk_encoding_spec;
 
+  // Columns whose segments are encoded as chosen by the EncodingAdvisor, i.e., individually for each chunk
+  auto advised_column_ids = std::vector<ColumnID>{};
+
   for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
     // Check if a column specific encoding was specified
     if (table_has_custom_encoding) {
@@ -117,7 +124,15 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
     // No column-specific or type-specific encoding was specified.
     // Use default if it is compatible with the column type or leave column Unencoded if it is not.
-    if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
+    if (encoding_config.use_encoding_advisor) {
+      // GroupKeyIndexes and CompositeGroupKeyIndexes can only be built on dictionary segments
+      if (std::find(indexed_column_ids.cbegin(), indexed_column_ids.cend(), column_id) != indexed_column_ids.cend()) {
+        chunk_encoding_spec.push_back(SegmentEncodingSpec{EncodingType::Dictionary});
+        continue;
+      }
+      advised_column_ids.emplace_back(column_id);
+      chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
+    } else if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
       std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
@@ -149,8 +164,14 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
         const auto chunk = table->get_chunk(ChunkID{my_chunk});
         Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
-        if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
-          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+        auto chunk_specific_encoding_spec = chunk_encoding_spec;
+        for (const auto column_id : advised_column_ids) {
+          chunk_specific_encoding_spec[column_id] =
+              EncodingAdvisor::advise_segment_encoding(chunk->get_segment(column_id), column_data_types[column_id]);
+        }
+
+        if (!is_chunk_encoding_spec_satisfied(chunk_specific_encoding_spec, get_chunk_encoding_spec(*chunk))) {
+          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_specific_encoding_spec);
           encoding_performed = true;
         }
       }
@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+
+#include "types.hpp"
 
 namespace opossum {
 
@@ -10,11 +13,12 @@ class Table;
 
 class BenchmarkTableEncoder {
  public:
-  // @param out   stream for logging info
-  // @return      true, if any encoding operation was performed.
-  //              false, if the @param table was already encoded as required by @param encoding_config
+  // @param indexed_column_ids  columns that indexes will be created on. If the EncodingAdvisor is used, they are
+  //                            dictionary-encoded instead, as the indexes require dictionary segments.
+  // @return                    true, if any encoding operation was performed.
+  //                            false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                     const EncodingConfig& encoding_config);
+                     const EncodingConfig& encoding_config, const std::vector<ColumnID>& indexed_column_ids = {});
 };
 
 }  // namespace opossum
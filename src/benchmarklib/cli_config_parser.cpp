@@ -92,6 +92,12 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Encoding is custom from " << encoding_type_str << "" << std::endl;
 
     Assert(compression_type_str.empty(), "Specified both compression type and an encoding file. Invalid combination.");
+  } else if (boost::algorithm::iequals(encoding_type_str, EncodingConfig::AUTO_ENCODING_STRING)) {
+    encoding_config = std::make_unique<EncodingConfig>(EncodingConfig::automatic());
+    std::cout << "- Encoding is chosen per segment" << std::endl;
+
+    Assert(compression_type_str.empty(),
+           "Specified both compression type and automatic encoding. Invalid combination.");
   } else {
     encoding_config = std::make_unique<EncodingConfig>(
         EncodingConfig::encoding_spec_from_strings(encoding_type_str, compression_type_str));
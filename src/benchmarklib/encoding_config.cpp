@@ -18,6 +18,12 @@ EncodingConfig::EncodingConfig(const SegmentEncodingSpec& default_encoding_spec,
 
 EncodingConfig EncodingConfig::unencoded() { return EncodingConfig{SegmentEncodingSpec{EncodingType::Unencoded}}; }
 
+EncodingConfig EncodingConfig::automatic() {
+  auto encoding_config = EncodingConfig{};
+  encoding_config.use_encoding_advisor = true;
+  return encoding_config;
+}
+
 SegmentEncodingSpec EncodingConfig::encoding_spec_from_strings(const std::string& encoding_str,
                                                                const std::string& compression_str) {
   const auto encoding = EncodingConfig::encoding_string_to_type(encoding_str);
@@ -52,7 +58,11 @@ nlohmann::json EncodingConfig::to_json() const {
   };
 
   nlohmann::json json{};
-  json["default"] = encoding_spec_to_string_map(default_encoding_spec);
+  if (use_encoding_advisor) {
+    json["default"] = nlohmann::json{{"encoding", AUTO_ENCODING_STRING}};
+  } else {
+    json["default"] = encoding_spec_to_string_map(default_encoding_spec);
+  }
 
   nlohmann::json type_mapping{};
   for (const auto& [type, spec] : type_encoding_mapping) {
@@ -89,6 +99,8 @@ The encoding config represents the segment encodings specified for a benchmark.
 All segments of a given share column the same encoding.
 If encoding (and vector compression) were specified via command line args,
 all segments are compressed using the default encoding.
+With `--encoding Auto`, the encoding of each segment is chosen based on the
+characteristics of its data (see EncodingAdvisor).
 If a JSON config was provided, a column- and/or type-specific
 encoding/compression can be chosen (same in each chunk). The JSON config must
 look like this:
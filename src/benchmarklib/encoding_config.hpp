@@ -26,10 +26,16 @@ class EncodingConfig {
 
   static EncodingConfig unencoded();
 
+  // Segments without a column- or type-specific encoding are encoded as chosen by the EncodingAdvisor
+  static EncodingConfig automatic();
+
   SegmentEncodingSpec default_encoding_spec;
   DataTypeEncodingMapping type_encoding_mapping;
   TableSegmentEncodingMapping custom_encoding_mapping;
 
+  // If set, the EncodingAdvisor is used instead of default_encoding_spec
+  bool use_encoding_advisor{false};
+
   static SegmentEncodingSpec encoding_spec_from_strings(const std::string& encoding_str,
                                                         const std::string& compression_str);
   static EncodingType encoding_string_to_type(const std::string& encoding_str);
@@ -38,6 +44,9 @@ class EncodingConfig {
   nlohmann::json to_json() const;
 
   static const char* description;
+
+  // Encoding string that selects the EncodingAdvisor (e.g., `--encoding Auto`), compared case-insensitively
+  static constexpr auto AUTO_ENCODING_STRING = "Auto";
 };
 
 }  // namespace opossum
@@ -23,6 +23,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
+#include "import_export/checkpoint.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/export_binary.hpp"
 #include "operators/export_csv.hpp"
@@ -40,6 +41,7 @@
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/invalid_input_exception.hpp"
@@ -123,6 +125,7 @@ Console::Console()
   register_command("generate_tpcds", std::bind(&Console::_generate_tpcds, this, std::placeholders::_1));
   register_command("load", std::bind(&Console::_load_table, this, std::placeholders::_1));
   register_command("export", std::bind(&Console::_export_table, this, std::placeholders::_1));
+  register_command("primary_key", std::bind(&Console::_create_primary_key_index, this, std::placeholders::_1));
   register_command("script", std::bind(&Console::_exec_script, this, std::placeholders::_1));
   register_command("print", std::bind(&Console::_print_table, this, std::placeholders::_1));
   register_command("visualize", std::bind(&Console::_visualize, this, std::placeholders::_1));
@@ -387,12 +390,13 @@ int Console::_help(const std::string&) {
   out("  generate_tpcds SCALE_FACTOR [CHUNK_SIZE] - Generate all TPC-DS tables\n");
   out("  load FILEPATH [TABLENAME [ENCODING]]    - Load table from disk specified by filepath FILEPATH, store it with name TABLENAME\n");  // NOLINT
   out("                                               The import type is chosen by the type of FILEPATH.\n");
-  out("                                                 Supported types: '.bin', '.csv', '.tbl'\n");
+  out("                                                 Supported types: '.bin', '.ckpt', '.csv', '.tbl'\n");
   out("                                               If no table name is specified, the filename without extension is used\n");  // NOLINT
   out(encoding_options + "\n");  // NOLINT
   out("  export TABLENAME FILEPATH               - Export table named TABLENAME from storage manager to filepath FILEPATH\n");  // NOLINT
   out("                                               The export type is chosen by the type of FILEPATH.\n");
-  out("                                                 Supported types: '.bin', '.csv'\n");
+  out("                                                 Supported types: '.bin', '.ckpt', '.csv'\n");
+  out("  primary_key TABLENAME COLUMNNAME        - Create a PrimaryKeyIndex on column COLUMNNAME of table TABLENAME\n");  // NOLINT
   out("  script SCRIPTFILE                       - Execute script specified by SCRIPTFILE\n");
   out("  print TABLENAME                         - Fully print the given table (including MVCC data)\n");
   out("  visualize [options] [SQL]               - Visualize a SQL query\n");
@@ -542,11 +546,21 @@ int Console::_load_table(const std::string& args) {
       out("Error: Exception thrown while importing binary file:\n  " + std::string(exception.what()) + "\n");
       return ReturnCode::Error;
     }
+  } else if (extension == ".ckpt") {
+    try {
+      Hyrise::get().storage_manager.add_table(tablename, Checkpoint::read_table(filepath));
+    } catch (const std::exception& exception) {
+      out("Error: Exception thrown while loading checkpoint:\n  " + std::string(exception.what()) + "\n");
+      return ReturnCode::Error;
+    }
   } else {
     out("Error: Unsupported file extension '" + extension + "'\n");
     return ReturnCode::Error;
   }
 
+  // Checkpoints keep the encoding that the table had when it was written
+  if (extension == ".ckpt" && arguments.size() < 3) return ReturnCode::Ok;
+
   const std::string encoding = arguments.size() == 3 ? arguments[2] : "Unencoded";
 
   const auto encoding_type = encoding_type_to_string.right.find(encoding);
@@ -609,6 +623,8 @@ int Console::_export_table(const std::string& args) {
     } else if (extension == "csv") {
       auto exporter = std::make_shared<ExportCsv>(get_table, filepath);
       exporter->execute();
+    } else if (extension == "ckpt") {
+      Checkpoint::write_table(*storage_manager.get_table(tablename), filepath);
     } else {
       out("Exporting to extension \"" + extension + "\" is not supported.\n");
       return ReturnCode::Error;
@@ -621,6 +637,41 @@ int Console::_export_table(const std::string& args) {
   return ReturnCode::Ok;
 }
 
+int Console::_create_primary_key_index(const std::string& args) {
+  const auto arguments = trim_and_split(args);
+
+  if (arguments.size() != 2) {
+    out("Usage:\n");
+    out("  primary_key TABLENAME COLUMNNAME\n");
+    return ReturnCode::Error;
+  }
+
+  const auto& tablename = arguments[0];
+  const auto& column_name = arguments[1];
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(tablename)) {
+    out("Error: Table does not exist in StorageManager");
+    return ReturnCode::Error;
+  }
+
+  try {
+    const auto table = storage_manager.get_table(tablename);
+    table->create_primary_key_index(table->column_id_by_name(column_name));
+  } catch (const std::exception& exception) {
+    out("Error: Exception thrown while creating the PrimaryKeyIndex:\n  " + std::string(exception.what()) + "\n");
+    return ReturnCode::Error;
+  }
+
+  // Cached plans do not use the new index
+  _lqp_cache->clear();
+  _pqp_cache->clear();
+
+  out("Created PrimaryKeyIndex on " + tablename + "." + column_name + "\n");
+
+  return ReturnCode::Ok;
+}
+
 int Console::_print_table(const std::string& args) {
   std::vector<std::string> arguments = trim_and_split(args);
 
@@ -1,6 +1,10 @@
+#include <filesystem>
+
 #include "cxxopts.hpp"
 
 #include "hyrise.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "server/server.hpp"
 
@@ -13,6 +17,8 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("log_file", "Write-ahead log for modifications. An existing log is replayed at startup. If no file is specified, modifications are not logged", cxxopts::value<std::string>()->default_value(""))  // NOLINT
+    ("log_flush_policy", "When transactions become visible: group_commit (once their log entry is on disk) or async (right away, the log is synced periodically)", cxxopts::value<std::string>()->default_value("group_commit"))  // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -40,6 +46,21 @@ int main(int argc, char* argv[]) {
   // Set scheduler so that the server can execute the tasks on separate threads.
   opossum::Hyrise::get().set_scheduler(std::make_shared<opossum::NodeQueueScheduler>());
 
+  const auto log_file = parsed_options["log_file"].as<std::string>();
+  if (!log_file.empty()) {
+    const auto log_flush_policy_string = parsed_options["log_flush_policy"].as<std::string>();
+    Assert(log_flush_policy_string == "group_commit" || log_flush_policy_string == "async",
+           "Unknown log flush policy: " + log_flush_policy_string);
+    const auto log_flush_policy = log_flush_policy_string == "group_commit" ? opossum::LogFlushPolicy::GroupCommit
+                                                                            : opossum::LogFlushPolicy::Asynchronous;
+
+    if (std::filesystem::exists(log_file)) {
+      const auto transaction_count = opossum::LogRecovery::recover(log_file);
+      std::cout << "Replayed " << transaction_count << " transactions from " << log_file << std::endl;
+    }
+    opossum::Hyrise::get().set_logger(std::make_shared<opossum::Logger>(log_file, log_flush_policy));
+  }
+
   auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
   server.run();
 
@@ -0,0 +1,98 @@
+#include "active_snapshot_registry.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Threads get their home slots in a round-robin fashion, so that the first threads (usually the workers of the
+// scheduler) occupy distinct slots.
+std::atomic<size_t> next_home_slot{0};
+
+size_t home_slot() {
+  static thread_local const auto slot = next_home_slot++ % ActiveSnapshotRegistry::SLOTS_PER_BLOCK;
+  return slot;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ActiveSnapshotRegistry::ActiveSnapshotRegistry() : _first_block{std::make_unique<Block>()} {}
+
+ActiveSnapshotRegistry::~ActiveSnapshotRegistry() = default;
+
+ActiveSnapshotRegistry::Block::~Block() { delete next.load(); }
+
+ActiveSnapshotRegistry::SlotID ActiveSnapshotRegistry::register_snapshot(const CommitID snapshot_commit_id) {
+  DebugAssert(snapshot_commit_id != FREE_SLOT, "Invalid snapshot commit id");
+
+  const auto first_slot_index = home_slot();
+  auto block = _first_block.get();
+  auto block_index = size_t{0};
+
+  while (true) {
+    for (auto probe_index = size_t{0}; probe_index < SLOTS_PER_BLOCK; ++probe_index) {
+      const auto slot_index = (first_slot_index + probe_index) % SLOTS_PER_BLOCK;
+      auto& slot = block->slots[slot_index].snapshot_commit_id;
+
+      // Read the slot before trying to occupy it, so that occupied cache lines are not written to
+      auto expected = FREE_SLOT;
+      if (slot.load(std::memory_order_relaxed) == FREE_SLOT &&
+          slot.compare_exchange_strong(expected, snapshot_commit_id)) {
+        return block_index * SLOTS_PER_BLOCK + slot_index;
+      }
+    }
+
+    // All slots of the block are occupied. Move on to the next block, append one if there is none.
+    auto next_block = block->next.load();
+    if (!next_block) {
+      auto new_block = std::make_unique<Block>();
+      if (block->next.compare_exchange_strong(next_block, new_block.get())) {
+        next_block = new_block.release();
+      }
+    }
+
+    block = next_block;
+    ++block_index;
+  }
+}
+
+void ActiveSnapshotRegistry::deregister_snapshot(const SlotID slot_id, const CommitID snapshot_commit_id) {
+  auto block = _first_block.get();
+  for (auto block_index = size_t{0}; block && block_index < slot_id / SLOTS_PER_BLOCK; ++block_index) {
+    block = block->next.load();
+  }
+  if (!block) return;
+
+  auto expected = snapshot_commit_id;
+  block->slots[slot_id % SLOTS_PER_BLOCK].snapshot_commit_id.compare_exchange_strong(expected, FREE_SLOT);
+}
+
+std::optional<CommitID> ActiveSnapshotRegistry::lowest() const {
+  auto lowest_snapshot_commit_id = FREE_SLOT;
+  for (auto block = _first_block.get(); block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+    }
+  }
+
+  if (lowest_snapshot_commit_id == FREE_SLOT) return std::nullopt;
+  return lowest_snapshot_commit_id;
+}
+
+std::vector<CommitID> ActiveSnapshotRegistry::snapshot_commit_ids() const {
+  auto snapshot_commit_ids = std::vector<CommitID>{};
+  for (auto block = _first_block.get(); block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      const auto snapshot_commit_id = slot.snapshot_commit_id.load();
+      if (snapshot_commit_id != FREE_SLOT) snapshot_commit_ids.emplace_back(snapshot_commit_id);
+    }
+  }
+  return snapshot_commit_ids;
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Keeps track of the snapshot commit ids of active transactions without a global lock.
+ *
+ * Each active transaction occupies a slot that holds its snapshot commit id. Slots are padded to cache lines. Every
+ * thread starts looking for a free slot at its own home slot, so that threads (e.g., the workers of the scheduler)
+ * usually occupy the same slot over and over again and neither contend for slots nor share cache lines. If all slots
+ * are occupied, another block of slots is appended. Blocks are only freed when the registry is destroyed, so the
+ * number of slots is bounded by the peak number of concurrently active transactions.
+ *
+ * lowest() visits all slots, i.e., it takes O(workers) as long as there are not more active transactions than slots
+ * in the first block. Just like before, a transaction that registers while lowest() is running might not be
+ * considered. Its snapshot commit id is not lower than the last commit id at the time lowest() was called, though.
+ */
+class ActiveSnapshotRegistry : private Noncopyable {
+ public:
+  using SlotID = size_t;
+
+  static constexpr auto SLOTS_PER_BLOCK = size_t{64};
+
+  ActiveSnapshotRegistry();
+  ~ActiveSnapshotRegistry();
+
+  ActiveSnapshotRegistry(ActiveSnapshotRegistry&&) noexcept = default;
+  ActiveSnapshotRegistry& operator=(ActiveSnapshotRegistry&&) noexcept = default;
+
+  SlotID register_snapshot(const CommitID snapshot_commit_id);
+
+  /**
+   * Frees the slot if it is still occupied by the given snapshot commit id. Transactions that outlive a reset of the
+   * TransactionManager (e.g., in tests) are not registered in the new registry, which is why this is not an error.
+   */
+  void deregister_snapshot(const SlotID slot_id, const CommitID snapshot_commit_id);
+
+  /**
+   * Returns the lowest snapshot commit id of all active transactions.
+   */
+  std::optional<CommitID> lowest() const;
+
+  /**
+   * Returns the snapshot commit ids of all active transactions (in no particular order). Used for testing.
+   */
+  std::vector<CommitID> snapshot_commit_ids() const;
+
+ private:
+  // No transaction can have this snapshot commit id (see MvccData::MAX_COMMIT_ID)
+  static constexpr auto FREE_SLOT = std::numeric_limits<CommitID>::max();
+
+  struct alignas(64) Slot {
+    std::atomic<CommitID> snapshot_commit_id{FREE_SLOT};
+  };
+
+  struct Block {
+    ~Block();
+
+    std::array<Slot, SLOTS_PER_BLOCK> slots;
+    std::atomic<Block*> next{nullptr};
+  };
+
+  std::unique_ptr<Block> _first_block;
+};
+
+}  // namespace opossum
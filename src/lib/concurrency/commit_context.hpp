@@ -51,7 +51,7 @@ class CommitContext : private Noncopyable {
  private:
   const CommitID _commit_id;
   std::atomic<bool> _pending;  // true if context is waiting to be committed
-  std::shared_ptr<CommitContext> _next;
+  std::shared_ptr<CommitContext> _next;  // Accessed atomically, see next()
   std::function<void()> _callback;
 };
 }  // namespace opossum
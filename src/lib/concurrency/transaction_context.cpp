@@ -5,6 +5,8 @@
 
 #include "commit_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_entry.hpp"
+#include "logging/logger.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
 
@@ -13,10 +15,9 @@ namespace opossum {
 TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
+      _snapshot_slot_id{Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id)},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {
-  Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
-}
+      _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
   DebugAssert(([this]() {
@@ -48,7 +49,7 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_slot_id, _snapshot_commit_id);
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
@@ -80,11 +81,30 @@ void TransactionContext::rollback() {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  // The log records are written before the records are committed, because the committed rows might be re-encoded
+  // concurrently.
+  const auto& logger = Hyrise::get().logger();
+  auto log_entry = LogEntryWriter{};
+  if (logger) {
+    for (const auto& op : _rw_operators) {
+      op->write_log_records(log_entry);
+    }
+  }
+
   for (const auto& op : _rw_operators) {
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  if (!logger || log_entry.empty()) {
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  // Depending on the flush policy, the transaction only becomes visible once its log entry is on disk. Until then,
+  // transactions with higher commit ids cannot become visible either (see TransactionManager).
+  logger->append(commit_id(), log_entry, [context = shared_from_this(), callback]() {
+    context->_mark_as_pending_and_try_commit(callback);
+  });
 }
 
 void TransactionContext::commit() {
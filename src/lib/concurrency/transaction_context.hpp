@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "active_snapshot_registry.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -163,6 +164,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
+  const ActiveSnapshotRegistry::SlotID _snapshot_slot_id;
 
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
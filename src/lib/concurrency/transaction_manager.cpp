@@ -1,5 +1,7 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
+
 #include "commit_context.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
@@ -13,55 +15,51 @@ TransactionManager::TransactionManager()
       _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(!_active_snapshot_registry.lowest(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
 TransactionManager& TransactionManager::operator=(TransactionManager&& transaction_manager) noexcept {
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
-  _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _last_commit_context = std::atomic_load(&transaction_manager._last_commit_context);
+  _active_snapshot_registry = std::move(transaction_manager._active_snapshot_registry);
   return *this;
 }
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  ++_starting_transaction_count;
   const TransactionID snapshot_commit_id = _last_commit_id;
-  return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+  auto transaction_context = std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+  --_starting_transaction_count;
+  return transaction_context;
 }
 
-void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+ActiveSnapshotRegistry::SlotID TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  return _active_snapshot_registry.register_snapshot(snapshot_commit_id);
 }
 
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
-
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
-  }
-
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+void TransactionManager::_deregister_transaction(const ActiveSnapshotRegistry::SlotID slot_id,
+                                                 const CommitID snapshot_commit_id) {
+  _active_snapshot_registry.deregister_snapshot(slot_id, snapshot_commit_id);
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  return _active_snapshot_registry.lowest();
+}
 
-  if (_active_snapshot_commit_ids.empty()) {
-    return std::nullopt;
-  }
+CommitID TransactionManager::get_globally_visible_commit_id() const {
+  // The order of the loads matters. A transaction that has not started when the starting count is read reads a last
+  // commit id that is at least last_commit_id. A transaction that has started before is either still starting (and
+  // we give up) or already registered, so that the registry scan that follows sees it. Reading the count after the
+  // scan would miss a transaction that registers after the scan and finishes starting before the count is read.
+  const auto last_commit_id = _last_commit_id.load();
+  if (_starting_transaction_count > 0) return CommitID{0};
+  const auto lowest_snapshot_commit_id = _active_snapshot_registry.lowest();
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return std::min(last_commit_id, lowest_snapshot_commit_id.value_or(last_commit_id));
 }
 
 /**
@@ -80,28 +78,27 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   auto current_context = std::atomic_load(&_last_commit_context);
   auto next_context = std::shared_ptr<CommitContext>();
 
-  auto success = false;
-  while (!success) {
+  while (true) {
     while (current_context->has_next()) {
       current_context = std::atomic_load(&_last_commit_context);
     }
 
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
-
-    success = current_context->try_set_next(next_context);
+    // Only allocate a new context if the commit id it was created for has been taken by another thread
+    if (!next_context || next_context->commit_id() != current_context->commit_id() + 1u) {
+      next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
+    }
 
-    if (!success) continue;
+    if (!current_context->try_set_next(next_context)) continue;
 
     /**
      * Only one thread at a time can ever reach this code since only one thread
      * succeeds to set _last_commit_context’s successor.
      */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+    const auto success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
 
     Assert(success, "Invariant violated.");
+    return next_context;
   }
-
-  return next_context;
 }
 
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
@@ -3,9 +3,9 @@
 #include <atomic>
 #include <functional>
 #include <memory>
-#include <mutex>
-#include <unordered_set>
+#include <optional>
 
+#include "active_snapshot_registry.hpp"
 #include "types.hpp"
 
 /**
@@ -59,10 +59,17 @@ class TransactionManager : public Noncopyable {
   std::shared_ptr<TransactionContext> new_transaction_context();
 
   /**
-   * Returns the lowest snapshot-commit-id currently used by a transaction.
+   * Returns the lowest snapshot-commit-id currently used by a transaction. Does not acquire a lock and takes
+   * O(workers), see ActiveSnapshotRegistry.
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
+  /**
+   * Returns a commit id up to which all committed changes are visible to every active transaction and to every
+   * transaction that is started from now on. Used to install column versions, see ColumnVersionStore.
+   */
+  CommitID get_globally_visible_commit_id() const;
+
  private:
   TransactionManager();
   ~TransactionManager();
@@ -78,11 +85,11 @@ class TransactionManager : public Noncopyable {
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * The following two functions are used to keep the registry of active
+   * snapshot-commit-ids up to date. Transactions keep the slot they occupy.
    */
-  void _register_transaction(CommitID snapshot_commit_id);
-  void _deregister_transaction(CommitID snapshot_commit_id);
+  ActiveSnapshotRegistry::SlotID _register_transaction(CommitID snapshot_commit_id);
+  void _deregister_transaction(ActiveSnapshotRegistry::SlotID slot_id, CommitID snapshot_commit_id);
 
   std::atomic<TransactionID> _next_transaction_id;
 
@@ -91,9 +98,11 @@ class TransactionManager : public Noncopyable {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
-  std::shared_ptr<CommitContext> _last_commit_context;
+  std::shared_ptr<CommitContext> _last_commit_context;  // Accessed atomically, see _new_commit_context()
+
+  ActiveSnapshotRegistry _active_snapshot_registry;
 
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  // Transactions that have read the last commit id, but might not be registered as active yet
+  std::atomic<size_t> _starting_transaction_count{0};
 };
 }  // namespace opossum
@@ -1,10 +1,19 @@
 #include "cost_estimator_logical.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include "expression/abstract_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "statistics/cardinality_estimator.hpp"
 #include "utils/assert.hpp"
@@ -23,10 +32,16 @@ Cost CostEstimatorLogical::estimate_node_cost(const std::shared_ptr<AbstractLQPN
       node->right_input() ? cardinality_estimator->estimate_cardinality(node->right_input()) : 0.0f;
 
   switch (node->type) {
-    case LQPNodeType::Join:
+    case LQPNodeType::Join: {
+      const auto& join_node = static_cast<const JoinNode&>(*node);
+      if (join_node.join_type == JoinType::Index) {
+        return _estimate_index_join_cost(join_node, left_input_row_count, right_input_row_count, output_row_count);
+      }
+
       // Covers predicated and unpredicated joins. For cross joins, output_row_count will be
       // left_input_row_count * right_input_row_count
       return left_input_row_count + right_input_row_count + output_row_count;
+    }
 
     case LQPNodeType::Sort:
       return left_input_row_count * std::log(left_input_row_count);
@@ -71,4 +86,51 @@ float CostEstimatorLogical::_get_expression_cost_multiplier(const std::shared_pt
   return multiplier;
 }
 
+Cost CostEstimatorLogical::_estimate_index_join_cost(const JoinNode& join_node, const float left_input_row_count,
+                                                     const float right_input_row_count, const float output_row_count) {
+  const auto index_input = join_node.index_side == IndexSide::Left ? join_node.left_input() : join_node.right_input();
+  const auto probe_row_count = join_node.index_side == IndexSide::Left ? right_input_row_count : left_input_row_count;
+  const auto index_input_row_count =
+      join_node.index_side == IndexSide::Left ? left_input_row_count : right_input_row_count;
+
+  // Without indexes, the JoinIndex falls back to a nested loop join
+  const auto nested_loop_cost = probe_row_count * index_input_row_count + output_row_count;
+
+  const auto stored_table_node = lqp_find_underlying_stored_table_node(index_input);
+  if (!stored_table_node || join_node.join_predicates().empty()) return nested_loop_cost;
+
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node.join_predicates().front());
+  if (!predicate) return nested_loop_cost;
+
+  const auto& index_side_argument = expression_evaluable_on_lqp(predicate->left_operand(), *index_input)
+                                        ? predicate->left_operand()
+                                        : predicate->right_operand();
+  const auto column_id = stored_table_node->find_column_id(*index_side_argument);
+  if (!column_id) return nested_loop_cost;
+
+  // Chunks without an index on the join column (e.g., chunks added after the index was created, which are only
+  // indexed when the ChunkCompressionTask encodes them) are joined with a nested loop
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto& pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+  const auto table_chunk_count = table->chunk_count();
+  auto chunk_count = size_t{0};
+  auto indexed_chunk_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table_chunk_count; ++chunk_id) {
+    if (std::find(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id) != pruned_chunk_ids.cend()) continue;
+
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    ++chunk_count;
+    if (!chunk->get_indexes(std::vector<ColumnID>{*column_id}).empty()) ++indexed_chunk_count;
+  }
+  if (chunk_count == 0) return output_row_count;
+
+  const auto row_count_per_chunk = static_cast<float>(table->row_count()) / static_cast<float>(chunk_count);
+  const auto indexed_fraction = static_cast<float>(indexed_chunk_count) / static_cast<float>(chunk_count);
+
+  return probe_row_count * static_cast<float>(indexed_chunk_count) * std::log2(std::max(row_count_per_chunk, 2.0f)) +
+         probe_row_count * index_input_row_count * (1.0f - indexed_fraction) + output_row_count;
+}
+
 }  // namespace opossum
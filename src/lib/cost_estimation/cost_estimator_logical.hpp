@@ -5,6 +5,7 @@
 namespace opossum {
 
 class AbstractExpression;
+class JoinNode;
 
 /**
  * Cost model for logical complexity, i.e., approximate number of tuple accesses
@@ -19,6 +20,11 @@ class CostEstimatorLogical : public AbstractCostEstimator {
 
  private:
   static float _get_expression_cost_multiplier(const std::shared_ptr<AbstractExpression>& expression);
+
+  // Every probe side row is looked up in the index of each indexed chunk of the index side, which costs a binary
+  // search. Chunks without an index are joined with a nested loop.
+  static Cost _estimate_index_join_cost(const JoinNode& join_node, const float left_input_row_count,
+                                        const float right_input_row_count, const float output_row_count);
 };
 
 }  // namespace opossum
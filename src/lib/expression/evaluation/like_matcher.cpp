@@ -8,6 +8,8 @@ namespace opossum {
 
 LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
 
+const LikeMatcher::AllPatternVariant& LikeMatcher::pattern_variant() const { return _pattern_variant; }
+
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
 }
@@ -76,6 +76,8 @@ class LikeMatcher {
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  const AllPatternVariant& pattern_variant() const;
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
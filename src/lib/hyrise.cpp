@@ -1,5 +1,7 @@
 #include "hyrise.hpp"
 
+#include "logging/logger.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -23,6 +25,9 @@ Hyrise::Hyrise() {
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  // Transactions that wait for their log entry to be written have to become visible before the TransactionManager is
+  // replaced
+  if (Hyrise::get().logger()) Hyrise::get().logger()->flush();
   get() = Hyrise{};
 }
 
@@ -34,4 +39,11 @@ void Hyrise::set_scheduler(const std::shared_ptr<AbstractScheduler>& new_schedul
   _scheduler->begin();
 }
 
+const std::shared_ptr<Logger>& Hyrise::logger() const { return _logger; }
+
+void Hyrise::set_logger(const std::shared_ptr<Logger>& new_logger) {
+  if (_logger) _logger->flush();
+  _logger = new_logger;
+}
+
 }  // namespace opossum
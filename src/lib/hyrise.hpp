@@ -13,6 +13,7 @@ namespace opossum {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class Logger;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -29,6 +30,12 @@ class Hyrise : public Singleton<Hyrise> {
 
   void set_scheduler(const std::shared_ptr<AbstractScheduler>& new_scheduler);
 
+  // The write-ahead log of committed transactions. By default, there is none, so that committed transactions are lost
+  // when the process ends.
+  const std::shared_ptr<Logger>& logger() const;
+
+  void set_logger(const std::shared_ptr<Logger>& new_logger);
+
   PluginManager plugin_manager;
   StorageManager storage_manager;
   TransactionManager transaction_manager;
@@ -46,6 +53,8 @@ class Hyrise : public Singleton<Hyrise> {
   // (Re-)setting the scheduler requires more than just replacing the pointer. To make sure that set_scheduler is used,
   // the scheduler is private.
   std::shared_ptr<AbstractScheduler> _scheduler;
+
+  std::shared_ptr<Logger> _logger;
 };
 
 }  // namespace opossum
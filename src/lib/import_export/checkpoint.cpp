@@ -0,0 +1,629 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "import_export/binary.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/column_version_store.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// "HYRCKPT1" in little-endian byte order
+constexpr auto CHECKPOINT_MAGIC_NUMBER = uint64_t{0x3154504B43525948};
+constexpr auto CHECKPOINT_VERSION = uint32_t{1};
+
+constexpr auto CHECKPOINT_PAGE_SIZE = size_t{4096};
+constexpr auto CHECKPOINT_CACHE_LINE_SIZE = size_t{64};
+
+// Small buffers (e.g., the dictionary of a segment with few distinct values) are only aligned to cache lines, so that
+// segments with many small buffers do not waste a page for each of them
+size_t buffer_alignment(const size_t byte_count) {
+  return byte_count >= CHECKPOINT_PAGE_SIZE ? CHECKPOINT_PAGE_SIZE : CHECKPOINT_CACHE_LINE_SIZE;
+}
+
+template <typename T>
+constexpr bool is_concurrent_vector_v = false;
+
+template <typename T>
+constexpr bool is_concurrent_vector_v<pmr_concurrent_vector<T>> = true;
+
+// FrameOfReferenceSegment<T> cannot be named for data types that it does not support
+template <typename SegmentType>
+constexpr bool is_frame_of_reference_segment_v = false;
+
+template <typename T>
+constexpr bool is_frame_of_reference_segment_v<FrameOfReferenceSegment<T>> = true;
+
+class CheckpointWriter {
+ public:
+  explicit CheckpointWriter(const std::string& file_name) {
+    _stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    _stream.open(file_name, std::ios::binary | std::ios::trunc);
+  }
+
+  template <typename T>
+  void write_value(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly");
+    _write_bytes(&value, sizeof(T));
+  }
+
+  void write_string(const std::string& value) {
+    write_value(static_cast<uint32_t>(value.size()));
+    _write_bytes(value.data(), value.size());
+  }
+
+  // Writes the values of a container as one aligned buffer. Strings are written as two buffers, one with their lengths
+  // and one with their characters.
+  template <typename Container>
+  void write_values(const Container& values) {
+    using T = typename Container::value_type;
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto lengths = std::vector<uint32_t>{};
+      lengths.reserve(values.size());
+      auto characters = std::vector<char>{};
+      for (const auto& value : values) {
+        lengths.emplace_back(static_cast<uint32_t>(value.size()));
+        characters.insert(characters.end(), value.begin(), value.end());
+      }
+      write_values(lengths);
+      write_values(characters);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      write_values(std::vector<BoolAsByteType>(values.begin(), values.end()));
+    } else if constexpr (is_concurrent_vector_v<Container>) {
+      // tbb::concurrent_vector does not store its values contiguously
+      write_values(std::vector<T>(values.begin(), values.end()));
+    } else {
+      const auto byte_count = values.size() * sizeof(T);
+      write_value(static_cast<uint64_t>(byte_count));
+      align(buffer_alignment(byte_count));
+      _write_bytes(values.data(), byte_count);
+    }
+  }
+
+  void align(const size_t alignment) {
+    static const auto padding = std::vector<char>(CHECKPOINT_PAGE_SIZE);
+    const auto misalignment = _offset % alignment;
+    if (misalignment != 0) _write_bytes(padding.data(), alignment - misalignment);
+  }
+
+  size_t offset() const { return _offset; }
+
+ private:
+  void _write_bytes(const void* data, const size_t byte_count) {
+    _stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(byte_count));
+    _offset += byte_count;
+  }
+
+  std::ofstream _stream;
+  size_t _offset{0};
+};
+
+class CheckpointReader {
+ public:
+  CheckpointReader(const char* data, const size_t size, const size_t offset)
+      : _data(data), _size(size), _offset(offset) {}
+
+  template <typename T>
+  T read_value() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read directly");
+    Assert(_offset + sizeof(T) <= _size, "Checkpoint is truncated");
+    auto value = T{};
+    std::memcpy(&value, _data + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read_value<uint32_t>();
+    Assert(_offset + length <= _size, "Checkpoint is truncated");
+    auto value = std::string(_data + _offset, length);
+    _offset += length;
+    return value;
+  }
+
+  // Counterpart to CheckpointWriter::write_values(). The values are copied from the buffer into the container in one
+  // go.
+  template <typename Container>
+  Container read_values() {
+    using T = typename Container::value_type;
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto [lengths_begin, lengths_end] = _read_buffer<uint32_t>();
+      const auto characters = _read_buffer<char>().first;
+
+      auto values = Container(static_cast<size_t>(lengths_end - lengths_begin));
+      auto character_offset = size_t{0};
+      auto value_iter = values.begin();
+      for (auto length_iter = lengths_begin; length_iter != lengths_end; ++length_iter, ++value_iter) {
+        *value_iter = pmr_string(characters + character_offset, *length_iter);
+        character_offset += *length_iter;
+      }
+      return values;
+    } else if constexpr (std::is_same_v<T, bool>) {
+      const auto [begin, end] = _read_buffer<BoolAsByteType>();
+      return Container(begin, end);
+    } else {
+      const auto [begin, end] = _read_buffer<T>();
+      return Container(begin, end);
+    }
+  }
+
+ private:
+  // Returns the range of a buffer within the data. As the data starts at a page boundary of the file (see
+  // CheckpointBuffer), the range is aligned as well.
+  template <typename T>
+  std::pair<const T*, const T*> _read_buffer() {
+    const auto byte_count = read_value<uint64_t>();
+    const auto alignment = buffer_alignment(byte_count);
+    _offset += (alignment - _offset % alignment) % alignment;
+    Assert(_offset + byte_count <= _size && byte_count % sizeof(T) == 0, "Checkpoint is corrupted");
+
+    const auto* begin = reinterpret_cast<const T*>(_data + _offset);
+    _offset += byte_count;
+    return {begin, begin + byte_count / sizeof(T)};
+  }
+
+  const char* const _data;
+  const size_t _size;
+  size_t _offset;
+};
+
+// Bytes of a checkpoint file that were read into memory. The buffer starts at the page boundary before the first
+// requested byte, so that the buffers within it are aligned in memory just like in the file.
+class CheckpointBuffer : private Noncopyable {
+ public:
+  CheckpointBuffer(const int file_descriptor, const size_t file_size, const size_t begin, const size_t end)
+      : _begin_offset(begin % CHECKPOINT_PAGE_SIZE), _size(end - begin + _begin_offset) {
+    Assert(begin <= end && end <= file_size, "Checkpoint is corrupted");
+
+    _data.reset(static_cast<char*>(::operator new(_size, std::align_val_t{CHECKPOINT_PAGE_SIZE})));
+    const auto file_offset = begin - _begin_offset;
+    auto read_bytes = size_t{0};
+    while (read_bytes < _size) {
+      const auto result = pread(file_descriptor, _data.get() + read_bytes, _size - read_bytes,
+                                static_cast<off_t>(file_offset + read_bytes));
+      if (result < 0 && errno == EINTR) continue;
+      Assert(result > 0, std::string{"Cannot read checkpoint: "} + std::strerror(errno));
+      read_bytes += static_cast<size_t>(result);
+    }
+  }
+
+  // Reader positioned at the first requested byte
+  CheckpointReader reader() const { return CheckpointReader{_data.get(), _size, _begin_offset}; }
+
+ private:
+  struct AlignedDelete {
+    void operator()(char* data) const { ::operator delete(data, std::align_val_t{CHECKPOINT_PAGE_SIZE}); }
+  };
+
+  size_t _begin_offset;
+  size_t _size;
+  std::unique_ptr<char, AlignedDelete> _data;
+};
+
+// Checkpoint file opened for reading. The chunks are read with pread(), so that they can be read in parallel.
+class CheckpointFile : private Noncopyable {
+ public:
+  explicit CheckpointFile(const std::string& file_name) {
+    _file_descriptor = open(file_name.c_str(), O_RDONLY);
+    Assert(_file_descriptor >= 0, "Cannot open checkpoint '" + file_name + "': " + std::strerror(errno));
+
+    struct stat file_stat {};
+    const auto stat_result = fstat(_file_descriptor, &file_stat);
+    if (stat_result != 0) close(_file_descriptor);
+    Assert(stat_result == 0, "Cannot read checkpoint '" + file_name + "'");
+    _size = static_cast<size_t>(file_stat.st_size);
+  }
+
+  ~CheckpointFile() { close(_file_descriptor); }
+
+  // Reads the bytes [begin, end) of the file
+  CheckpointBuffer read(const size_t begin, const size_t end) const {
+    return CheckpointBuffer{_file_descriptor, _size, begin, end};
+  }
+
+  size_t size() const { return _size; }
+
+ private:
+  int _file_descriptor;
+  size_t _size{0};
+};
+
+void write_compressed_vector(CheckpointWriter& writer, const BaseCompressedVector& vector) {
+  writer.write_value(vector.type());
+  writer.write_value(static_cast<uint64_t>(vector.size()));
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) { writer.write_values(typed_vector.data()); });
+}
+
+std::unique_ptr<const BaseCompressedVector> read_compressed_vector(CheckpointReader& reader) {
+  const auto type = reader.read_value<CompressedVectorType>();
+  const auto size = reader.read_value<uint64_t>();
+
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(reader.read_values<pmr_vector<uint32_t>>());
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(reader.read_values<pmr_vector<uint16_t>>());
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(reader.read_values<pmr_vector<uint8_t>>());
+    case CompressedVectorType::SimdBp128:
+      return std::make_unique<SimdBp128Vector>(reader.read_values<pmr_vector<uint128_t>>(), size);
+  }
+  Fail("Unknown compressed vector type in checkpoint");
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const BaseSegment& segment) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    writer.write_value(EncodingType::Unencoded);
+    writer.write_value(static_cast<BoolAsByteType>(value_segment->is_nullable()));
+    if (value_segment->is_nullable()) writer.write_values(value_segment->null_values());
+    writer.write_values(value_segment->values());
+    return;
+  }
+
+  const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+  Assert(encoded_segment, "Only value segments and encoded segments can be stored in a checkpoint");
+  writer.write_value(encoded_segment->encoding_type());
+
+  resolve_encoded_segment_type<T>(*encoded_segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>> ||
+                  std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) {
+      // Fixed-string dictionaries are stored as regular string dictionaries and rebuilt when they are read
+      writer.write_value(typed_segment.null_value_id());
+      writer.write_values(*typed_segment.dictionary());
+      write_compressed_vector(writer, *typed_segment.attribute_vector());
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      writer.write_values(*typed_segment.values());
+      writer.write_values(*typed_segment.null_values());
+      writer.write_values(*typed_segment.end_positions());
+    } else if constexpr (is_frame_of_reference_segment_v<SegmentType>) {
+      writer.write_values(typed_segment.block_minima());
+      writer.write_values(typed_segment.null_values());
+      write_compressed_vector(writer, typed_segment.offset_values());
+    } else if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) {
+      writer.write_value(static_cast<uint64_t>(typed_segment.size()));
+      writer.write_value(static_cast<uint64_t>(typed_segment.block_size()));
+      writer.write_value(static_cast<uint64_t>(typed_segment.last_block_size()));
+      writer.write_value(static_cast<uint64_t>(typed_segment.compressed_size()));
+      writer.write_values(typed_segment.dictionary());
+
+      writer.write_value(static_cast<uint64_t>(typed_segment.lz4_blocks().size()));
+      for (const auto& lz4_block : typed_segment.lz4_blocks()) {
+        writer.write_values(lz4_block);
+      }
+
+      const auto& null_values = typed_segment.null_values();
+      writer.write_value(static_cast<BoolAsByteType>(null_values.has_value()));
+      if (null_values) writer.write_values(*null_values);
+
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        const auto& string_offsets = typed_segment.string_offsets();
+        const auto has_string_offsets = string_offsets && *string_offsets;
+        writer.write_value(static_cast<BoolAsByteType>(has_string_offsets));
+        if (has_string_offsets) write_compressed_vector(writer, **string_offsets);
+      }
+    } else {
+      Fail("Segment encoding is not supported by checkpoints");
+    }
+  });
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> read_segment(CheckpointReader& reader) {
+  const auto encoding_type = reader.read_value<EncodingType>();
+
+  switch (encoding_type) {
+    case EncodingType::Unencoded: {
+      if (reader.read_value<BoolAsByteType>()) {
+        auto null_values = reader.read_values<pmr_concurrent_vector<bool>>();
+        auto values = reader.read_values<pmr_concurrent_vector<T>>();
+        return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+      }
+      return std::make_shared<ValueSegment<T>>(reader.read_values<pmr_concurrent_vector<T>>());
+    }
+
+    case EncodingType::Dictionary: {
+      const auto null_value_id = reader.read_value<ValueID>();
+      const auto dictionary = std::make_shared<pmr_vector<T>>(reader.read_values<pmr_vector<T>>());
+      const auto attribute_vector = std::shared_ptr<const BaseCompressedVector>{read_compressed_vector(reader)};
+      return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
+    }
+
+    case EncodingType::FixedStringDictionary: {
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        const auto null_value_id = reader.read_value<ValueID>();
+        const auto dictionary = reader.read_values<pmr_vector<pmr_string>>();
+        const auto attribute_vector = std::shared_ptr<const BaseCompressedVector>{read_compressed_vector(reader)};
+
+        // Same string length as chosen by the DictionaryEncoder
+        auto max_string_length = size_t{0};
+        for (const auto& value : dictionary) {
+          max_string_length = std::max(max_string_length, value.size());
+        }
+        const auto fixed_string_dictionary =
+            std::make_shared<FixedStringVector>(dictionary.cbegin(), dictionary.cend(), max_string_length);
+        return std::make_shared<FixedStringDictionarySegment<T>>(fixed_string_dictionary, attribute_vector,
+                                                                 null_value_id);
+      }
+      break;
+    }
+
+    case EncodingType::RunLength: {
+      const auto values = std::make_shared<pmr_vector<T>>(reader.read_values<pmr_vector<T>>());
+      const auto null_values = std::make_shared<pmr_vector<bool>>(reader.read_values<pmr_vector<bool>>());
+      const auto end_positions =
+          std::make_shared<pmr_vector<ChunkOffset>>(reader.read_values<pmr_vector<ChunkOffset>>());
+      return std::make_shared<RunLengthSegment<T>>(values, null_values, end_positions);
+    }
+
+    case EncodingType::FrameOfReference: {
+      constexpr auto frame_of_reference_c = enum_c<EncodingType, EncodingType::FrameOfReference>;
+      if constexpr (hana::value(encoding_supports_data_type(frame_of_reference_c, hana::type_c<T>))) {
+        auto block_minima = reader.read_values<pmr_vector<T>>();
+        auto null_values = reader.read_values<pmr_vector<bool>>();
+        auto offset_values = read_compressed_vector(reader);
+        return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
+                                                            std::move(offset_values));
+      }
+      break;
+    }
+
+    case EncodingType::LZ4: {
+      const auto num_elements = reader.read_value<uint64_t>();
+      const auto block_size = reader.read_value<uint64_t>();
+      const auto last_block_size = reader.read_value<uint64_t>();
+      const auto compressed_size = reader.read_value<uint64_t>();
+      auto dictionary = reader.read_values<pmr_vector<char>>();
+
+      const auto lz4_block_count = reader.read_value<uint64_t>();
+      auto lz4_blocks = pmr_vector<pmr_vector<char>>{};
+      lz4_blocks.reserve(lz4_block_count);
+      for (auto block_index = uint64_t{0}; block_index < lz4_block_count; ++block_index) {
+        lz4_blocks.emplace_back(reader.read_values<pmr_vector<char>>());
+      }
+
+      auto null_values = std::optional<pmr_vector<bool>>{};
+      if (reader.read_value<BoolAsByteType>()) null_values = reader.read_values<pmr_vector<bool>>();
+
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        auto string_offsets = std::unique_ptr<const BaseCompressedVector>{};
+        if (reader.read_value<BoolAsByteType>()) string_offsets = read_compressed_vector(reader);
+        return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
+                                               std::move(string_offsets), block_size, last_block_size,
+                                               compressed_size, num_elements);
+      } else {
+        return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
+                                               block_size, last_block_size, compressed_size, num_elements);
+      }
+    }
+  }
+
+  Fail("Checkpoint contains a segment encoding that is not supported for its data type");
+}
+
+void write_chunk(CheckpointWriter& writer, const Table& table, const Chunk& chunk, const CommitID snapshot_commit_id) {
+  writer.write_value(static_cast<ChunkOffset>(chunk.size()));
+  writer.write_value(static_cast<BoolAsByteType>(chunk.is_mutable()));
+
+  // Rows that are not visible to a transaction starting now (deleted or not yet committed rows) stay invisible when the
+  // checkpoint is read
+  // Likewise, values written by Update that were committed before the checkpoint but are not installed yet are written
+  // to the checkpoint, see ColumnVersionStore
+  auto invisible_chunk_offsets = std::vector<ChunkOffset>{};
+  auto versions = std::vector<ColumnVersionStore::Version>{};
+  if (table.has_mvcc() == UseMvcc::Yes) {
+    const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      if (mvcc_data->begin_cids[chunk_offset] > snapshot_commit_id ||
+          mvcc_data->end_cids[chunk_offset] <= snapshot_commit_id) {
+        invisible_chunk_offsets.emplace_back(chunk_offset);
+      }
+    }
+
+    // No transaction has the invalid transaction id, so that only committed versions are returned
+    versions = mvcc_data->column_versions.visible_versions(INVALID_TRANSACTION_ID, snapshot_commit_id);
+  }
+  writer.write_values(invisible_chunk_offsets);
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto segment = chunk.get_segment(column_id);
+    const auto has_versions = std::any_of(versions.begin(), versions.end(),
+                                          [&](const auto& version) { return version.column_id == column_id; });
+    if (has_versions) {
+      segment = ColumnVersionStore::apply(*segment, table.column_is_nullable(column_id), column_id, versions);
+    }
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      write_segment<ColumnDataType>(writer, *segment);
+    });
+  }
+}
+
+struct CheckpointChunk {
+  Segments segments;
+  std::shared_ptr<MvccData> mvcc_data;
+  size_t invisible_row_count{0};
+  bool is_mutable{true};
+};
+
+CheckpointChunk read_chunk(CheckpointReader& reader, const TableColumnDefinitions& column_definitions,
+                           const UseMvcc use_mvcc) {
+  auto chunk = CheckpointChunk{};
+  const auto row_count = reader.read_value<ChunkOffset>();
+  chunk.is_mutable = static_cast<bool>(reader.read_value<BoolAsByteType>());
+  const auto invisible_chunk_offsets = reader.read_values<std::vector<ChunkOffset>>();
+
+  for (const auto& column_definition : column_definitions) {
+    resolve_data_type(column_definition.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk.segments.emplace_back(read_segment<ColumnDataType>(reader));
+    });
+  }
+
+  if (use_mvcc == UseMvcc::Yes) {
+    // All visible rows are treated as if they had been committed before the first transaction after the restart
+    chunk.mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
+    for (const auto chunk_offset : invisible_chunk_offsets) {
+      chunk.mvcc_data->end_cids[chunk_offset] = CommitID{0};
+    }
+
+    if (!invisible_chunk_offsets.empty()) {
+      chunk.mvcc_data->register_delete();
+      chunk.mvcc_data->register_delete_commit(invisible_chunk_offsets.size(), CommitID{0});
+      chunk.invisible_row_count = invisible_chunk_offsets.size();
+    }
+  }
+
+  return chunk;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void Checkpoint::write_table(const Table& table, const std::string& file_name) {
+  Assert(table.type() == TableType::Data, "Only data tables can be checkpointed");
+
+  auto writer = CheckpointWriter{file_name};
+  const auto snapshot_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  // Chunks that were physically deleted by the MvccDeletePlugin are skipped
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk) chunks.emplace_back(chunk);
+  }
+
+  writer.write_value(CHECKPOINT_MAGIC_NUMBER);
+  writer.write_value(CHECKPOINT_VERSION);
+  writer.write_value(table.max_chunk_size());
+  writer.write_value(static_cast<uint32_t>(chunks.size()));
+  writer.write_value(static_cast<BoolAsByteType>(table.has_mvcc() == UseMvcc::Yes));
+  writer.write_value(static_cast<uint16_t>(table.column_count()));
+  for (const auto& column_definition : table.column_definitions()) {
+    writer.write_string(column_definition.name);
+    writer.write_value(column_definition.data_type);
+    writer.write_value(static_cast<BoolAsByteType>(column_definition.nullable));
+  }
+
+  auto chunk_offsets = std::vector<uint64_t>{};
+  chunk_offsets.reserve(chunks.size());
+  for (const auto& chunk : chunks) {
+    writer.align(CHECKPOINT_PAGE_SIZE);
+    chunk_offsets.emplace_back(writer.offset());
+    write_chunk(writer, table, *chunk, snapshot_commit_id);
+  }
+
+  const auto chunk_index_offset = static_cast<uint64_t>(writer.offset());
+  writer.write_values(chunk_offsets);
+  writer.write_value(chunk_index_offset);
+}
+
+std::shared_ptr<Table> Checkpoint::read_table(const std::string& file_name) {
+  const auto file = CheckpointFile{file_name};
+
+  constexpr auto PREFIX_SIZE = sizeof(uint64_t) + sizeof(uint32_t);
+  Assert(file.size() >= PREFIX_SIZE + sizeof(uint64_t), "'" + file_name + "' is not a checkpoint");
+  {
+    const auto prefix = file.read(0, PREFIX_SIZE);
+    auto reader = prefix.reader();
+    Assert(reader.read_value<uint64_t>() == CHECKPOINT_MAGIC_NUMBER, "'" + file_name + "' is not a checkpoint");
+    Assert(reader.read_value<uint32_t>() == CHECKPOINT_VERSION,
+           "Unsupported version of checkpoint '" + file_name + "'");
+  }
+
+  const auto footer_offset = file.size() - sizeof(uint64_t);
+  const auto chunk_index_offset = file.read(footer_offset, file.size()).reader().read_value<uint64_t>();
+  const auto chunk_offsets = file.read(chunk_index_offset, footer_offset).reader().read_values<std::vector<uint64_t>>();
+
+  // The header ends where the first chunk (or the chunk index) begins
+  const auto header = file.read(PREFIX_SIZE, chunk_offsets.empty() ? chunk_index_offset : chunk_offsets.front());
+  auto reader = header.reader();
+  const auto max_chunk_size = reader.read_value<ChunkOffset>();
+  const auto chunk_count = reader.read_value<uint32_t>();
+  const auto use_mvcc = reader.read_value<BoolAsByteType>() ? UseMvcc::Yes : UseMvcc::No;
+  const auto column_count = reader.read_value<uint16_t>();
+  Assert(chunk_offsets.size() == chunk_count, "Checkpoint is corrupted");
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto name = reader.read_string();
+    const auto data_type = reader.read_value<DataType>();
+    const auto nullable = static_cast<bool>(reader.read_value<BoolAsByteType>());
+    column_definitions.emplace_back(std::move(name), data_type, nullable);
+  }
+
+  // The chunks are independent of each other and are read in parallel. Each chunk is read with a single pread() and
+  // its buffers are copied into the segments.
+  auto chunks = std::vector<CheckpointChunk>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto chunk_end_offset =
+          chunk_index + 1 < chunk_count ? chunk_offsets[chunk_index + 1] : chunk_index_offset;
+      const auto chunk_buffer = file.read(chunk_offsets[chunk_index], chunk_end_offset);
+      auto chunk_reader = chunk_buffer.reader();
+      chunks[chunk_index] = read_chunk(chunk_reader, column_definitions, use_mvcc);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, use_mvcc);
+  for (const auto& chunk : chunks) {
+    table->append_chunk(chunk.segments, chunk.mvcc_data);
+  }
+
+  // Same as after encoding a chunk with the ChunkEncoder
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& checkpoint_chunk = chunks[chunk_id];
+    const auto chunk = table->get_chunk(chunk_id);
+    if (checkpoint_chunk.invisible_row_count > 0) {
+      chunk->increase_invalid_row_count(checkpoint_chunk.invisible_row_count);
+    }
+    if (checkpoint_chunk.is_mutable) continue;
+
+    chunk->mark_immutable();
+    jobs.emplace_back(std::make_shared<JobTask>([chunk]() { generate_chunk_pruning_statistics(chunk); }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  return table;
+}
+
+}  // namespace opossum
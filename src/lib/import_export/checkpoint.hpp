@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Checkpoints store a data table including its encoded segments, so that it can be loaded at startup without parsing
+ * or re-encoding it (as opposed to CSV files, which need to be parsed and encoded, and binary files written by
+ * ExportBinary, which only support dictionary segments with byte-aligned attribute vectors and are read value by value
+ * through a stream).
+ *
+ * All encodings are supported: ValueSegments, dictionaries (including fixed-string dictionaries), RunLength,
+ * FrameOfReference, and LZ4 segments, together with their FixedSizeByteAligned or SimdBp128 compressed vectors. Every
+ * buffer of a segment (e.g., a dictionary or an attribute vector) is stored as a contiguous block in its in-memory
+ * representation. Blocks are aligned to cache lines, blocks of at least one page as well as chunks are aligned to
+ * pages.
+ *
+ * read_table() reads the chunks in parallel, each with a single pread() into a page-aligned buffer. Every buffer of a
+ * segment is then copied into the segment in one go, without parsing or re-encoding values. Only the rows that were
+ * visible to transactions at the time of the checkpoint are visible after loading it, with the values that were
+ * visible then (including committed updates that were not installed into the segments yet). The table must not be modified while the checkpoint is written.
+ *
+ * File layout:
+ *
+ * Header       | Magic number, version, max chunk size, chunk count, MVCC flag, column definitions
+ * Chunks       | For each chunk: row count, mutability flag, offsets of invisible rows, segments
+ * Chunk index  | Offsets of the chunks in the file
+ * Footer       | Offset of the chunk index
+ */
+class Checkpoint {
+ public:
+  static void write_table(const Table& table, const std::string& file_name);
+
+  static std::shared_ptr<Table> read_table(const std::string& file_name);
+};
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include "log_entry.hpp"
+
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+void LogEntryWriter::write(const std::string& value) {
+  write(static_cast<uint32_t>(value.size()));
+  _buffer.insert(_buffer.end(), value.begin(), value.end());
+}
+
+void LogEntryWriter::write(const pmr_string& value) {
+  write(static_cast<uint32_t>(value.size()));
+  _buffer.insert(_buffer.end(), value.begin(), value.end());
+}
+
+bool LogEntryWriter::empty() const { return _buffer.empty(); }
+
+const std::vector<char>& LogEntryWriter::buffer() const { return _buffer; }
+
+LogEntryReader::LogEntryReader(const char* data, const size_t size) : _data(data), _size(size) {}
+
+template <>
+std::string LogEntryReader::read<std::string>() {
+  const auto length = read<uint32_t>();
+  Assert(_offset + length <= _size, "Log entry is truncated");
+  auto value = std::string{_data + _offset, length};
+  _offset += length;
+  return value;
+}
+
+template <>
+pmr_string LogEntryReader::read<pmr_string>() {
+  const auto length = read<uint32_t>();
+  Assert(_offset + length <= _size, "Log entry is truncated");
+  auto value = pmr_string{_data + _offset, length};
+  _offset += length;
+  return value;
+}
+
+bool LogEntryReader::at_end() const { return _offset == _size; }
+
+uint64_t log_entry_checksum(const char* data, const size_t size) {
+  // FNV-1a
+  auto checksum = uint64_t{0xcbf29ce484222325};
+  for (auto index = size_t{0}; index < size; ++index) {
+    checksum ^= static_cast<uint8_t>(data[index]);
+    checksum *= uint64_t{0x100000001b3};
+  }
+  return checksum;
+}
+
+}  // namespace opossum
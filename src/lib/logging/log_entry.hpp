@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Types of the records within a log entry, see the _on_write_log_records() implementations of the read/write operators
+enum class LogRecordType : uint8_t { CreateTable, Insert, Delete, Update };
+
+/**
+ * Serializes the records of a committing transaction into a single log entry of the write-ahead log (see Logger).
+ * Values are written in their in-memory representation, strings are prefixed with their length.
+ */
+class LogEntryWriter : private Noncopyable {
+ public:
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly");
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    _buffer.insert(_buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  void write(const std::string& value);
+  void write(const pmr_string& value);
+
+  bool empty() const;
+  const std::vector<char>& buffer() const;
+
+ private:
+  std::vector<char> _buffer;
+};
+
+/**
+ * Reads the records of a log entry written by a LogEntryWriter
+ */
+class LogEntryReader {
+ public:
+  LogEntryReader(const char* data, const size_t size);
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read directly");
+    Assert(_offset + sizeof(T) <= _size, "Log entry is truncated");
+    auto value = T{};
+    std::memcpy(&value, _data + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  bool at_end() const;
+
+ private:
+  const char* const _data;
+  const size_t _size;
+  size_t _offset{0};
+};
+
+template <>
+std::string LogEntryReader::read<std::string>();
+
+template <>
+pmr_string LogEntryReader::read<pmr_string>();
+
+// Checksum of a log entry (header and records), which is used to detect an entry that was only partially written
+// before a crash
+uint64_t log_entry_checksum(const char* data, const size_t size);
+
+}  // namespace opossum
@@ -0,0 +1,296 @@
+#include "log_recovery.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "log_entry.hpp"
+#include "logger.hpp"
+#include "resolve_type.hpp"
+#include "storage/column_version_store.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct InsertRecord {
+  std::string table_name;
+  ChunkID chunk_id;
+  ChunkOffset begin_chunk_offset;
+  std::vector<std::vector<AllTypeVariant>> rows;
+};
+
+struct DeleteRecord {
+  std::string table_name;
+  std::vector<RowID> row_ids;
+};
+
+struct UpdateRecord {
+  struct Cell {
+    RowID row_id;
+    ColumnID column_id;
+    AllTypeVariant value;
+  };
+
+  CommitID commit_id;
+  std::string table_name;
+  std::vector<Cell> cells;
+};
+
+// Invalidates a row as if it had been deleted before any transaction that runs after the recovery
+void invalidate_row(Chunk& chunk, const ChunkOffset chunk_offset) {
+  auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  mvcc_data->register_delete();
+  mvcc_data->end_cids[chunk_offset] = CommitID{0};
+  mvcc_data->register_delete_commit(1, CommitID{0});
+  chunk.increase_invalid_row_count(1);
+}
+
+// Fills the position of a row that was inserted by a transaction which did not commit
+void append_invisible_row(const Table& table, Chunk& chunk) {
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& column_definition : table.column_definitions()) {
+    if (column_definition.nullable) {
+      values.emplace_back(NULL_VALUE);
+      continue;
+    }
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      values.emplace_back(ColumnDataType{});
+    });
+  }
+
+  chunk.append(values);
+  invalidate_row(chunk, chunk.size() - 1);
+}
+
+void read_create_table_record(LogEntryReader& reader) {
+  const auto table_name = reader.read<std::string>();
+  const auto column_count = reader.read<uint16_t>();
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = reader.read<std::string>();
+    const auto data_type = reader.read<DataType>();
+    const auto nullable = reader.read<bool>();
+    column_definitions.emplace_back(name, data_type, nullable);
+  }
+
+  // Same parameters as in CreateTable
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(table_name)) {
+    storage_manager.add_table(table_name, std::make_shared<Table>(column_definitions, TableType::Data,
+                                                                  Chunk::DEFAULT_SIZE, UseMvcc::Yes));
+  }
+}
+
+InsertRecord read_insert_record(LogEntryReader& reader) {
+  auto record = InsertRecord{};
+  record.table_name = reader.read<std::string>();
+  record.chunk_id = reader.read<ChunkID>();
+  record.begin_chunk_offset = reader.read<ChunkOffset>();
+  const auto end_chunk_offset = reader.read<ChunkOffset>();
+
+  Assert(Hyrise::get().storage_manager.has_table(record.table_name),
+         "Log refers to unknown table '" + record.table_name + "'");
+  const auto table = Hyrise::get().storage_manager.get_table(record.table_name);
+
+  const auto column_count = table->column_count();
+  record.rows.resize(end_chunk_offset - record.begin_chunk_offset, std::vector<AllTypeVariant>(column_count));
+
+  // The values are written column by column, see Insert::_on_write_log_records()
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto nullable = table->column_is_nullable(column_id);
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      for (auto& row : record.rows) {
+        if (nullable && reader.read<bool>()) {
+          row[column_id] = NULL_VALUE;
+        } else {
+          row[column_id] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  return record;
+}
+
+DeleteRecord read_delete_record(LogEntryReader& reader) {
+  auto record = DeleteRecord{};
+  record.table_name = reader.read<std::string>();
+
+  const auto row_count = reader.read<uint32_t>();
+  record.row_ids.reserve(row_count);
+  for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+    const auto chunk_id = reader.read<ChunkID>();
+    const auto chunk_offset = reader.read<ChunkOffset>();
+    record.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+
+  return record;
+}
+
+UpdateRecord read_update_record(LogEntryReader& reader, const CommitID commit_id) {
+  auto record = UpdateRecord{};
+  record.commit_id = commit_id;
+  record.table_name = reader.read<std::string>();
+
+  Assert(Hyrise::get().storage_manager.has_table(record.table_name),
+         "Log refers to unknown table '" + record.table_name + "'");
+  const auto table = Hyrise::get().storage_manager.get_table(record.table_name);
+
+  // See Update::_on_write_log_records()
+  const auto cell_count = reader.read<uint32_t>();
+  record.cells.reserve(cell_count);
+  for (auto cell_index = uint32_t{0}; cell_index < cell_count; ++cell_index) {
+    auto cell = UpdateRecord::Cell{};
+    cell.row_id.chunk_id = reader.read<ChunkID>();
+    cell.row_id.chunk_offset = reader.read<ChunkOffset>();
+    cell.column_id = reader.read<ColumnID>();
+    Assert(cell.column_id < table->column_count(), "Log updates unknown column of '" + record.table_name + "'");
+
+    resolve_data_type(table->column_data_type(cell.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if (table->column_is_nullable(cell.column_id) && reader.read<bool>()) {
+        cell.value = NULL_VALUE;
+      } else {
+        cell.value = reader.read<ColumnDataType>();
+      }
+    });
+    record.cells.emplace_back(std::move(cell));
+  }
+
+  return record;
+}
+
+void apply_insert_record(const InsertRecord& record) {
+  const auto table = Hyrise::get().storage_manager.get_table(record.table_name);
+  while (table->chunk_count() <= record.chunk_id) {
+    table->append_mutable_chunk();
+  }
+
+  const auto chunk = table->get_chunk(record.chunk_id);
+  Assert(chunk->size() <= record.begin_chunk_offset,
+         "Rows of table '" + record.table_name + "' in the log overlap with existing rows");
+
+  while (chunk->size() < record.begin_chunk_offset) {
+    append_invisible_row(*table, *chunk);
+  }
+
+  for (const auto& row : record.rows) {
+    chunk->append(row);
+  }
+}
+
+void apply_delete_record(const DeleteRecord& record) {
+  const auto table = Hyrise::get().storage_manager.get_table(record.table_name);
+  for (const auto& row_id : record.row_ids) {
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    Assert(chunk && row_id.chunk_offset < chunk->size(), "Log deletes unknown row of '" + record.table_name + "'");
+    invalidate_row(*chunk, row_id.chunk_offset);
+  }
+}
+
+void apply_update_record(const UpdateRecord& record) {
+  const auto table = Hyrise::get().storage_manager.get_table(record.table_name);
+  for (const auto& cell : record.cells) {
+    const auto chunk = table->get_chunk(cell.row_id.chunk_id);
+    Assert(chunk && cell.row_id.chunk_offset < chunk->size(), "Log updates unknown row of '" + record.table_name + "'");
+
+    const auto written =
+        ColumnVersionStore::write_value(*chunk->get_segment(cell.column_id), cell.row_id.chunk_offset, cell.value);
+    Assert(written, "Updated values can only be recovered into ValueSegments");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+size_t LogRecovery::recover(const std::string& file_name) {
+  auto file = std::ifstream{file_name, std::ios::binary};
+  Assert(file.is_open(), "Cannot open log file '" + file_name + "'");
+  const auto log = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+  auto insert_records = std::vector<InsertRecord>{};
+  auto delete_records = std::vector<DeleteRecord>{};
+  auto update_records = std::vector<UpdateRecord>{};
+  auto transaction_count = size_t{0};
+
+  auto offset = size_t{0};
+  while (offset + Logger::ENTRY_HEADER_SIZE <= log.size()) {
+    auto header_reader = LogEntryReader{log.data() + offset, Logger::ENTRY_HEADER_SIZE};
+    const auto records_size = header_reader.read<uint32_t>();
+    const auto commit_id = header_reader.read<CommitID>();
+    const auto records_offset = offset + Logger::ENTRY_HEADER_SIZE;
+    if (records_offset + records_size + Logger::ENTRY_CHECKSUM_SIZE > log.size()) break;
+
+    auto checksum_reader = LogEntryReader{log.data() + records_offset + records_size, Logger::ENTRY_CHECKSUM_SIZE};
+    if (checksum_reader.read<uint64_t>() !=
+        log_entry_checksum(log.data() + offset, Logger::ENTRY_HEADER_SIZE + records_size)) {
+      break;
+    }
+
+    // Tables are created right away, as the following records might refer to them
+    auto reader = LogEntryReader{log.data() + records_offset, records_size};
+    while (!reader.at_end()) {
+      switch (reader.read<LogRecordType>()) {
+        case LogRecordType::CreateTable:
+          read_create_table_record(reader);
+          break;
+        case LogRecordType::Insert:
+          insert_records.emplace_back(read_insert_record(reader));
+          break;
+        case LogRecordType::Delete:
+          delete_records.emplace_back(read_delete_record(reader));
+          break;
+        case LogRecordType::Update:
+          update_records.emplace_back(read_update_record(reader, commit_id));
+          break;
+      }
+    }
+
+    ++transaction_count;
+    offset = records_offset + records_size + Logger::ENTRY_CHECKSUM_SIZE;
+  }
+
+  // A partially written entry is cut off. Otherwise, the Logger would append the entries of new transactions after it,
+  // and they would not be replayed by the next recovery.
+  file.close();
+  if (offset < log.size()) std::filesystem::resize_file(file_name, offset);
+
+  // As all modifications are replayed with the same commit id, the order of the transactions does not matter.
+  // However, rows have to be inserted in the order of their positions (which concurrent transactions do not
+  // necessarily commit in) and before they are deleted or updated. Updates of the same cell have to be applied in the
+  // order of their commit ids, which is not necessarily the order of the log.
+  std::sort(insert_records.begin(), insert_records.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.table_name, lhs.chunk_id, lhs.begin_chunk_offset) <
+           std::tie(rhs.table_name, rhs.chunk_id, rhs.begin_chunk_offset);
+  });
+
+  for (const auto& record : insert_records) {
+    apply_insert_record(record);
+  }
+
+  for (const auto& record : delete_records) {
+    apply_delete_record(record);
+  }
+
+  std::stable_sort(update_records.begin(), update_records.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.commit_id < rhs.commit_id; });
+  for (const auto& record : update_records) {
+    apply_update_record(record);
+  }
+
+  return transaction_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Replays a write-ahead log written by the Logger into the StorageManager. This has to be done at startup, before any
+ * transaction runs and before a new Logger is created for the same file.
+ *
+ * Tables that were created by CreateTable are recreated, all other tables are expected to be loaded already and to
+ * have the same contents as when the log was started (e.g., freshly generated benchmark data). Rows are inserted at
+ * the positions that they had originally, so that deletes can refer to them by their RowID. Positions that belonged
+ * to transactions that did not commit are filled with invisible rows.
+ *
+ * All replayed modifications are treated as if they had been committed before the first transaction after the
+ * recovery, i.e., with commit id 0. An entry that was only partially written before a crash ends the replay and is
+ * removed from the file, so that the Logger appends new entries right after the last complete one.
+ */
+class LogRecovery {
+ public:
+  // Returns the number of replayed transactions
+  static size_t recover(const std::string& file_name);
+};
+
+}  // namespace opossum
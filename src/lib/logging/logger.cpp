@@ -0,0 +1,144 @@
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_entry.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Logger::Logger(const std::string& file_name, const LogFlushPolicy flush_policy)
+    : _file_name(file_name), _flush_policy(flush_policy) {
+  _file_descriptor = open(file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open log file '" + file_name + "': " + std::strerror(errno));
+
+  _flush_thread = std::thread(&Logger::_flush_loop, this);
+}
+
+Logger::~Logger() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _entries_appended.notify_one();
+  _flush_thread.join();
+
+  close(_file_descriptor);
+}
+
+void Logger::append(const CommitID commit_id, const LogEntryWriter& log_entry,
+                    const std::function<void()>& on_durable) {
+  const auto& records = log_entry.buffer();
+  const auto records_size = static_cast<uint32_t>(records.size());
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto append_bytes = [&](const auto* data, const size_t size) {
+      const auto* bytes = reinterpret_cast<const char*>(data);
+      _buffer.insert(_buffer.end(), bytes, bytes + size);
+    };
+
+    // The checksum covers the header, so that a corrupted size or commit id is detected as well
+    const auto entry_offset = _buffer.size();
+    append_bytes(&records_size, sizeof(records_size));
+    append_bytes(&commit_id, sizeof(commit_id));
+    append_bytes(records.data(), records.size());
+    const auto checksum = log_entry_checksum(_buffer.data() + entry_offset, _buffer.size() - entry_offset);
+    append_bytes(&checksum, sizeof(checksum));
+    ++_appended_entry_count;
+
+    if (_flush_policy == LogFlushPolicy::GroupCommit) _callbacks.emplace_back(on_durable);
+  }
+
+  if (_flush_policy == LogFlushPolicy::GroupCommit) {
+    _entries_appended.notify_one();
+  } else {
+    on_durable();
+  }
+}
+
+void Logger::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  const auto target_entry_count = _appended_entry_count;
+  _flush_requested = true;
+  _entries_appended.notify_one();
+  _entries_flushed.wait(lock, [&]() { return _flushed_entry_count >= target_entry_count; });
+}
+
+const std::string& Logger::file_name() const { return _file_name; }
+
+LogFlushPolicy Logger::flush_policy() const { return _flush_policy; }
+
+void Logger::_flush_loop() {
+  auto buffer = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    auto flushed_entry_count = uint64_t{0};
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      const auto flush_needed = [&]() {
+        if (_shutdown || _flush_requested) return true;
+        if (_flush_policy == LogFlushPolicy::GroupCommit) return !_buffer.empty();
+        return _buffer.size() >= ASYNC_FLUSH_THRESHOLD;
+      };
+
+      if (_flush_policy == LogFlushPolicy::GroupCommit) {
+        _entries_appended.wait(lock, flush_needed);
+      } else {
+        _entries_appended.wait_for(lock, ASYNC_FLUSH_INTERVAL, flush_needed);
+      }
+
+      if (_buffer.empty() && _shutdown) return;
+
+      // Take all entries that were appended in the meantime. New entries are appended to the (now empty) buffer while
+      // we are writing.
+      std::swap(buffer, _buffer);
+      std::swap(callbacks, _callbacks);
+      flushed_entry_count = _appended_entry_count;
+      _flush_requested = false;
+    }
+
+    if (!buffer.empty()) {
+      _write_and_sync(buffer);
+      buffer.clear();
+    }
+
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+    callbacks.clear();
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _flushed_entry_count = flushed_entry_count;
+    }
+    _entries_flushed.notify_all();
+  }
+}
+
+void Logger::_write_and_sync(const std::vector<char>& buffer) const {
+  auto written_bytes = size_t{0};
+  while (written_bytes < buffer.size()) {
+    const auto result = write(_file_descriptor, buffer.data() + written_bytes, buffer.size() - written_bytes);
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, "Cannot write to log file '" + _file_name + "': " + std::strerror(errno));
+    written_bytes += static_cast<size_t>(result);
+  }
+
+#ifdef __APPLE__
+  const auto result = fsync(_file_descriptor);
+#else
+  const auto result = fdatasync(_file_descriptor);
+#endif
+  Assert(result == 0, "Cannot sync log file '" + _file_name + "': " + std::strerror(errno));
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class LogEntryWriter;
+
+enum class LogFlushPolicy {
+  // Committing transactions wait until their log entry is on disk. Entries of concurrently committing transactions
+  // are written and synced together by the flusher thread (group commit).
+  GroupCommit,
+  // Transactions commit right away and the flusher thread syncs the log periodically. Transactions that committed
+  // shortly before a crash might be lost, but the log is never inconsistent.
+  Asynchronous
+};
+
+/**
+ * Write-ahead log for the modifications of committed transactions. When a transaction commits, its read/write
+ * operators serialize their modifications into one log entry (see AbstractReadWriteOperator::write_log_records()),
+ * which is appended to the log. Depending on the LogFlushPolicy, the transaction becomes visible only after its entry
+ * has been synced to disk.
+ *
+ * Each entry in the log file consists of its size, the commit id of the transaction, the records, and a checksum of
+ * all of these. The log is replayed by LogRecovery.
+ *
+ * Entries are only appended by committing threads, all file I/O is done by the flusher thread. This way, a single
+ * sync covers the entries of all transactions that committed while the previous sync was running.
+ */
+class Logger : private Noncopyable {
+ public:
+  Logger(const std::string& file_name, const LogFlushPolicy flush_policy);
+  ~Logger();
+
+  /**
+   * Appends the log entry of a transaction. on_durable is called once the entry is on disk (GroupCommit) or right
+   * away (Asynchronous). In the first case, it is called from the flusher thread.
+   */
+  void append(const CommitID commit_id, const LogEntryWriter& log_entry, const std::function<void()>& on_durable);
+
+  // Blocks until all entries that have been appended so far are on disk
+  void flush();
+
+  const std::string& file_name() const;
+  LogFlushPolicy flush_policy() const;
+
+  // Size of the header and the checksum that surround the records of each entry
+  static constexpr auto ENTRY_HEADER_SIZE = sizeof(uint32_t) + sizeof(CommitID);
+  static constexpr auto ENTRY_CHECKSUM_SIZE = sizeof(uint64_t);
+
+ private:
+  void _flush_loop();
+  void _write_and_sync(const std::vector<char>& buffer) const;
+
+  // With the asynchronous policy, the log is synced at least this often or when ASYNC_FLUSH_THRESHOLD bytes are
+  // buffered
+  static constexpr auto ASYNC_FLUSH_INTERVAL = std::chrono::milliseconds{10};
+  static constexpr auto ASYNC_FLUSH_THRESHOLD = size_t{1'000'000};
+
+  const std::string _file_name;
+  const LogFlushPolicy _flush_policy;
+  int _file_descriptor;
+
+  std::mutex _mutex;
+  std::condition_variable _entries_appended;
+  std::condition_variable _entries_flushed;
+
+  // Entries and callbacks that have not been handed to the flusher thread yet
+  std::vector<char> _buffer;
+  std::vector<std::function<void()>> _callbacks;
+
+  uint64_t _appended_entry_count{0};
+  uint64_t _flushed_entry_count{0};
+  bool _flush_requested{false};
+  bool _shutdown{false};
+
+  std::thread _flush_thread;
+};
+
+}  // namespace opossum
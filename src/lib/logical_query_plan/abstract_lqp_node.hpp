@@ -30,6 +30,7 @@ enum class LQPNodeType {
   Sort,
   StaticTable,
   StoredTable,
+  TopN,
   Update,
   Union,
   Validate,
@@ -9,12 +9,13 @@
 
 namespace opossum {
 
-DeleteNode::DeleteNode() : AbstractLQPNode(LQPNodeType::Delete) {}
+DeleteNode::DeleteNode(const std::string& table_name)
+    : AbstractLQPNode(LQPNodeType::Delete), table_name(table_name) {}
 
 std::string DeleteNode::description() const {
   std::ostringstream desc;
 
-  desc << "[Delete]";
+  desc << "[Delete] Table: '" << table_name << "'";
 
   return desc.str();
 }
@@ -26,12 +27,15 @@ const std::vector<std::shared_ptr<AbstractExpression>>& DeleteNode::column_expre
   return empty_vector;
 }
 
+size_t DeleteNode::_shallow_hash() const { return boost::hash_value(table_name); }
+
 std::shared_ptr<AbstractLQPNode> DeleteNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return DeleteNode::make();
+  return DeleteNode::make(table_name);
 }
 
 bool DeleteNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
-  return true;
+  const auto& delete_node_rhs = static_cast<const DeleteNode&>(rhs);
+  return table_name == delete_node_rhs.table_name;
 }
 
 }  // namespace opossum
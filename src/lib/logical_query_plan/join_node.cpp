@@ -35,6 +35,9 @@ JoinNode::JoinNode(const JoinMode join_mode, const std::vector<std::shared_ptr<A
 std::string JoinNode::description() const {
   std::stringstream stream;
   stream << "[Join] Mode: " << join_mode;
+  if (join_type == JoinType::Index) {
+    stream << " (Index on " << (index_side == IndexSide::Left ? "left" : "right") << " input)";
+  }
 
   for (const auto& predicate : join_predicates()) {
     stream << " [" << predicate->as_column_name() << "]";
@@ -96,19 +99,29 @@ bool JoinNode::is_column_nullable(const ColumnID column_id) const {
 
 const std::vector<std::shared_ptr<AbstractExpression>>& JoinNode::join_predicates() const { return node_expressions; }
 
-size_t JoinNode::_shallow_hash() const { return boost::hash_value(join_mode); }
+size_t JoinNode::_shallow_hash() const {
+  auto hash = boost::hash_value(join_mode);
+  boost::hash_combine(hash, join_type);
+  boost::hash_combine(hash, index_side);
+  return hash;
+}
 
 std::shared_ptr<AbstractLQPNode> JoinNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  auto copy = std::shared_ptr<JoinNode>{};
   if (!join_predicates().empty()) {
-    return JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
+    copy = JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
   } else {
-    return JoinNode::make(join_mode);
+    copy = JoinNode::make(join_mode);
   }
+  copy->join_type = join_type;
+  copy->index_side = index_side;
+  return copy;
 }
 
 bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& join_node = static_cast<const JoinNode&>(rhs);
   if (join_mode != join_node.join_mode) return false;
+  if (join_type != join_node.join_type || index_side != join_node.index_side) return false;
   return expressions_equal_to_expressions_in_different_lqp(join_predicates(), join_node.join_predicates(),
                                                            node_mapping);
 }
@@ -11,9 +11,12 @@
 #include "abstract_lqp_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "lqp_column_reference.hpp"
+#include "operators/abstract_join_operator.hpp"
 
 namespace opossum {
 
+enum class JoinType : uint8_t { Default, Index };
+
 /**
  * This node type is used to represent any type of Join, including cross products.
  */
@@ -36,6 +39,11 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   const JoinMode join_mode;
 
+  // Set by the IndexJoinRule. JoinType::Default leaves the choice of the join operator to the LQPTranslator,
+  // JoinType::Index requests a JoinIndex that uses the indexes of the index_side input.
+  JoinType join_type{JoinType::Default};
+  IndexSide index_side{IndexSide::Right};
+
  protected:
   size_t _shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
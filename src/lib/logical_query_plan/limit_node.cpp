@@ -9,25 +9,36 @@
 
 namespace opossum {
 
-LimitNode::LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_expression)
-    : AbstractLQPNode(LQPNodeType::Limit, {num_rows_expression}) {}
+LimitNode::LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_expression,
+                     const std::shared_ptr<AbstractExpression>& offset_expression)
+    : AbstractLQPNode(LQPNodeType::Limit, {num_rows_expression}) {
+  if (offset_expression) node_expressions.emplace_back(offset_expression);
+}
 
 std::string LimitNode::description() const {
   std::stringstream stream;
   stream << "[Limit] " << num_rows_expression()->as_column_name();
+  if (offset_expression()) stream << " Offset: " << offset_expression()->as_column_name();
   return stream.str();
 }
 
 std::shared_ptr<AbstractExpression> LimitNode::num_rows_expression() const { return node_expressions[0]; }
 
+std::shared_ptr<AbstractExpression> LimitNode::offset_expression() const {
+  return node_expressions.size() > 1 ? node_expressions[1] : nullptr;
+}
+
 std::shared_ptr<AbstractLQPNode> LimitNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  const auto copied_offset_expression =
+      offset_expression() ? expression_copy_and_adapt_to_different_lqp(*offset_expression(), node_mapping) : nullptr;
+  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping),
+                         copied_offset_expression);
 }
 
 bool LimitNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& limit_node = static_cast<const LimitNode&>(rhs);
-  return expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
-                                                         node_mapping);
+  return expressions_equal_to_expressions_in_different_lqp(node_expressions, limit_node.node_expressions,
+                                                           node_mapping);
 }
 
 }  // namespace opossum
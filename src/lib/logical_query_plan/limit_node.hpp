@@ -7,16 +7,21 @@
 namespace opossum {
 
 /**
- * This node type represents limiting a result to a certain number of rows (LIMIT operator).
+ * This node type represents limiting a result to a certain number of rows (LIMIT operator). If an offset expression is
+ * given, that many rows are skipped before the rows are emitted (LIMIT ... OFFSET ...).
  */
 class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode {
  public:
-  explicit LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_expression);
+  explicit LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_expression,
+                     const std::shared_ptr<AbstractExpression>& offset_expression = nullptr);
 
   std::string description() const override;
 
   std::shared_ptr<AbstractExpression> num_rows_expression() const;
 
+  // nullptr if no OFFSET was given
+  std::shared_ptr<AbstractExpression> offset_expression() const;
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
@@ -3,7 +3,9 @@
 #include <boost/hana/for_each.hpp>
 #include <boost/hana/tuple.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -25,6 +27,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
 #include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -34,6 +37,7 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
@@ -41,6 +45,7 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -56,6 +61,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -65,6 +71,7 @@
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
 #include "stored_table_node.hpp"
+#include "top_n_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "validate_node.hpp"
@@ -114,6 +121,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Join:               return _translate_join_node(node);
     case LQPNodeType::Aggregate:          return _translate_aggregate_node(node);
     case LQPNodeType::Limit:              return _translate_limit_node(node);
+    case LQPNodeType::TopN:               return _translate_top_n_node(node);
     case LQPNodeType::Insert:             return _translate_insert_node(node);
     case LQPNodeType::Delete:             return _translate_delete_node(node);
     case LQPNodeType::DummyTable:         return _translate_dummy_table_node(node);
@@ -145,9 +153,15 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+
+  if (predicate_node->scan_type == ScanType::IndexScan) {
+    const auto multi_column_index_scan = _translate_predicate_nodes_to_multi_column_index_scan(predicate_node);
+    if (multi_column_index_scan) return multi_column_index_scan;
+  }
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
-  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
@@ -169,10 +183,6 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto value_variant = AllTypeVariant{NullValue{}};
   auto value2_variant = std::optional<AllTypeVariant>{};
 
-  // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
-  // Our IndexScan implementation does not work on reference segments yet.
-  Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
-
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
@@ -196,7 +206,21 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   std::vector<AllTypeVariant> right_values2 = {};
   if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                                predicate->predicate_condition, right_values, right_values2);
+
+  // For other inputs, e.g., a ValidateNode, the IndexScan uses the indexes of the chunks referenced by the input
+  // chunks and scans input chunks without an index by itself
+  if (node->left_input()->type != LQPNodeType::StoredTable) return index_scan;
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+
+  // The PrimaryKeyIndex covers all chunks of the output of the GetTable (see IndexScanRule)
+  if (predicate->predicate_condition == PredicateCondition::Equals &&
+      stored_table_node->primary_key_column_id() == column_id) {
+    return index_scan;
+  }
+
   const auto table_name = stored_table_node->table_name;
   const auto table = Hyrise::get().storage_manager.get_table(table_name);
   std::vector<ChunkID> indexed_chunks;
@@ -211,9 +235,6 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
-
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
   index_scan->included_chunk_ids = indexed_chunks;
@@ -222,6 +243,93 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_nodes_to_multi_column_index_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  const auto stored_table_node = lqp_find_underlying_stored_table_node(node->left_input());
+  if (!stored_table_node) return nullptr;
+
+  // Gather the values of the consecutive IndexScan PredicateNodes starting at node (see IndexScanRule). Predicate and
+  // Validate nodes keep the column order, so the column ids are those of the stored table.
+  auto values_by_column_id = std::map<ColumnID, AllTypeVariant>{};
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto predicate_node = node;
+  while (true) {
+    const auto operator_predicates =
+        OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+    if (!operator_predicates || operator_predicates->size() != 1) break;
+
+    const auto& operator_predicate = (*operator_predicates)[0];
+    if (operator_predicate.predicate_condition != PredicateCondition::Equals) break;
+    if (!is_variant(operator_predicate.value) || values_by_column_id.count(operator_predicate.column_id)) break;
+
+    values_by_column_id.emplace(operator_predicate.column_id, boost::get<AllTypeVariant>(operator_predicate.value));
+    predicate_nodes.emplace_back(predicate_node);
+
+    const auto& input_node = predicate_node->left_input();
+    if (input_node->type != LQPNodeType::Predicate || input_node->output_count() != 1) break;
+    predicate_node = std::static_pointer_cast<PredicateNode>(input_node);
+    if (predicate_node->scan_type != ScanType::IndexScan) break;
+  }
+
+  if (predicate_nodes.size() < 2) return nullptr;
+
+  // The gathered predicates have to cover exactly the columns of a multi-column index
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& index_statistics : stored_table_node->indexes_statistics()) {
+    if (index_statistics.type != SegmentIndexType::AdaptiveRadixTree) continue;
+    if (index_statistics.column_ids.size() != values_by_column_id.size()) continue;
+
+    const auto covers_index = std::all_of(index_statistics.column_ids.begin(), index_statistics.column_ids.end(),
+                                          [&](const auto column_id) { return values_by_column_id.count(column_id); });
+    if (covers_index) {
+      column_ids = index_statistics.column_ids;
+      break;
+    }
+  }
+  if (column_ids.empty()) return nullptr;
+
+  auto right_values = std::vector<AllTypeVariant>{};
+  for (const auto column_id : column_ids) {
+    right_values.emplace_back(values_by_column_id[column_id]);
+  }
+
+  const auto input_node = predicate_nodes.back()->left_input();
+  const auto input_operator = translate_node(input_node);
+
+  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::AdaptiveRadixTree, column_ids,
+                                                PredicateCondition::Equals, right_values);
+
+  // As for single column index scans, other inputs are handled by the IndexScan itself
+  if (input_node->type != LQPNodeType::StoredTable) return index_scan;
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  std::vector<ChunkID> indexed_chunks;
+
+  const auto chunk_count = table->chunk_count();
+  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk && chunk->get_index(SegmentIndexType::AdaptiveRadixTree, column_ids)) {
+      indexed_chunks.emplace_back(chunk_id);
+    }
+  }
+
+  // All other chunks are handled by a TableScan on the conjunction of the predicates
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& gathered_predicate_node : predicate_nodes) {
+    predicates.emplace_back(gathered_predicate_node->predicate());
+  }
+  const auto table_scan = std::make_shared<TableScan>(
+      input_operator, _translate_expression(inflate_logical_expressions(predicates, LogicalOperator::And), input_node));
+
+  // An IndexScan without included chunks would scan all chunks
+  if (indexed_chunks.empty()) return table_scan;
+
+  index_scan->included_chunk_ids = indexed_chunks;
+  table_scan->excluded_chunk_ids = indexed_chunks;
+
+  return std::make_shared<UnionAll>(index_scan, table_scan);
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input()));
@@ -259,30 +367,28 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   auto input_operator = translate_node(node->left_input());
 
   /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
+   * Go through all the order descriptions and create a single sort operator that sorts by all of them. The first order
+   * description is the primary sort criterion.
    */
+  const auto sort_definitions =
+      _translate_sort_definitions(sort_node->node_expressions, sort_node->order_by_modes, node->left_input());
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
+  return std::make_shared<Sort>(input_operator, sort_definitions);
+}
 
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
-    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
-    Assert(pqp_column_expression,
-           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_top_n_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto top_n_node = std::dynamic_pointer_cast<TopNNode>(node);
+  const auto input_operator = translate_node(node->left_input());
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
-  }
+  const auto sort_definitions =
+      _translate_sort_definitions(top_n_node->sort_expressions(), top_n_node->order_by_modes, node->left_input());
+  const auto row_count_expression = _translate_expression(top_n_node->num_rows_expression(), node->left_input());
+  const auto offset_expression = top_n_node->offset_expression()
+                                     ? _translate_expression(top_n_node->offset_expression(), node->left_input())
+                                     : nullptr;
 
-  return current_pqp;
+  return std::make_shared<TopN>(input_operator, sort_definitions, row_count_expression, offset_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -319,7 +425,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
+  // The IndexJoinRule selects the JoinIndex based on the estimated costs
+  if (join_node->join_type == JoinType::Index) {
+    return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode,
+                                       primary_join_predicate, std::move(secondary_join_predicates),
+                                       join_node->index_side);
+  }
+
+  // Among the remaining join operators, we assume JoinHash is always faster than JoinSortMerge, which is faster than
   // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
       hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
@@ -392,8 +505,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+  const auto offset_expression = limit_node->offset_expression()
+                                     ? _translate_expression(limit_node->offset_expression(), node->left_input())
+                                     : nullptr;
   return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front(),
+      offset_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -407,7 +524,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_delete_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   auto delete_node = std::dynamic_pointer_cast<DeleteNode>(node);
-  return std::make_shared<Delete>(input_operator);
+  return std::make_shared<Delete>(delete_node->table_name, input_operator);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_update_node(
@@ -564,4 +681,25 @@ std::vector<std::shared_ptr<AbstractExpression>> LQPTranslator::_translate_expre
   return pqp_expressions;
 }
 
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
+    const std::vector<OrderByMode>& order_by_modes, const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto& pqp_expressions = _translate_expressions(lqp_expressions, node);
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(pqp_expressions.size());
+
+  auto order_by_mode_iter = order_by_modes.begin();
+  for (const auto& pqp_expression : pqp_expressions) {
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
+    Assert(pqp_column_expression,
+           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+
+    sort_definitions.emplace_back(pqp_column_expression->column_id, *order_by_mode_iter);
+    ++order_by_mode_iter;
+  }
+
+  return sort_definitions;
+}
+
 }  // namespace opossum
@@ -2,10 +2,12 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
 #include "operators/abstract_operator.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
@@ -35,6 +37,10 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  // Translates consecutive IndexScan PredicateNodes that cover the columns of a multi-column index into a single
+  // IndexScan. Returns nullptr if there is no such index.
+  std::shared_ptr<AbstractOperator> _translate_predicate_nodes_to_multi_column_index_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -43,6 +49,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_top_n_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -68,6 +75,11 @@ class LQPTranslator {
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Translate the sort expressions of a SortNode or TopNNode, which must be available as columns of node
+  std::vector<SortColumnDefinition> _translate_sort_definitions(
+      const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
+      const std::vector<OrderByMode>& order_by_modes, const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Cache operator subtrees by LQP node to avoid redundantly executing
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
@@ -7,7 +7,6 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
-#include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
@@ -181,6 +180,15 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+std::shared_ptr<StoredTableNode> lqp_find_underlying_stored_table_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto node = lqp;
+  while (node->type == LQPNodeType::Validate || node->type == LQPNodeType::Predicate) {
+    node = node->left_input();
+  }
+
+  return std::dynamic_pointer_cast<StoredTableNode>(node);
+}
+
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
   std::set<std::string> modified_tables;
 
@@ -192,18 +200,9 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Update:
         modified_tables.insert(std::static_pointer_cast<UpdateNode>(node)->table_name);
         break;
-      case LQPNodeType::Delete: {
-        visit_lqp(node->left_input(), [&](const auto& sub_delete_node) {
-          if (const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(sub_delete_node)) {
-            modified_tables.insert(stored_table_node->table_name);
-          } else if (const auto mock_node = std::dynamic_pointer_cast<MockNode>(sub_delete_node)) {
-            if (mock_node->name) {
-              modified_tables.insert(*mock_node->name);
-            }
-          }
-          return LQPVisitation::VisitInputs;
-        });
-      } break;
+      case LQPNodeType::Delete:
+        modified_tables.insert(std::static_pointer_cast<DeleteNode>(node)->table_name);
+        break;
       case LQPNodeType::CreateTable:
       case LQPNodeType::CreatePreparedPlan:
       case LQPNodeType::DropTable:
@@ -221,6 +220,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Sort:
       case LQPNodeType::StaticTable:
       case LQPNodeType::StoredTable:
+      case LQPNodeType::TopN:
       case LQPNodeType::Union:
       case LQPNodeType::Mock:
         return LQPVisitation::VisitInputs;
@@ -274,6 +274,7 @@ std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression_impl(
     case LQPNodeType::Sort:
     case LQPNodeType::Validate:
     case LQPNodeType::Limit:
+    case LQPNodeType::TopN:
       return lqp_subplan_to_boolean_expression_impl(begin->left_input(), end, subsequent_expression);
 
     default:
@@ -19,6 +19,7 @@
 namespace opossum {
 
 class AbstractExpression;
+class StoredTableNode;
 enum class LQPInputSide;
 
 using LQPMismatch = std::pair<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<const AbstractLQPNode>>;
@@ -57,6 +58,13 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return the StoredTableNode below @param lqp if only Validate and Predicate nodes lie in between, nullptr otherwise.
+ *         In that case, the rows of @param lqp are rows of the stored table that can be located through the indexes
+ *         of its chunks.
+ */
+std::shared_ptr<StoredTableNode> lqp_find_underlying_stored_table_node(const std::shared_ptr<AbstractLQPNode>& lqp);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
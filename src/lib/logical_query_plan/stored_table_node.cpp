@@ -4,6 +4,7 @@
 #include "hyrise.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/index/index_statistics.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -128,6 +129,19 @@ std::vector<IndexStatistics> StoredTableNode::indexes_statistics() const {
   return pruned_indexes_statistics;
 }
 
+std::optional<ColumnID> StoredTableNode::primary_key_column_id() const {
+  DebugAssert(!left_input() && !right_input(), "StoredTableNode must be a leaf");
+
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto primary_key_index = table->primary_key_index();
+  if (!primary_key_index) return std::nullopt;
+
+  if (_pruned_column_ids.empty()) return primary_key_index->column_id();
+
+  const auto column_id_mapping = column_ids_after_pruning(table->column_count(), _pruned_column_ids);
+  return column_id_mapping[primary_key_index->column_id()];
+}
+
 size_t StoredTableNode::_shallow_hash() const {
   size_t hash{0};
   boost::hash_combine(hash, table_name);
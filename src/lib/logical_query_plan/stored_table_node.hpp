@@ -39,6 +39,9 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
   std::vector<IndexStatistics> indexes_statistics() const;
 
+  // ColumnID (after pruning) of the column with a PrimaryKeyIndex, if the stored Table has one and it is not pruned
+  std::optional<ColumnID> primary_key_column_id() const;
+
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
@@ -0,0 +1,79 @@
+#include "top_n_node.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "expression/expression_utils.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TopNNode::TopNNode(const std::vector<std::shared_ptr<AbstractExpression>>& sort_expressions,
+                   const std::vector<OrderByMode>& order_by_modes,
+                   const std::shared_ptr<AbstractExpression>& num_rows_expression,
+                   const std::shared_ptr<AbstractExpression>& offset_expression)
+    : AbstractLQPNode(LQPNodeType::TopN, sort_expressions), order_by_modes(order_by_modes) {
+  Assert(!sort_expressions.empty(), "Expected at least one sort expression");
+  Assert(sort_expressions.size() == order_by_modes.size(), "Expected as many Expressions as OrderByModes");
+
+  node_expressions.emplace_back(num_rows_expression);
+  if (offset_expression) node_expressions.emplace_back(offset_expression);
+}
+
+std::string TopNNode::description() const {
+  std::stringstream stream;
+
+  stream << "[TopN] ";
+
+  for (auto expression_idx = size_t{0}; expression_idx < order_by_modes.size(); ++expression_idx) {
+    stream << node_expressions[expression_idx]->as_column_name() << " ";
+    stream << "(" << order_by_modes[expression_idx] << ")";
+
+    if (expression_idx + 1 < order_by_modes.size()) stream << ", ";
+  }
+
+  stream << " Limit: " << num_rows_expression()->as_column_name();
+  if (offset_expression()) stream << " Offset: " << offset_expression()->as_column_name();
+  return stream.str();
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> TopNNode::sort_expressions() const {
+  return {node_expressions.begin(), node_expressions.begin() + order_by_modes.size()};
+}
+
+std::shared_ptr<AbstractExpression> TopNNode::num_rows_expression() const {
+  return node_expressions[order_by_modes.size()];
+}
+
+std::shared_ptr<AbstractExpression> TopNNode::offset_expression() const {
+  return node_expressions.size() > order_by_modes.size() + 1 ? node_expressions[order_by_modes.size() + 1] : nullptr;
+}
+
+size_t TopNNode::_shallow_hash() const {
+  size_t hash{0};
+  for (const auto& order_by_mode : order_by_modes) {
+    boost::hash_combine(hash, order_by_mode);
+  }
+  return hash;
+}
+
+std::shared_ptr<AbstractLQPNode> TopNNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  const auto copied_offset_expression =
+      offset_expression() ? expression_copy_and_adapt_to_different_lqp(*offset_expression(), node_mapping) : nullptr;
+  return TopNNode::make(expressions_copy_and_adapt_to_different_lqp(sort_expressions(), node_mapping), order_by_modes,
+                        expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping),
+                        copied_offset_expression);
+}
+
+bool TopNNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& top_n_node = static_cast<const TopNNode&>(rhs);
+
+  return expressions_equal_to_expressions_in_different_lqp(node_expressions, top_n_node.node_expressions,
+                                                           node_mapping) &&
+         order_by_modes == top_n_node.order_by_modes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents a Sort that is directly followed by a Limit (ORDER BY ... LIMIT n [OFFSET m]). Only the
+ * first n + m rows in sort order are needed, so there is no need to sort the entire input. TopNNodes are not created
+ * by the SQLTranslator, but by the TopNRule, which fuses SortNodes and LimitNodes.
+ *
+ * The node_expressions are the sort expressions, followed by the number of rows and (optionally) the offset.
+ */
+class TopNNode : public EnableMakeForLQPNode<TopNNode>, public AbstractLQPNode {
+ public:
+  TopNNode(const std::vector<std::shared_ptr<AbstractExpression>>& sort_expressions,
+           const std::vector<OrderByMode>& order_by_modes,
+           const std::shared_ptr<AbstractExpression>& num_rows_expression,
+           const std::shared_ptr<AbstractExpression>& offset_expression = nullptr);
+
+  std::string description() const override;
+
+  std::vector<std::shared_ptr<AbstractExpression>> sort_expressions() const;
+  std::shared_ptr<AbstractExpression> num_rows_expression() const;
+
+  // nullptr if no OFFSET was given
+  std::shared_ptr<AbstractExpression> offset_expression() const;
+
+  const std::vector<OrderByMode> order_by_modes;
+
+ protected:
+  size_t _shallow_hash() const override;
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -27,6 +27,7 @@ enum class OperatorType {
   ImportCsv,
   IndexScan,
   Insert,
+  Intersect,
   JoinHash,
   JoinIndex,
   JoinNestedLoop,
@@ -39,6 +40,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopN,
   UnionAll,
   UnionPositions,
   Update,
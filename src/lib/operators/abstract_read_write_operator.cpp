@@ -51,12 +51,20 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::write_log_records(LogEntryWriter& log_entry) const {
+  Assert(_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be logged.");
+
+  _on_write_log_records(log_entry);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::RolledBack;
 }
 
 ReadWriteOperatorState AbstractReadWriteOperator::state() const { return _state; }
 
+void AbstractReadWriteOperator::_on_write_log_records(LogEntryWriter& log_entry) const {}
+
 void AbstractReadWriteOperator::_mark_as_failed() {
   Assert(_state == ReadWriteOperatorState::Pending, "Operator can only be marked as failed if pending.");
 
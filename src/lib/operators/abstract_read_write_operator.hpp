@@ -7,6 +7,7 @@
 #include "abstract_operator.hpp"
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/log_entry.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
@@ -46,6 +47,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Serializes the modifications of the operator into the write-ahead log entry of its transaction (see Logger).
+   * Called when the transaction commits, before commit_records.
+   */
+  void write_log_records(LogEntryWriter& log_entry) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -78,6 +85,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by write_log_records. Operators that only modify tables through other operators (e.g., Update if it uses
+   * Delete and Insert) do not write any records themselves.
+   */
+  virtual void _on_write_log_records(LogEntryWriter& log_entry) const;
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
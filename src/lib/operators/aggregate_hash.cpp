@@ -18,6 +18,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
@@ -49,6 +50,111 @@ typename Results::reference get_or_add_result(ResultIds& result_ids, Results& re
 
   return results[result_id];
 }
+
+// Calls functor with the given AggregateFunction as an std::integral_constant, so that it can be used as a template
+// argument
+template <typename Functor>
+void resolve_aggregate_function(const AggregateFunction function, const Functor& functor) {
+  switch (function) {
+    case AggregateFunction::Min:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+      break;
+    case AggregateFunction::Max:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+      break;
+    case AggregateFunction::Sum:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+      break;
+    case AggregateFunction::Avg:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+      break;
+    case AggregateFunction::Count:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+      break;
+    case AggregateFunction::CountDistinct:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+      break;
+    case AggregateFunction::StandardDeviationSample:
+      functor(std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+      break;
+  }
+}
+
+// Updates the result of a group with a (non-NULL) value of that group
+template <AggregateFunction function, typename Aggregator, typename ColumnDataType, typename Result>
+void add_value_to_result(const Aggregator& aggregator, const ColumnDataType& value, Result& result) {
+  // Use the aggregator lambda to update the current aggregate value for this group
+  aggregator(value, result.current_primary_aggregate, result.current_secondary_aggregates);
+
+  // increase value counter
+  ++result.aggregate_count;
+
+  if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+    // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
+    // for the case of CountDistinct, insert this value into the set to keep track of distinct values
+    result.distinct_values.insert(value);
+  }
+}
+
+// Merges the partial result of a group (source) into another partial result of the same group (target). Both results
+// have been computed on disjoint sets of rows.
+template <AggregateFunction function, typename Result>
+void merge_results(Result& target, const Result& source) {
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+    if (source.current_primary_aggregate) {
+      if (!target.current_primary_aggregate ||
+          (function == AggregateFunction::Min
+               ? value_smaller(*source.current_primary_aggregate, *target.current_primary_aggregate)
+               : value_greater(*source.current_primary_aggregate, *target.current_primary_aggregate))) {
+        target.current_primary_aggregate = source.current_primary_aggregate;
+      }
+    }
+  } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+    if (source.current_primary_aggregate) {
+      if (target.current_primary_aggregate) {
+        *target.current_primary_aggregate += *source.current_primary_aggregate;
+      } else {
+        target.current_primary_aggregate = source.current_primary_aggregate;
+      }
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct) {
+    target.distinct_values.insert(source.distinct_values.begin(), source.distinct_values.end());
+  } else if constexpr (function == AggregateFunction::StandardDeviationSample) {
+    using AggregateType = typename decltype(target.current_primary_aggregate)::value_type;
+    if constexpr (std::is_arithmetic_v<AggregateType>) {
+      // Combine the counts, means, and sums of squared differences (see AggregateFunctionBuilder) of both results as
+      // described by Chan et al., "Updating Formulae and a Pairwise Algorithm for Computing Sample Variances", 1979.
+      auto& target_secondary = target.current_secondary_aggregates;
+      const auto& source_secondary = source.current_secondary_aggregates;
+      if (source_secondary.empty()) {
+        // Nothing to merge
+      } else if (target_secondary.empty()) {
+        target_secondary = source_secondary;
+        target.current_primary_aggregate = source.current_primary_aggregate;
+      } else {
+        const auto target_count = target_secondary[0];
+        const auto source_count = source_secondary[0];
+        const auto count = target_count + source_count;
+        const auto delta = source_secondary[1] - target_secondary[1];
+
+        target_secondary[0] = count;
+        target_secondary[1] = target_secondary[1] + delta * source_count / count;
+        target_secondary[2] = target_secondary[2] + source_secondary[2] +
+                              delta * delta * target_count * source_count / count;
+
+        if (count > 1) {
+          target.current_primary_aggregate = std::sqrt(target_secondary[2] / (count - 1));
+        } else {
+          target.current_primary_aggregate = std::nullopt;
+        }
+      }
+    } else {
+      Fail("StandardDeviationSample not available for non-arithmetic types.");
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+}
 }  // namespace
 
 namespace opossum {
@@ -98,15 +204,95 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, Aggregat
   std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
 };
 
+/*
+Thread-local state of one task of the parallel aggregation, see AggregateHash::_aggregate(). The groups and rows are
+assigned to radix partitions by the hash of their AggregateKey.
+*/
+template <typename AggregateKey>
+struct PartialAggregation {
+  // Pre-aggregated groups, one context per aggregate column
+  std::vector<std::shared_ptr<SegmentVisitorContext>> contexts;
+
+  // The pre-aggregated groups of each partition, given as their key and the index of their result in contexts. As all
+  // contexts are filled in the same order, the index is the same for all contexts.
+  std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>> groups_per_partition;
+
+  // The rows of each partition that have not been pre-aggregated
+  std::vector<PosList> rows_per_partition;
+};
+
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts() const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (_aggregates.empty()) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, _contexts_per_column will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+
+    We choose int8_t for column type and aggregate type because it's small.
+    */
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
+   * and _write_aggregate_output() needs these contexts anyway.
+   */
+  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
+    const auto& aggregate = _aggregates[column_id];
+    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
+      contexts[column_id] = context;
+      continue;
+    }
+    auto data_type = input_table_left()->column_data_type(*aggregate.column);
+    contexts[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+  }
+
+  return contexts;
+}
+
+template <typename Functor>
+void AggregateHash::_resolve_context_types(const ColumnID column_index, const Functor& functor) const {
+  // The special DISTINCT and COUNT(*) contexts do not hold any aggregate values. Count is used as their function, as
+  // it only relies on the aggregate_count.
+  constexpr auto count_function = std::integral_constant<AggregateFunction, AggregateFunction::Count>{};
+
+  if (_aggregates.empty()) {
+    functor(hana::type_c<DistinctColumnType>, hana::type_c<DistinctAggregateType>, count_function);
+    return;
+  }
+
+  const auto& aggregate = _aggregates[column_index];
+  if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+    functor(hana::type_c<CountColumnType>, hana::type_c<CountAggregateType>, count_function);
+    return;
+  }
+
+  resolve_data_type(input_table_left()->column_data_type(*aggregate.column), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    resolve_aggregate_function(aggregate.function, [&](auto function_t) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function_t)::value>::AggregateType;
+      functor(type, hana::type_c<AggregateType>, function_t);
+    });
+  });
+}
+
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                       const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                       const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                       std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& context =
+      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -120,23 +306,279 @@ void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
     * If the value is NULL, the current aggregate value does not change.
     */
     if (!position.is_null()) {
-      // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-      aggregator(position.value(), result.current_primary_aggregate, result.current_secondary_aggregates);
+      add_value_to_result<function>(aggregator, position.value(), result);
+    }
+
+    ++chunk_offset;
+  });
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const {
+  const auto chunk_in = input_table_left()->get_chunk(chunk_id);
+  if (!chunk_in) return;
 
-      // increase value counter
-      ++result.aggregate_count;
+  const auto& hash_keys = keys_per_chunk[chunk_id];
 
-      if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
-        // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
-        // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-        result.distinct_values.insert(position.value());
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
+
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys in the 'column_results' map.
+     *
+     * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
+     * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+        contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+      // Make sure the value or combination of values is added to the list of distinct value(s)
+      get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
+    }
+    return;
+  }
+
+  ColumnID column_index{0};
+  for (const auto& aggregate : _aggregates) {
+    /**
+     * Special COUNT(*) implementation.
+     * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+     * We then go through the keys_per_chunk map and count the occurrences of each group key.
+     * The results are saved in the regular aggregate_count variable so that we don't need a
+     * specific output logic for COUNT(*).
+     */
+    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+      auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+          contexts[column_index]);
+
+      auto& result_ids = *context->result_ids;
+      auto& results = context->results;
+
+      // count occurrences for each group key
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        auto& result = get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
+        ++result.aggregate_count;
       }
+
+      ++column_index;
+      continue;
     }
 
-    ++chunk_offset;
+    auto base_segment = chunk_in->get_segment(*aggregate.column);
+    auto data_type = input_table_left()->column_data_type(*aggregate.column);
+
+    /*
+    Invoke correct aggregator for each segment
+    */
+
+    resolve_data_type(data_type, [&, aggregate](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      resolve_aggregate_function(aggregate.function, [&](auto function_t) {
+        _aggregate_segment<ColumnDataType, decltype(function_t)::value, AggregateKey>(
+            chunk_id, column_index, *base_segment, keys_per_chunk, contexts);
+      });
+    });
+
+    ++column_index;
+  }
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_rows(const PosList& rows, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                    std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const {
+  if (rows.empty()) return;
+
+  if (_aggregates.empty()) {
+    // DISTINCT implementation, see _aggregate_chunk()
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+        contexts[0]);
+
+    for (const auto& row_id : rows) {
+      get_or_add_result(*context->result_ids, context->results, keys_per_chunk[row_id.chunk_id][row_id.chunk_offset],
+                        row_id);
+    }
+    return;
+  }
+
+  ColumnID column_index{0};
+  for (const auto& aggregate : _aggregates) {
+    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+      // COUNT(*) implementation, see _aggregate_chunk()
+      auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+          contexts[column_index]);
+
+      for (const auto& row_id : rows) {
+        auto& result = get_or_add_result(*context->result_ids, context->results,
+                                         keys_per_chunk[row_id.chunk_id][row_id.chunk_offset], row_id);
+        ++result.aggregate_count;
+      }
+
+      ++column_index;
+      continue;
+    }
+
+    resolve_data_type(input_table_left()->column_data_type(*aggregate.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      resolve_aggregate_function(aggregate.function, [&](auto function_t) {
+        _aggregate_column_rows<ColumnDataType, decltype(function_t)::value, AggregateKey>(column_index, rows,
+                                                                                         keys_per_chunk, contexts);
+      });
+    });
+
+    ++column_index;
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
+void AggregateHash::_aggregate_column_rows(const ColumnID column_index, const PosList& rows,
+                                           const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                           std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const {
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+
+  auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+
+  auto& context =
+      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(contexts[column_index]);
+
+  const auto& input_table = input_table_left();
+  const auto column_id = *_aggregates[column_index].column;
+
+  // The rows are not sorted by chunk, so we create an accessor for each chunk when it is first needed
+  auto accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+
+  for (const auto& row_id : rows) {
+    auto& result = get_or_add_result(*context.result_ids, context.results,
+                                     keys_per_chunk[row_id.chunk_id][row_id.chunk_offset], row_id);
+
+    auto& accessor = accessors[row_id.chunk_id];
+    if (!accessor) {
+      const auto& segment = input_table->get_chunk(row_id.chunk_id)->get_segment(column_id);
+      accessor = create_segment_accessor<ColumnDataType>(segment);
+    }
+
+    const auto value = accessor->access(row_id.chunk_offset);
+    if (value) {
+      add_value_to_result<function>(aggregator, *value, result);
+    }
+  }
+}
+
+template <typename AggregateKey>
+void AggregateHash::_pre_aggregate(const ChunkID chunk_begin, const ChunkID chunk_end,
+                                   const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                   PartialAggregation<AggregateKey>& partial_aggregation) const {
+  const auto& input_table = input_table_left();
+  const auto partition_mask = partial_aggregation.rows_per_partition.size() - 1;
+  auto& contexts = partial_aggregation.contexts;
+
+  auto pre_aggregate = true;
+  auto pre_aggregated_row_count = size_t{0};
+
+  for (auto chunk_id = chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    if (pre_aggregate) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, contexts);
+      pre_aggregated_row_count += chunk->size();
+
+      // Pre-aggregation only pays off if it notably reduces the number of groups that have to be merged later. If most
+      // rows form their own group, we stop pre-aggregating and leave the remaining rows to the merge phase.
+      auto group_count = size_t{0};
+      _resolve_context_types(ColumnID{0}, [&](auto column_data_type_t, auto aggregate_type_t, auto) {
+        using ColumnDataType = typename decltype(column_data_type_t)::type;
+        using AggregateType = typename decltype(aggregate_type_t)::type;
+        group_count = std::static_pointer_cast<AggregateResultContext<ColumnDataType, AggregateType>>(contexts[0])
+                          ->results.size();
+      });
+      pre_aggregate = static_cast<double>(group_count) <=
+                      static_cast<double>(pre_aggregated_row_count) * MAX_PRE_AGGREGATION_GROUP_RATIO;
+      continue;
+    }
+
+    const auto& hash_keys = keys_per_chunk[chunk_id];
+    const auto input_chunk_size = chunk->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+      const auto partition_id = std::hash<AggregateKey>{}(hash_keys[chunk_offset]) & partition_mask;
+      partial_aggregation.rows_per_partition[partition_id].emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  // Assign the pre-aggregated groups to their partitions. As the result ids are the same for all contexts, looking at
+  // the first context is sufficient.
+  _resolve_context_types(ColumnID{0}, [&](auto column_data_type_t, auto aggregate_type_t, auto) {
+    using ColumnDataType = typename decltype(column_data_type_t)::type;
+    using AggregateType = typename decltype(aggregate_type_t)::type;
+    const auto& context =
+        *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(contexts[0]);
+
+    for (const auto& [key, result_id] : *context.result_ids) {
+      const auto partition_id = std::hash<AggregateKey>{}(key) & partition_mask;
+      partial_aggregation.groups_per_partition[partition_id].emplace_back(key, result_id);
+    }
   });
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_merge_partition(
+    const size_t partition_id, const std::vector<PartialAggregation<AggregateKey>>& partial_aggregations,
+    const KeysPerChunk<AggregateKey>& keys_per_chunk) const {
+  auto contexts = _create_aggregate_contexts<AggregateKey>();
+
+  // Merge the pre-aggregated groups of all tasks. Every context is filled in the same order so that the results of the
+  // different aggregate columns stay aligned.
+  for (auto column_index = ColumnID{0}; column_index < contexts.size(); ++column_index) {
+    _resolve_context_types(column_index, [&](auto column_data_type_t, auto aggregate_type_t, auto function_t) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+      using AggregateType = typename decltype(aggregate_type_t)::type;
+      using Context = AggregateContext<ColumnDataType, AggregateType, AggregateKey>;
+
+      auto& context = *std::static_pointer_cast<Context>(contexts[column_index]);
+
+      for (const auto& partial_aggregation : partial_aggregations) {
+        const auto& partial_results =
+            std::static_pointer_cast<Context>(partial_aggregation.contexts[column_index])->results;
+
+        for (const auto& [key, result_id] : partial_aggregation.groups_per_partition[partition_id]) {
+          const auto& partial_result = partial_results[result_id];
+          auto& result = get_or_add_result(*context.result_ids, context.results, key, partial_result.row_id);
+          merge_results<decltype(function_t)::value>(result, partial_result);
+        }
+      }
+    });
+  }
+
+  // Aggregate the rows that have not been pre-aggregated
+  for (const auto& partial_aggregation : partial_aggregations) {
+    _aggregate_rows<AggregateKey>(partial_aggregation.rows_per_partition[partition_id], keys_per_chunk, contexts);
+  }
+
+  return contexts;
+}
+
 template <typename AggregateKey>
 void AggregateHash::_aggregate() {
   // We use monotonic_buffer_resource for the vector of vectors that hold the aggregate keys. That is so that we can
@@ -275,155 +717,79 @@ void AggregateHash::_aggregate() {
 
   /*
   AGGREGATION PHASE
+  If the input is large enough, the aggregation is parallelized in two phases:
+  1. Pre-aggregation: The chunks are split into contiguous ranges, one per task. Each task aggregates its range into
+     its own, thread-local contexts. If a task notices that pre-aggregation hardly reduces the number of groups (i.e.,
+     there are many distinct groups), it stops pre-aggregating and only assigns the remaining rows of its range to
+     partitions (see _pre_aggregate()).
+  2. Merge: Groups and rows are radix-partitioned by the hash of their AggregateKey. As every group belongs to exactly
+     one partition, the partitions are merged independently of each other (see _merge_partition()).
+  Finally, the results of all partitions are concatenated. The order of the groups in the output is not defined.
   */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
-
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
-  }
+  const auto chunk_count = input_table->chunk_count();
+  const auto task_count =
+      std::max(size_t{1}, std::min({Hyrise::get().topology.num_cpus(), static_cast<size_t>(chunk_count),
+                                    input_table->row_count() / MIN_ROWS_PER_TASK}));
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
-    const auto& aggregate = _aggregates[column_id];
-    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[column_id] = context;
-      continue;
+  if (task_count == 1) {
+    // Not worth the overhead of merging thread-local results - aggregate directly into the final contexts
+    _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, _contexts_per_column);
     }
-    auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+    return;
   }
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) continue;
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
+  // The radix partitioning uses the lowest bits of the hash, so the number of partitions needs to be a power of two
+  auto partition_count = size_t{1};
+  while (partition_count < task_count) partition_count <<= 1;
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
+  auto partial_aggregations = std::vector<PartialAggregation<AggregateKey>>(task_count);
+  jobs.clear();
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    auto& partial_aggregation = partial_aggregations[task_id];
+    partial_aggregation.contexts = _create_aggregate_contexts<AggregateKey>();
+    partial_aggregation.groups_per_partition.resize(partition_count);
+    partial_aggregation.rows_per_partition.resize(partition_count);
 
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-            auto& result =
-                get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-            ++result.aggregate_count;
-          }
-
-          ++column_index;
-          continue;
-        }
+    const auto chunk_begin = ChunkID{static_cast<ChunkID::base_type>(task_id * chunk_count / task_count)};
+    const auto chunk_end = ChunkID{static_cast<ChunkID::base_type>((task_id + 1) * chunk_count / task_count)};
 
-        auto base_segment = chunk_in->get_segment(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_begin, chunk_end]() {
+      _pre_aggregate<AggregateKey>(chunk_begin, chunk_end, keys_per_chunk, partial_aggregation);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  auto contexts_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      contexts_per_partition[partition_id] =
+          _merge_partition<AggregateKey>(partition_id, partial_aggregations, keys_per_chunk);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
-              break;
-          }
-        });
-
-        ++column_index;
+  // Concatenate the results of all partitions. _write_aggregate_output() only needs the results, not the result ids.
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+  for (auto column_index = ColumnID{0}; column_index < _contexts_per_column.size(); ++column_index) {
+    _resolve_context_types(column_index, [&](auto column_data_type_t, auto aggregate_type_t, auto) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+      using AggregateType = typename decltype(aggregate_type_t)::type;
+      using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+      auto& results = std::static_pointer_cast<Context>(_contexts_per_column[column_index])->results;
+      for (const auto& partition_contexts : contexts_per_partition) {
+        auto& partition_results = std::static_pointer_cast<Context>(partition_contexts[column_index])->results;
+        results.insert(results.end(), std::make_move_iterator(partition_results.begin()),
+                       std::make_move_iterator(partition_results.end()));
       }
-    }
+    });
   }
 }
 
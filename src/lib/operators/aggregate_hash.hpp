@@ -29,6 +29,9 @@ namespace opossum {
 template <typename AggregateKey>
 struct GroupByContext;
 
+template <typename AggregateKey>
+struct PartialAggregation;
+
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, count and stddev_samp. The output is a table
  with value segments. As with most operators we do not guarantee a stable operation with regards to positions -
@@ -121,13 +124,57 @@ class AggregateHash : public AbstractAggregateOperator {
 
   void _write_groupby_output(PosList& pos_list);
 
+  template <typename AggregateKey>
+  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
+                                                                   const AggregateFunction function) const;
+
+  // Creates one (empty) context per aggregate column, or the dummy context used for DISTINCT
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts() const;
+
+  // Calls functor with the ColumnDataType, the AggregateType (both as hana types), and the AggregateFunction (as an
+  // std::integral_constant) of the context of the given aggregate column
+  template <typename Functor>
+  void _resolve_context_types(const ColumnID column_index, const Functor& functor) const;
+
+  // Aggregates all rows of a chunk into contexts
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const;
+
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const;
 
+  // Aggregates the given rows (which can belong to different chunks) into contexts
   template <typename AggregateKey>
-  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+  void _aggregate_rows(const PosList& rows, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                       std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const;
+
+  template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
+  void _aggregate_column_rows(const ColumnID column_index, const PosList& rows,
+                              const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                              std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const;
+
+  // First phase of the parallel aggregation, see _aggregate()
+  template <typename AggregateKey>
+  void _pre_aggregate(const ChunkID chunk_begin, const ChunkID chunk_end,
+                      const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                      PartialAggregation<AggregateKey>& partial_aggregation) const;
+
+  // Second phase of the parallel aggregation, see _aggregate()
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _merge_partition(
+      const size_t partition_id, const std::vector<PartialAggregation<AggregateKey>>& partial_aggregations,
+      const KeysPerChunk<AggregateKey>& keys_per_chunk) const;
+
+  // The aggregation phase is only parallelized if each task has at least this many rows to aggregate
+  static constexpr auto MIN_ROWS_PER_TASK = size_t{10'000};
+
+  // If a task has produced more groups than this fraction of the rows it has pre-aggregated, pre-aggregation is
+  // considered ineffective and the task falls back to partitioning the remaining rows
+  static constexpr auto MAX_PRE_AGGREGATION_GROUP_RATIO = 0.5;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
@@ -2,8 +2,12 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
@@ -11,8 +15,10 @@
 
 namespace opossum {
 
-Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
-    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op}, _transaction_id{0} {}
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op)
+    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op},
+      _table_name{table_name},
+      _transaction_id{0} {}
 
 const std::string& Delete::name() const {
   static const auto name = std::string{"Delete"};
@@ -28,6 +34,12 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
   _transaction_id = context->transaction_id();
 
+  // The log refers to rows by their position in the stored table. Resolving the positions here keeps the lookup out
+  // of the commit.
+  if (Hyrise::get().logger()) {
+    _stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+  }
+
   for (ChunkID chunk_id{0}; chunk_id < _referencing_table->chunk_count(); ++chunk_id) {
     const auto chunk = _referencing_table->get_chunk(chunk_id);
 
@@ -37,6 +49,8 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
     const auto pos_list = first_segment->pos_list();
 
+    if (_stored_table && !pos_list->empty()) _resolve_stored_chunk_ids(*first_segment->referenced_table());
+
     DebugAssert(std::all_of(chunk->segments().begin(), chunk->segments().end(),
                             [&](const auto& segment) {
                               const auto segment_pos_list =
@@ -61,6 +75,10 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
                                      mvcc_data->end_cids[row_id.chunk_offset]),
             "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
 
+        // Announce the delete before the row is locked, so that Validate no longer considers all rows of the chunk
+        // visible to this transaction
+        mvcc_data->register_delete();
+
         // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
         auto expected = 0u;
         const auto success = mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
@@ -78,6 +96,12 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
             _mark_as_failed();
             return nullptr;
           }
+        } else if (mvcc_data->column_versions.is_locked_by_other(row_id.chunk_offset, _transaction_id) ||
+                   mvcc_data->column_versions.committed_after(row_id.chunk_offset, context->snapshot_commit_id())) {
+          // The row is being updated in place by another transaction or was updated by a transaction that committed
+          // after our snapshot (see ColumnVersionStore). The lock is released by the rollback.
+          _mark_as_failed();
+          return nullptr;
         }
       }
     }
@@ -97,7 +121,9 @@ void Delete::_on_commit_records(const CommitID cid) {
     for (const auto& row_id : *referencing_segment->pos_list()) {
       const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-      referenced_chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = cid;
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      mvcc_data->end_cids[row_id.chunk_offset] = cid;
+      mvcc_data->register_delete_commit(1, cid);
       referenced_chunk->increase_invalid_row_count(1);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
@@ -130,10 +156,50 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_resolve_stored_chunk_ids(const Table& referenced_table) const {
+  // The input might reference a table created by GetTable (e.g., with pruned chunks or columns), whose chunks share
+  // their MvccData with the stored chunks
+  if (&referenced_table == _stored_table.get() || !_stored_chunk_ids.empty()) return;
+
+  for (auto stored_chunk_id = ChunkID{0}; stored_chunk_id < _stored_table->chunk_count(); ++stored_chunk_id) {
+    const auto stored_chunk = _stored_table->get_chunk(stored_chunk_id);
+    if (stored_chunk) _stored_chunk_ids.emplace(stored_chunk->mvcc_data().get(), stored_chunk_id);
+  }
+}
+
+void Delete::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // The logger might have been set after the Delete was executed. The positions are resolved now in that case.
+  if (!_stored_table) _stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    const auto referenced_table = referencing_segment->referenced_table();
+    const auto& pos_list = *referencing_segment->pos_list();
+    if (pos_list.empty()) continue;
+    _resolve_stored_chunk_ids(*referenced_table);
+
+    log_entry.write(LogRecordType::Delete);
+    log_entry.write(_table_name);
+    log_entry.write(static_cast<uint32_t>(pos_list.size()));
+    for (const auto& row_id : pos_list) {
+      if (referenced_table == _stored_table) {
+        log_entry.write(row_id.chunk_id);
+      } else {
+        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+        log_entry.write(_stored_chunk_ids.at(referenced_chunk->mvcc_data().get()));
+      }
+      log_entry.write(row_id.chunk_offset);
+    }
+  }
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Delete>(copied_input_left);
+  return std::make_shared<Delete>(_table_name, copied_input_left);
 }
 
 void Delete::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
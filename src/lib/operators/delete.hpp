@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
@@ -16,7 +17,7 @@ namespace opossum {
  */
 class Delete : public AbstractReadWriteOperator {
  public:
-  explicit Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op);
+  Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op);
 
   const std::string& name() const override;
 
@@ -28,9 +29,18 @@ class Delete : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
 
  private:
+  // Maps the chunks referenced by the input to the chunks of the stored table, which the log refers to
+  void _resolve_stored_chunk_ids(const Table& referenced_table) const;
+
+  const std::string _table_name;
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+
+  // Set on execution if a logger is set, otherwise when the log records are written, see _on_write_log_records()
+  mutable std::shared_ptr<const Table> _stored_table;
+  mutable std::unordered_map<const MvccData*, ChunkID> _stored_chunk_ids;
 };
 }  // namespace opossum
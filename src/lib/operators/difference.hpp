@@ -1,25 +1,30 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
-#include <vector>
+#include <unordered_map>
 
 #include "abstract_read_only_operator.hpp"
 #include "types.hpp"
-#include "utils/assert.hpp"
 
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Emits the rows of the left input that have no equal row in the right input (see SetOperationMode for how duplicates
+ * are handled). Both inputs need to have the same column definitions. NULL values are considered equal to each other.
+ *
+ * The rows are materialized and hashed chunk by chunk in parallel, see RowKeyStore.
  */
 class Difference : public AbstractReadOnlyOperator {
  public:
   Difference(const std::shared_ptr<const AbstractOperator>& left_in,
-             const std::shared_ptr<const AbstractOperator>& right_in);
+             const std::shared_ptr<const AbstractOperator>& right_in,
+             const SetOperationMode mode = SetOperationMode::Any);
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationMode mode() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -29,6 +34,6 @@ class Difference : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
  private:
-  static void _append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value);
+  const SetOperationMode _mode;
 };
 }  // namespace opossum
@@ -2,12 +2,16 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "hyrise.hpp"
+#include "storage/column_version_store.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -84,6 +88,8 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   }
 
   auto excluded_chunk_ids = std::vector<ChunkID>{};
+  auto versions_by_chunk_id = std::unordered_map<ChunkID, std::vector<ColumnVersionStore::Version>>{};
+  auto globally_visible_commit_id = std::optional<CommitID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < stored_table->chunk_count(); ++stored_chunk_id) {
     // Check whether the Chunk is pruned
@@ -100,14 +106,33 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       if (!chunk || (chunk->get_cleanup_commit_id() &&
                      *chunk->get_cleanup_commit_id() <= transaction_context()->snapshot_commit_id())) {
         excluded_chunk_ids.emplace_back(stored_chunk_id);
+        continue;
+      }
+
+      // Collect the values written by Update that are visible to the transaction (see ColumnVersionStore). Versions
+      // that are visible to all transactions are installed first if no Insert writes to the chunk anymore, so that they
+      // do not have to be applied anymore. The versions have to be collected before the segments are read, as
+      // versions might be installed concurrently.
+      const auto mvcc_data = chunk->mvcc_data();
+      if (mvcc_data && !mvcc_data->column_versions.empty()) {
+        if (!chunk->is_mutable() && mvcc_data->pending_insert_count() == 0) {
+          if (!globally_visible_commit_id) {
+            globally_visible_commit_id = Hyrise::get().transaction_manager.get_globally_visible_commit_id();
+          }
+          mvcc_data->column_versions.install(*chunk, *globally_visible_commit_id);
+        }
+
+        auto versions = mvcc_data->column_versions.visible_versions(transaction_context()->transaction_id(),
+                                                                    transaction_context()->snapshot_commit_id());
+        if (!versions.empty()) versions_by_chunk_id.emplace(stored_chunk_id, std::move(versions));
       }
     }
   }
 
   /**
-   * Early out if no exclusion of Chunks or Columns is necessary
+   * Early out if no exclusion of Chunks or Columns and no versions of values are necessary
    */
-  if (excluded_chunk_ids.empty() && _pruned_column_ids.empty()) {
+  if (excluded_chunk_ids.empty() && _pruned_column_ids.empty() && versions_by_chunk_id.empty()) {
     return stored_table;
   }
 
@@ -141,13 +166,17 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   }
 
   /**
-   * Build the output Table, omitting pruned Chunks and Columns as well as deleted Chunks
+   * Build the output Table, omitting pruned Chunks and Columns as well as deleted Chunks, and applying column versions
    */
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{stored_table->chunk_count() - excluded_chunk_ids.size()};
   auto output_chunks_iter = output_chunks.begin();
 
   auto excluded_chunk_ids_iter = excluded_chunk_ids.begin();
 
+  // ChunkIDs of the output Table by ChunkID of the stored Table, used to share the PrimaryKeyIndex
+  const auto stored_primary_key_index = stored_table->primary_key_index();
+  auto output_chunk_ids = std::vector<ChunkID>{};
+
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < stored_table->chunk_count(); ++stored_chunk_id) {
     // Skip `stored_chunk_id` if it is in the sorted vector `excluded_chunk_ids`
     if (excluded_chunk_ids_iter != excluded_chunk_ids.end() && *excluded_chunk_ids_iter == stored_chunk_id) {
@@ -155,6 +184,12 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       continue;
     }
 
+    if (stored_primary_key_index) {
+      output_chunk_ids.resize(stored_chunk_id + 1, INVALID_CHUNK_ID);
+      output_chunk_ids[stored_chunk_id] =
+          static_cast<ChunkID>(std::distance(output_chunks.begin(), output_chunks_iter));
+    }
+
     // The Chunk is to be included in the output Table, now we progress to excluding Columns
     const auto stored_chunk = stored_table->get_chunk(stored_chunk_id);
 
@@ -163,13 +198,26 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     const auto& current_chunk_order = stored_chunk->ordered_by();
     std::optional<std::pair<ColumnID, OrderByMode>> adapted_chunk_order;
 
-    if (_pruned_column_ids.empty()) {
+    const auto versions_iter = versions_by_chunk_id.find(stored_chunk_id);
+    const auto* versions = versions_iter != versions_by_chunk_id.end() ? &versions_iter->second : nullptr;
+
+    if (_pruned_column_ids.empty() && !versions) {
       *output_chunks_iter = stored_chunk;
     } else {
       auto output_segments = Segments{stored_table->column_count() - _pruned_column_ids.size()};
       auto output_segments_iter = output_segments.begin();
       auto output_indexes = Indexes{};
 
+      // The pruning statistics and zone maps of the stored chunk are kept for the output columns that are not copied
+      // because of versions. The TableScan uses them to skip chunks and blocks.
+      const auto stored_pruning_statistics = stored_chunk->pruning_statistics();
+      auto output_pruning_statistics = std::optional<ChunkPruningStatistics>{};
+      if (stored_pruning_statistics) output_pruning_statistics.emplace();
+
+      const auto stored_zone_maps = stored_chunk->zone_maps();
+      auto output_zone_maps = std::optional<ChunkZoneMaps>{};
+      if (stored_zone_maps) output_zone_maps.emplace();
+
       auto pruned_column_ids_iter = _pruned_column_ids.begin();
       for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
         // Skip `stored_column_id` if it is in the sorted vector `_pruned_column_ids`
@@ -184,10 +232,26 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
               current_chunk_order->second};
         }
 
-        *output_segments_iter = stored_chunk->get_segment(stored_column_id);
-        auto indexes = stored_chunk->get_indexes({*output_segments_iter});
-        if (!indexes.empty()) {
-          output_indexes.insert(std::end(output_indexes), std::begin(indexes), std::end(indexes));
+        const auto& stored_segment = stored_chunk->get_segment(stored_column_id);
+        if (versions && std::any_of(versions->begin(), versions->end(), [&](const auto& version) {
+              return version.column_id == stored_column_id;
+            })) {
+          // Updated columns are copied, the indexes, pruning statistics, and zone maps of the stored segment do not
+          // apply to the copy
+          *output_segments_iter = ColumnVersionStore::apply(
+              *stored_segment, stored_table->column_is_nullable(stored_column_id), stored_column_id, *versions);
+          if (output_pruning_statistics) output_pruning_statistics->emplace_back(nullptr);
+          if (output_zone_maps) output_zone_maps->emplace_back(nullptr);
+        } else {
+          *output_segments_iter = stored_segment;
+          auto indexes = stored_chunk->get_indexes({*output_segments_iter});
+          if (!indexes.empty()) {
+            output_indexes.insert(std::end(output_indexes), std::begin(indexes), std::end(indexes));
+          }
+          if (output_pruning_statistics) {
+            output_pruning_statistics->emplace_back((*stored_pruning_statistics)[stored_column_id]);
+          }
+          if (output_zone_maps) output_zone_maps->emplace_back((*stored_zone_maps)[stored_column_id]);
         }
         ++output_segments_iter;
       }
@@ -197,13 +261,34 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       if (adapted_chunk_order) {
         (*output_chunks_iter)->set_ordered_by(*adapted_chunk_order);
       }
+      // Validate relies on immutable chunks not receiving any more rows, see ChunkVisibility in validate.cpp
+      if (!stored_chunk->is_mutable()) {
+        (*output_chunks_iter)->mark_immutable();
+        (*output_chunks_iter)->set_pruning_statistics(output_pruning_statistics);
+        (*output_chunks_iter)->set_zone_maps(output_zone_maps);
+      }
     }
 
     ++output_chunks_iter;
   }
 
-  return std::make_shared<Table>(pruned_column_definitions, TableType::Data, std::move(output_chunks),
-                                 stored_table->has_mvcc());
+  const auto output_table = std::make_shared<Table>(pruned_column_definitions, TableType::Data,
+                                                    std::move(output_chunks), stored_table->has_mvcc());
+
+  // The key column is not updated in place (see Update), so the PrimaryKeyIndex also applies to the output Table
+  if (stored_primary_key_index) {
+    const auto stored_column_id = stored_primary_key_index->column_id();
+    if (!std::binary_search(_pruned_column_ids.begin(), _pruned_column_ids.end(), stored_column_id)) {
+      const auto pruned_column_count = std::distance(
+          _pruned_column_ids.begin(),
+          std::lower_bound(_pruned_column_ids.begin(), _pruned_column_ids.end(), stored_column_id));
+      const auto output_column_id = static_cast<ColumnID>(stored_column_id - pruned_column_count);
+      output_table->set_primary_key_index(
+          stored_primary_key_index->derive(output_column_id, std::move(output_chunk_ids)));
+    }
+  }
+
+  return output_table;
 }
 
 }  // namespace opossum
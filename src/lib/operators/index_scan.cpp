@@ -1,18 +1,31 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "expression/between_expression.hpp"
+#include "expression/expression_functional.hpp"
 
 #include "hyrise.hpp"
 
+#include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
+
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
 
 namespace opossum {
 
@@ -38,6 +51,15 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_uses_primary_key_index()) {
+    _scan_primary_key_index();
+    return _out_table;
+  }
+
+  if (_in_table->type() == TableType::References) {
+    _table_scan_impl = _create_table_scan_impl();
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -61,6 +83,8 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
+  _table_scan_impl.reset();
+
   return _out_table;
 }
 
@@ -79,13 +103,40 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
     const auto chunk = _in_table->get_chunk(chunk_id);
     if (!chunk) return;
 
-    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
-
     Segments segments;
 
-    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-      auto ref_segment_out = std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out);
-      segments.push_back(ref_segment_out);
+    if (_in_table->type() == TableType::References) {
+      const auto matches_out = _scan_reference_chunk(chunk_id);
+      if (matches_out.empty()) return;
+
+      // As in the TableScan, the matches are resolved to the referenced data tables, sharing the resolved position
+      // lists between segments that share their input position list
+      auto resolved_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+        const auto& pos_list_in = reference_segment.pos_list();
+
+        auto& resolved_pos_list = resolved_pos_lists[pos_list_in];
+        if (!resolved_pos_list) {
+          resolved_pos_list = std::make_shared<PosList>();
+          resolved_pos_list->reserve(matches_out.size());
+          if (pos_list_in->references_single_chunk()) resolved_pos_list->guarantee_single_chunk();
+
+          for (const auto& match : matches_out) {
+            resolved_pos_list->emplace_back((*pos_list_in)[match.chunk_offset]);
+          }
+        }
+
+        segments.push_back(std::make_shared<ReferenceSegment>(
+            reference_segment.referenced_table(), reference_segment.referenced_column_id(), resolved_pos_list));
+      }
+    } else {
+      const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out);
+        segments.push_back(ref_segment_out);
+      }
     }
 
     std::lock_guard<std::mutex> lock(output_mutex);
@@ -106,86 +157,206 @@ void IndexScan::_validate_input() {
     Assert(_left_column_ids.size() == _right_values2.size(),
            "Count mismatch: left column IDs and right values don’t have same size.");
   }
+}
+
+bool IndexScan::_uses_primary_key_index() const {
+  const auto primary_key_index = _in_table->primary_key_index();
+  return primary_key_index && _predicate_condition == PredicateCondition::Equals && _left_column_ids.size() == 1 &&
+         _left_column_ids[0] == primary_key_index->column_id();
+}
+
+void IndexScan::_scan_primary_key_index() {
+  auto matches_out = std::make_shared<PosList>();
+  _in_table->primary_key_index()->lookup(*_in_table, _right_values[0], transaction_context(), *matches_out);
+
+  if (!included_chunk_ids.empty()) {
+    matches_out->erase(std::remove_if(matches_out->begin(), matches_out->end(),
+                                      [&](const auto& row_id) {
+                                        return std::find(included_chunk_ids.begin(), included_chunk_ids.end(),
+                                                         row_id.chunk_id) == included_chunk_ids.end();
+                                      }),
+                       matches_out->end());
+  }
+
+  if (matches_out->empty()) return;
 
-  Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
 }
 
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+
+  const auto index = chunk->get_index(_index_type, _left_column_ids);
+
+  // While the chunk is encoded (see ChunkCompressionTask), its new segments are not indexed yet
+  if (!index) {
+    PerformanceWarning("IndexScan fell back to a TableScan for a chunk without an index");
+    return std::move(*_create_table_scan_impl()->scan_chunk(chunk_id));
+  }
+
+  return _scan_index(*index, chunk_id);
+}
+
+PosList IndexScan::_scan_reference_chunk(const ChunkID chunk_id) {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+
+  // The index of the referenced chunk can only be used if all scanned columns reference the same single chunk
+  const auto& first_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(_left_column_ids[0]));
+  const auto& pos_list = *first_segment.pos_list();
+
+  auto referenced_column_ids = std::vector<ColumnID>{};
+  auto index = std::shared_ptr<AbstractIndex>{};
+  auto referenced_chunk_id = INVALID_CHUNK_ID;
+
+  if (!pos_list.empty() && pos_list.references_single_chunk()) {
+    for (const auto column_id : _left_column_ids) {
+      const auto& segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+      if (segment.pos_list() != first_segment.pos_list() ||
+          segment.referenced_table() != first_segment.referenced_table()) {
+        referenced_column_ids.clear();
+        break;
+      }
+      referenced_column_ids.emplace_back(segment.referenced_column_id());
+    }
+
+    referenced_chunk_id = pos_list[0].chunk_id;
+    const auto referenced_chunk = first_segment.referenced_table()->get_chunk(referenced_chunk_id);
+    if (referenced_chunk && !referenced_column_ids.empty()) {
+      index = referenced_chunk->get_index(_index_type, referenced_column_ids);
+    }
+  }
+
+  if (!index) {
+    PerformanceWarning("IndexScan fell back to a TableScan for a chunk without an index");
+    return std::move(*_table_scan_impl->scan_chunk(chunk_id));
+  }
+
+  // Mark the matching rows of the referenced chunk and select the positions of the input chunk that point to them
+  const auto referenced_chunk_size = first_segment.referenced_table()->get_chunk(referenced_chunk_id)->size();
+  auto is_match = std::vector<bool>(referenced_chunk_size);
+  for (const auto& row_id : _scan_index(*index, referenced_chunk_id)) {
+    is_match[row_id.chunk_offset] = true;
+  }
+
+  auto matches_out = PosList{};
+  matches_out.guarantee_single_chunk();
+  const auto pos_list_size = static_cast<ChunkOffset>(pos_list.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < pos_list_size; ++chunk_offset) {
+    if (is_match[pos_list[chunk_offset].chunk_offset]) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return matches_out;
+}
+
+std::unique_ptr<AbstractTableScanImpl> IndexScan::_create_table_scan_impl() const {
+  if (_left_column_ids.size() > 1) {
+    // Multi-column indexes are only scanned for the equality of all columns, see IndexScanRule
+    Assert(_predicate_condition == PredicateCondition::Equals,
+           "IndexScan can only fall back to a TableScan for multi-column equality predicates");
+
+    auto predicate = std::shared_ptr<AbstractExpression>{};
+    for (auto column_index = size_t{0}; column_index < _left_column_ids.size(); ++column_index) {
+      const auto column_id = _left_column_ids[column_index];
+      const auto column = pqp_column_(column_id, _in_table->column_data_type(column_id),
+                                      _in_table->column_is_nullable(column_id), _in_table->column_name(column_id));
+      const auto column_predicate = equals_(column, value_(_right_values[column_index]));
+      if (predicate) {
+        predicate = and_(predicate, column_predicate);
+      } else {
+        predicate = column_predicate;
+      }
+    }
+
+    return std::make_unique<ExpressionEvaluatorTableScanImpl>(_in_table, predicate);
+  }
+
+  if (is_between_predicate_condition(_predicate_condition)) {
+    return std::make_unique<ColumnBetweenTableScanImpl>(_in_table, _left_column_ids[0], _right_values[0],
+                                                        _right_values2[0], _predicate_condition);
+  }
+
+  return std::make_unique<ColumnVsValueTableScanImpl>(_in_table, _left_column_ids[0], _predicate_condition,
+                                                      _right_values[0]);
+}
+
+PosList IndexScan::_scan_index(const AbstractIndex& index, const ChunkID chunk_id) const {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
   auto range_begin = AbstractIndex::Iterator{};
   auto range_end = AbstractIndex::Iterator{};
 
-  const auto chunk = _in_table->get_chunk(chunk_id);
   auto matches_out = PosList{};
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index, "Index of specified type not found for segment (vector).");
-
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
+      range_begin = index.lower_bound(_right_values);
+      range_end = index.upper_bound(_right_values);
       break;
     }
     case PredicateCondition::NotEquals: {
       // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      range_begin = index.cbegin();
+      range_end = index.lower_bound(_right_values);
 
       matches_out.reserve(std::distance(range_begin, range_end));
       std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
 
       // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      range_begin = index.upper_bound(_right_values);
+      range_end = index.cend();
       break;
     }
     case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      range_begin = index.cbegin();
+      range_end = index.lower_bound(_right_values);
       break;
     }
     case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
+      range_begin = index.cbegin();
+      range_end = index.upper_bound(_right_values);
       break;
     }
     case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      range_begin = index.upper_bound(_right_values);
+      range_end = index.cend();
       break;
     }
     case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
+      range_begin = index.lower_bound(_right_values);
+      range_end = index.cend();
       break;
     }
     case PredicateCondition::BetweenInclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      range_begin = index.lower_bound(_right_values);
+      range_end = index.upper_bound(_right_values2);
       break;
     }
     case PredicateCondition::BetweenLowerExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      range_begin = index.upper_bound(_right_values);
+      range_end = index.upper_bound(_right_values2);
       break;
     }
     case PredicateCondition::BetweenUpperExclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
+      range_begin = index.lower_bound(_right_values);
+      range_end = index.lower_bound(_right_values2);
       break;
     }
     case PredicateCondition::BetweenExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
+      range_begin = index.upper_bound(_right_values);
+      range_end = index.lower_bound(_right_values2);
       break;
     }
     default:
       Fail("Unsupported comparison type encountered");
   }
 
-  DebugAssert(_in_table->type() == TableType::Data, "Cannot guarantee single chunk PosList for non-data tables.");
+  // All matches are positions in the indexed chunk
   matches_out.guarantee_single_chunk();
 
   const auto current_matches_size = matches_out.size();
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "table_scan/abstract_table_scan_impl.hpp"
 
 #include "all_type_variant.hpp"
 #include "storage/index/segment_index_type.hpp"
@@ -12,12 +14,24 @@
 namespace opossum {
 
 class Table;
+class AbstractIndex;
 class AbstractTask;
 
 /**
  * Operator that performs a predicate search using indexes
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * For inputs that consist of ReferenceSegments (e.g., the output of a Validate), the index of the referenced chunk is
+ * used if all positions of an input chunk reference the same chunk. Input chunks for which no index is found are
+ * scanned like in a TableScan.
+ *
+ * For multi-column indexes (e.g., an AdaptiveRadixTreeIndex on (a, b)), left_column_ids and right_values hold one entry
+ * per indexed column. Only Equals is supported for them, i.e., the scan returns the rows where a = v0 AND b = v1.
+ *
+ * Equality predicates on the column of the table's PrimaryKeyIndex are answered with a single lookup in that index
+ * (independent of the index_type), which covers all chunks including mutable ones. If a transaction context is set,
+ * only the rows visible to the transaction are returned in that case.
  */
 class IndexScan : public AbstractReadOnlyOperator {
  public:
@@ -41,6 +55,15 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  PosList _scan_reference_chunk(const ChunkID chunk_id);
+
+  // Returns the RowIDs of the rows of the indexed chunk that satisfy the predicate
+  PosList _scan_index(const AbstractIndex& index, const ChunkID chunk_id) const;
+
+  std::unique_ptr<AbstractTableScanImpl> _create_table_scan_impl() const;
+
+  bool _uses_primary_key_index() const;
+  void _scan_primary_key_index();
 
  private:
   const SegmentIndexType _index_type;
@@ -51,6 +74,9 @@ class IndexScan : public AbstractReadOnlyOperator {
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
+
+  // Used for input chunks of reference tables for which no index is found
+  std::unique_ptr<AbstractTableScanImpl> _table_scan_impl;
 };
 
 }  // namespace opossum
@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -94,73 +95,54 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
-   *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
-   *    Since allocation is expected to be faster than writing to the memory, allocating under lock and then writing -
-   *    in a second step - without lock will minimize the time that the Table's append_mutex is locked.
+   *    Rows are reserved in the last Chunk of the Table without a lock (see Chunk::reserve_rows()), so that concurrent
+   *    Inserts only have to wait for each other while growing the Segments, which is fast as their capacity has been
+   *    reserved when the Chunk was created (see Table::prepare_mutable_chunk()).
    */
   {
-    const auto append_lock = _target_table->acquire_append_mutex();
-
+    const auto max_chunk_size = _target_table->max_chunk_size();
     auto remaining_rows = input_table_left()->row_count();
 
     if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
+      _target_table->try_append_mutable_chunk(ChunkID{0});
     }
 
     while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
+      const auto chunk_count = _target_table->chunk_count();
+      const auto target_chunk_id = ChunkID{chunk_count - 1};
+      const auto target_chunk = chunk_count > 0 ? _target_table->get_chunk(target_chunk_id) : nullptr;
 
       // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->max_chunk_size()) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
+      if (!target_chunk || !target_chunk->is_mutable()) {
+        _target_table->try_append_mutable_chunk(chunk_count);
+        continue;
       }
 
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->max_chunk_size() - target_chunk->size(), remaining_rows);
-
-      _target_chunk_ranges.emplace_back(
-          ChunkRange{target_chunk_id, target_chunk->size(),
-                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
-
-      // Grow MVCC vectors and mark new (but still empty) rows as being under modification by current transaction.
-      // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
-      // new row count.
-      {
-        auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
-        mvcc_data->grow_by(num_rows_for_target_chunk, context->transaction_id(), MvccData::MAX_COMMIT_ID);
+      const auto row_count = static_cast<ChunkOffset>(std::min<size_t>(remaining_rows, max_chunk_size));
+      const auto [begin_chunk_offset, end_chunk_offset] = target_chunk->reserve_rows(row_count, max_chunk_size);
+      if (begin_chunk_offset == end_chunk_offset) {
+        _target_table->try_append_mutable_chunk(chunk_count);
+        continue;
       }
 
-      // Grow data Segments.
-      // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
-      // resize that makes the new row count visible to the outside world.
-      auto old_size = target_chunk->size();
-      for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
-        const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
-
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-
-          const auto value_segment =
-              std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
-          Assert(value_segment, "Cannot insert into non-ValueColumns");
-
-          const auto new_size = old_size + num_rows_for_target_chunk;
-
-          value_segment->values().resize(new_size);
+      // Once half of the Chunk is reserved, prepare the next one
+      const auto half_chunk_size = max_chunk_size / 2;
+      if (begin_chunk_offset <= half_chunk_size && half_chunk_size < end_chunk_offset) {
+        _target_table->prepare_mutable_chunk();
+      }
 
-          if (value_segment->is_nullable()) {
-            value_segment->null_values().resize(new_size);
-          }
-        });
+      target_chunk->grow_reserved_rows(begin_chunk_offset, end_chunk_offset, context->transaction_id());
 
-        // Make sure the first columns rewrite actually happens last and doesn't get reordered.
-        std::atomic_thread_fence(std::memory_order_seq_cst);
+      // All rows of the Chunk have been grown once the last ones are (see Chunk::grow_reserved_rows()), so the Chunk
+      // will not change its size anymore. Marking it immutable allows it to be encoded in the background once the
+      // pending Inserts are finished (see ChunkCompressionPlugin).
+      if (end_chunk_offset == max_chunk_size) {
+        target_chunk->mark_immutable();
       }
 
-      remaining_rows -= num_rows_for_target_chunk;
+      _target_chunk_ranges.emplace_back(ChunkRange{target_chunk_id, begin_chunk_offset, end_chunk_offset});
+
+      remaining_rows -= end_chunk_offset - begin_chunk_offset;
     }
   }
 
@@ -206,6 +188,28 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the inserted rows to the PrimaryKeyIndex of the Table. The rows are not visible to other transactions until
+   *    they are committed, which lookups in the index check through the MvccData.
+   */
+  if (const auto primary_key_index = _target_table->primary_key_index()) {
+    const auto column_id = primary_key_index->column_id();
+
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_segment = _target_table->get_chunk(target_chunk_range.chunk_id)->get_segment(column_id);
+
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto& values = static_cast<const ValueSegment<ColumnDataType>&>(*target_segment).values();
+
+        for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+             chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+          primary_key_index->insert(values[chunk_offset], RowID{target_chunk_range.chunk_id, chunk_offset});
+        }
+      });
+    }
+  }
+
   return nullptr;
 }
 
@@ -219,6 +223,8 @@ void Insert::_on_commit_records(const CommitID cid) {
       mvcc_data->begin_cids[chunk_offset] = cid;
       mvcc_data->tids[chunk_offset] = 0u;
     }
+
+    mvcc_data->register_insert_commit(target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset, cid);
   }
 }
 
@@ -254,6 +260,41 @@ void Insert::_on_rollback_records() {
       mvcc_data->begin_cids[chunk_offset] = 0u;
       mvcc_data->tids[chunk_offset] = 0u;
     }
+
+    mvcc_data->register_insert_rollback(target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset);
+  }
+}
+
+void Insert::_on_write_log_records(LogEntryWriter& log_entry) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    log_entry.write(LogRecordType::Insert);
+    log_entry.write(_target_table_name);
+    log_entry.write(target_chunk_range.chunk_id);
+    log_entry.write(target_chunk_range.begin_chunk_offset);
+    log_entry.write(target_chunk_range.end_chunk_offset);
+
+    // The rows are not committed yet, so the target chunk cannot have been encoded. The values are written column by
+    // column, each one preceded by a null flag if the column is nullable.
+    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < _target_table->column_count(); ++column_id) {
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto value_segment =
+            std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
+        Assert(value_segment, "Expected inserted rows to be stored in a ValueSegment");
+
+        const auto& values = value_segment->values();
+        for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+             chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+          if (value_segment->is_nullable()) {
+            const auto is_null = static_cast<bool>(value_segment->null_values()[chunk_offset]);
+            log_entry.write(is_null);
+            if (is_null) continue;
+          }
+          log_entry.write(values[chunk_offset]);
+        }
+      });
+    }
   }
 }
 
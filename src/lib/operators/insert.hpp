@@ -34,6 +34,7 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
 
  private:
   const std::string _target_table_name;
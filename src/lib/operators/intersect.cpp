@@ -0,0 +1,42 @@
+#include "intersect.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "operators/set_operation/row_key_store.hpp"
+
+namespace opossum {
+Intersect::Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+                     const std::shared_ptr<const AbstractOperator>& right_in, const SetOperationMode mode)
+    : AbstractReadOnlyOperator(OperatorType::Intersect, left_in, right_in), _mode(mode) {}
+
+const std::string& Intersect::name() const {
+  static const auto name = std::string{"Intersect"};
+  return name;
+}
+
+std::string Intersect::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(" << _mode << ")";
+  return stream.str();
+}
+
+SetOperationMode Intersect::mode() const { return _mode; }
+
+std::shared_ptr<AbstractOperator> Intersect::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Intersect>(copied_input_left, copied_input_right, _mode);
+}
+
+void Intersect::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Intersect::_on_execute() {
+  return execute_set_operation(input_table_left(), input_table_right(), _mode, true);
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Emits the rows of the left input that have an equal row in the right input (see SetOperationMode for how duplicates
+ * are handled). Both inputs need to have the same column definitions. NULL values are considered equal to each other.
+ *
+ * The rows are materialized and hashed chunk by chunk in parallel, see RowKeyStore.
+ */
+class Intersect : public AbstractReadOnlyOperator {
+ public:
+  Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+            const std::shared_ptr<const AbstractOperator>& right_in,
+            const SetOperationMode mode = SetOperationMode::Any);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationMode mode() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const SetOperationMode _mode;
+};
+}  // namespace opossum
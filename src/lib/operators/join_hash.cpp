@@ -13,6 +13,7 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "operators/operator_output_segments.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
@@ -25,6 +26,11 @@ namespace {
 // Semi/Anti* Joins only emit tuples from the probe table
 enum class OutputColumnOrder { BuildFirstProbeSecond, ProbeFirstBuildSecond, ProbeOnly };
 
+// A Bloom filter over the build side is only used to reduce the probe side if the probe side is at least this many
+// times larger than the build side. Otherwise, building the filter delays the probe side materialization for little
+// gain, as most probe values are expected to have a join partner.
+constexpr auto BLOOM_FILTER_MIN_PROBE_TO_BUILD_RATIO = size_t{4};
+
 }  // namespace
 
 namespace opossum {
@@ -289,16 +295,27 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // HashTables for the build column, one for each partition
     std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
 
+    // For inner and semi joins, probe values without a join partner are not part of the result. If the probe side is
+    // much larger than the build side, we add all build values to a Bloom filter while materializing them and use it
+    // to drop most of these probe values before they are materialized and partitioned. Pushing the filter further
+    // down into the scans of the probe side is not possible, as the inputs of an operator are executed before it.
+    auto bloom_filter = std::unique_ptr<BlockedBloomFilter>{};
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        _build_input_table->row_count() * BLOOM_FILTER_MIN_PROBE_TO_BUILD_RATIO <= _probe_input_table->row_count()) {
+      bloom_filter = std::make_unique<BlockedBloomFilter>(_build_input_table->row_count());
+    }
+
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
     // We have two data paths, one for build side and one for probe input side. We can prepare (i.e.,
     // materialize(), build(), etc.) both sides in parallel until the actual join takes place.
     // All tasks might spawn concurrent tasks themselves. For example, materialize parallelizes over
-    // the input chunks and the following steps over the radix clusters.
+    // the input chunks and the following steps over the radix clusters. If a Bloom filter is used, the build side
+    // is materialized before the probe side is started, as the filter needs to be complete.
     //
     //           Build Relation                       Probe Relation
     //                 |                                    |
-    //        materialize_input()                  materialize_input()
+    //        materialize_input()  --(Bloom filter)-->  materialize_input()
     //                 |                                    |
     //  ( partition_radix_parallel() )       ( partition_radix_parallel() )
     //                 |                                    |
@@ -310,18 +327,29 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                           \                 /
     //                          Probing (actual Join)
 
+    const auto materialize_build_column = [&]() {
+      if (keep_nulls_build_column) {
+        materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
+            _build_input_table, _column_ids.first, build_chunk_offsets, histograms_build_column, _radix_bits);
+      } else {
+        materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
+            _build_input_table, _column_ids.first, build_chunk_offsets, histograms_build_column, _radix_bits,
+            bloom_filter.get());
+      }
+    };
+
+    if (bloom_filter) {
+      materialize_build_column();
+    }
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
     /**
      * 1.1 Schedule a JobTask for materialization, optional radix partitioning and hash table building for the build side
      */
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
-      if (keep_nulls_build_column) {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, build_chunk_offsets, histograms_build_column, _radix_bits);
-      } else {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, build_chunk_offsets, histograms_build_column, _radix_bits);
+      if (!bloom_filter) {
+        materialize_build_column();
       }
 
       if (_radix_bits > 0) {
@@ -362,7 +390,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
             _probe_input_table, _column_ids.second, probe_chunk_offsets, histograms_probe_column, _radix_bits);
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-            _probe_input_table, _column_ids.second, probe_chunk_offsets, histograms_probe_column, _radix_bits);
+            _probe_input_table, _column_ids.second, probe_chunk_offsets, histograms_probe_column, _radix_bits,
+            nullptr, bloom_filter.get());
       }
 
       if (_radix_bits > 0) {
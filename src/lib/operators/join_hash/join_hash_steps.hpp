@@ -4,6 +4,10 @@
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
+#include <array>
+#include <atomic>
+#include <vector>
+
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
@@ -44,10 +48,26 @@ template <typename T>
 using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
                                      std::vector<PartitionedElement<T>>>;
 
+// std::hash is the identity for integers and, within a radix partition, all hashes share their lowest bits. Before
+// the bits of a hash are used to address a hash table or a Bloom filter, they are thus mixed (finalizer of splitmix64).
+inline uint64_t mix_hash(const Hash hash) {
+  auto mixed_hash = static_cast<uint64_t>(hash);
+  mixed_hash = (mixed_hash ^ (mixed_hash >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  mixed_hash = (mixed_hash ^ (mixed_hash >> 27)) * uint64_t{0x94d049bb133111eb};
+  return mixed_hash ^ (mixed_hash >> 31);
+}
+
 // Stores the mapping from HashedType to positions. Conceptually, this is similar to an (unordered_)multimap, but it
 // has some optimizations for the performance-critical probe() method. Instead of storing the matches directly in the
 // hashmap (think map<HashedType, PosList>), we store an offset. This keeps the hashmap small and makes it easier to
 // cache.
+//
+// While the build side is inserted, a bytell hash map is used. Once all values are inserted, shrink_to_fit() replaces
+// it with a layout that is optimized for probing: An open-addressing table of groups, where each group holds eight
+// one-byte tags (derived from the hash) in a single 64-bit word, followed by the offsets of the corresponding
+// values. A lookup compares all tags of a group at once (SIMD within a register) and only compares the values of
+// slots with a matching tag. find_batch() looks up multiple probe values at once and prefetches their groups first, so
+// that the probe phase is not bound by the latency of a cache miss per probe value.
 template <typename HashedType>
 class PosHashTable {
   // In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
@@ -65,6 +85,11 @@ class PosHashTable {
   using SmallPosList = boost::container::small_vector<RowID, 1>;
 
  public:
+  // Number of probe values that find_batch() looks up at once. Large enough to overlap the cache misses of the group
+  // accesses, small enough for the prefetched groups to stay in the L1 cache.
+  static constexpr auto PROBE_BATCH_SIZE = size_t{16};
+  using BatchResult = std::array<typename std::vector<SmallPosList>::const_iterator, PROBE_BATCH_SIZE>;
+
   explicit PosHashTable(const JoinHashBuildMode mode, const size_t max_size)
       : _hash_table(), _pos_lists(max_size), _mode(mode) {
     _hash_table.reserve(max_size);
@@ -73,6 +98,7 @@ class PosHashTable {
   // For a value seen on the build side, add its row_id to the table
   template <typename InputType>
   void emplace(const InputType& value, RowID row_id) {
+    DebugAssert(!_values && _groups.empty(), "Cannot add values after shrink_to_fit()");
     const auto casted_value = static_cast<HashedType>(value);
     const auto it = _hash_table.find(casted_value);
     if (it != _hash_table.end()) {
@@ -89,6 +115,7 @@ class PosHashTable {
     }
   }
 
+  // Called once all values have been added. Frees unused memory and switches to the layout used for probing.
   void shrink_to_fit() {
     _pos_lists.resize(_hash_table.size());
     _pos_lists.shrink_to_fit();
@@ -104,41 +131,75 @@ class PosHashTable {
       for (const auto& [value, offset] : _hash_table) {
         _values->emplace_back(std::pair<HashedType, Offset>{value, offset});
       }
-      _hash_table.clear();
     } else {
-      _hash_table.shrink_to_fit();
+      // Keep the load factor at or below 7/8 so that every probe sequence ends in a group with an empty slot
+      auto group_count = size_t{1};
+      while (group_count * 7 < _hash_table.size()) {
+        group_count <<= 1;
+      }
+      _groups.resize(group_count);
+      _group_mask = group_count - 1;
+
+      _distinct_values.resize(_hash_table.size());
+      for (const auto& [value, offset] : _hash_table) {
+        _distinct_values[offset] = value;
+        _insert_into_groups(offset, _hash(value));
+      }
     }
+    _hash_table = HashTable{};
   }
 
   // For a value seen on the probe side, return an iterator into the matching positions on the build side
   template <typename InputType>
   const std::vector<SmallPosList>::const_iterator find(const InputType& value) const {
-    const auto casted_value = static_cast<HashedType>(value);
+    const auto& casted_value = _cast(value);
 
-    if (!_values) {
-      const auto hash_table_iter = _hash_table.find(casted_value);
-      if (hash_table_iter == _hash_table.end()) return end();
-      return _pos_lists.begin() + hash_table_iter->second;
-    } else {
+    if (_values) {
       const auto values_iter =
           std::find_if(_values->begin(), _values->end(), [&](const auto& pair) { return pair.first == casted_value; });
       if (values_iter == _values->end()) return end();
       return _pos_lists.begin() + values_iter->second;
+    } else if (!_groups.empty()) {
+      const auto offset = _find_in_groups(casted_value, _hash(casted_value));
+      if (offset == INVALID_OFFSET) return end();
+      return _pos_lists.begin() + offset;
+    } else {
+      const auto hash_table_iter = _hash_table.find(casted_value);
+      if (hash_table_iter == _hash_table.end()) return end();
+      return _pos_lists.begin() + hash_table_iter->second;
+    }
+  }
+
+  // Looks up value_count (at most PROBE_BATCH_SIZE) probe values at once and writes the result of find() for the
+  // value returned by get_value(index) to results[index]. All values are hashed and their groups are prefetched before
+  // the first group is accessed.
+  template <typename GetValue>
+  void find_batch(const size_t value_count, const GetValue& get_value, BatchResult& results) const {
+    DebugAssert(value_count <= PROBE_BATCH_SIZE, "Batch exceeds PROBE_BATCH_SIZE");
+
+    if (_groups.empty()) {
+      for (auto index = size_t{0}; index < value_count; ++index) {
+        results[index] = find(get_value(index));
+      }
+      return;
+    }
+
+    auto hashes = std::array<uint64_t, PROBE_BATCH_SIZE>{};
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      hashes[index] = _hash(_cast(get_value(index)));
+      __builtin_prefetch(&_groups[hashes[index] & _group_mask]);
+    }
+
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      const auto offset = _find_in_groups(_cast(get_value(index)), hashes[index]);
+      results[index] = offset == INVALID_OFFSET ? end() : _pos_lists.begin() + offset;
     }
   }
 
   // For a value seen on the probe side, return whether it has been seen on the build side
   template <typename InputType>
   bool contains(const InputType& value) const {
-    const auto casted_value = static_cast<HashedType>(value);
-
-    if (!_values) {
-      return _hash_table.find(casted_value) != _hash_table.end();
-    } else {
-      const auto values_iter =
-          std::find_if(_values->begin(), _values->end(), [&](const auto& pair) { return pair.first == casted_value; });
-      return values_iter != _values->end();
-    }
+    return find(value) != end();
   }
 
   const std::vector<SmallPosList>::const_iterator begin() const { return _pos_lists.begin(); }
@@ -146,10 +207,134 @@ class PosHashTable {
   const std::vector<SmallPosList>::const_iterator end() const { return _pos_lists.end(); }
 
  private:
+  static constexpr auto INVALID_OFFSET = std::numeric_limits<Offset>::max();
+  static constexpr auto GROUP_SIZE = size_t{8};
+  static constexpr auto LOWEST_TAG_BITS = uint64_t{0x0101010101010101};
+  static constexpr auto HIGHEST_TAG_BITS = uint64_t{0x8080808080808080};
+
+  struct Group {
+    // One byte per slot. Empty slots have a tag of zero, occupied slots always have the highest bit of their tag set.
+    uint64_t tags{0};
+    std::array<Offset, GROUP_SIZE> offsets;
+  };
+
+  // Avoids copying probe values (e.g., strings) that already have the HashedType
+  template <typename InputType>
+  static decltype(auto) _cast(const InputType& value) {
+    if constexpr (std::is_same_v<InputType, HashedType>) {
+      return (value);
+    } else {
+      return static_cast<HashedType>(value);
+    }
+  }
+
+  static uint64_t _hash(const HashedType& value) { return mix_hash(std::hash<HashedType>{}(value)); }
+
+  // The lower bits of the hash select the group, the upper seven bits form the tag
+  static uint64_t _tag(const uint64_t hash) { return (hash >> 57) | 0x80; }
+
+  // Returns a mask in which the highest bit of each byte is set if the tag of the corresponding slot might equal tag.
+  // Slots above a matching slot might be reported as false positives, which the caller rules out by comparing values.
+  static uint64_t _match_tag(const uint64_t tags, const uint64_t tag) {
+    const auto difference = tags ^ (tag * LOWEST_TAG_BITS);
+    return (difference - LOWEST_TAG_BITS) & ~difference & HIGHEST_TAG_BITS;
+  }
+
+  static uint64_t _empty_slots(const uint64_t tags) { return ~tags & HIGHEST_TAG_BITS; }
+
+  static size_t _first_slot(const uint64_t slot_mask) { return static_cast<size_t>(__builtin_ctzll(slot_mask)) / 8; }
+
+  void _insert_into_groups(const Offset offset, const uint64_t hash) {
+    for (auto group_id = hash & _group_mask;; group_id = (group_id + 1) & _group_mask) {
+      auto& group = _groups[group_id];
+      const auto empty_slots = _empty_slots(group.tags);
+      if (!empty_slots) continue;
+
+      const auto slot = _first_slot(empty_slots);
+      group.tags |= _tag(hash) << (slot * 8);
+      group.offsets[slot] = offset;
+      return;
+    }
+  }
+
+  Offset _find_in_groups(const HashedType& value, const uint64_t hash) const {
+    const auto tag = _tag(hash);
+    for (auto group_id = hash & _group_mask;; group_id = (group_id + 1) & _group_mask) {
+      const auto& group = _groups[group_id];
+      for (auto matches = _match_tag(group.tags, tag); matches; matches &= matches - 1) {
+        const auto offset = group.offsets[_first_slot(matches)];
+        if (_distinct_values[offset] == value) return offset;
+      }
+
+      // Values are never removed, so the probe sequence of a value does not continue past a group with an empty slot
+      if (_empty_slots(group.tags)) return INVALID_OFFSET;
+    }
+  }
+
   HashTable _hash_table;
   std::vector<SmallPosList> _pos_lists;
   JoinHashBuildMode _mode;
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
+
+  // Probing layout, see above. _distinct_values holds the value of each offset.
+  std::vector<Group> _groups;
+  uint64_t _group_mask{0};
+  std::vector<HashedType> _distinct_values;
+};
+
+/*
+A blocked Bloom filter over the values of the build side. Each value sets (and is checked against) BITS_PER_VALUE bits
+within a single 64-bit block, so that a lookup only touches a single word. It is filled while the build side is
+materialized and handed to the materialization of the probe side, where values that cannot have a join partner are
+dropped before they are radix-partitioned. As for all Bloom filters, false positives are possible, but false
+negatives are not - the hash tables still decide whether there is an actual match.
+*/
+class BlockedBloomFilter : private Noncopyable {
+ public:
+  explicit BlockedBloomFilter(const size_t value_count) {
+    // Aim for about 16 bits per value. The number of blocks is a power of two so that the block can be masked out of
+    // the hash.
+    auto block_count = size_t{1};
+    while (block_count * 64 < value_count * 16 && block_count < MAX_BLOCK_COUNT) {
+      block_count <<= 1;
+    }
+
+    _block_mask = block_count - 1;
+    _blocks = std::vector<std::atomic<uint64_t>>(block_count);
+    for (auto& block : _blocks) {
+      block.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Can be called concurrently
+  void insert(const Hash hash) {
+    const auto mixed_hash = mix_hash(hash);
+    _blocks[mixed_hash & _block_mask].fetch_or(_bits(mixed_hash), std::memory_order_relaxed);
+  }
+
+  // Must not be called concurrently with insert()
+  bool may_contain(const Hash hash) const {
+    const auto mixed_hash = mix_hash(hash);
+    const auto bits = _bits(mixed_hash);
+    return (_blocks[mixed_hash & _block_mask].load(std::memory_order_relaxed) & bits) == bits;
+  }
+
+ private:
+  static constexpr auto MAX_BLOCK_COUNT = size_t{1} << 24;
+  static constexpr auto BITS_PER_VALUE = size_t{4};
+
+  // The lower bits of the mixed hash select the block (MAX_BLOCK_COUNT limits them to 24 bits), the upper bits select
+  // the bits within the block
+  static uint64_t _bits(const uint64_t mixed_hash) {
+    auto bits = uint64_t{0};
+    for (auto bit_id = size_t{0}; bit_id < BITS_PER_VALUE; ++bit_id) {
+      bits |= uint64_t{1} << ((mixed_hash >> (40 + bit_id * 6)) & 63);
+    }
+    return bits;
+  }
+
+  std::vector<std::atomic<uint64_t>> _blocks;
+  size_t _block_mask;
 };
 
 /*
@@ -197,10 +382,20 @@ inline std::vector<size_t> determine_chunk_offsets(const std::shared_ptr<const T
   return chunk_offsets;
 }
 
+/*
+Materializes the values of a column and creates a histogram of their radix clusters per chunk. If an output_bloom_filter
+is given, all materialized (non-NULL) values are added to it. If an input_bloom_filter is given, only values contained
+in it are materialized. Like discarded NULL values, the dropped values leave an empty slot (with a NULL_ROW_ID) behind.
+*/
 template <typename T, typename HashedType, bool retain_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
                                     const std::vector<size_t>& chunk_offsets,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    BlockedBloomFilter* output_bloom_filter = nullptr,
+                                    const BlockedBloomFilter* input_bloom_filter = nullptr) {
+  DebugAssert(!input_bloom_filter || !retain_null_values,
+              "Values dropped by the Bloom filter cannot be distinguished from retained NULL values");
+
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
@@ -220,6 +415,8 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // create histograms per chunk
   histograms.resize(chunk_offsets.size());
 
+  const auto requires_hash = radix_bits > 0 || input_bloom_filter || output_bloom_filter;
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(in_table->chunk_count());
 
@@ -258,7 +455,21 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
           const auto& value = *it;
           ++it;
 
-          if (!value.is_null() || retain_null_values) {
+          auto materialize_value = !value.is_null() || retain_null_values;
+
+          // The hash is used by both Bloom filters and the radix partitioning, so it is only computed once.
+          // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+          // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+          // double
+          const auto hashed_value = materialize_value && requires_hash
+                                        ? Hash{hash_function(static_cast<HashedType>(value.value()))}
+                                        : Hash{0};
+
+          if (input_bloom_filter && materialize_value) {
+            materialize_value = input_bloom_filter->may_contain(hashed_value);
+          }
+
+          if (materialize_value) {
             /*
             For ReferenceSegments we do not use the RowIDs from the referenced tables.
             Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
@@ -279,13 +490,13 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             }
 
             if (radix_bits > 0) {
-              // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-              // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-              // double
-              const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
               const Hash radix = hashed_value & mask;
               ++histogram[radix];
             }
+
+            if (output_bloom_filter && !value.is_null()) {
+              output_bloom_filter->insert(hashed_value);
+            }
           }
           // reference_chunk_offset is only used for ReferenceSegments
           if constexpr (is_reference_segment_iterable_v<IterableType>) {
@@ -573,70 +784,80 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-          auto& probe_column_element = partition[partition_offset];
-
-          if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
-            // From previous joins, we could potentially have NULL values that do not refer to
-            // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
-            continue;
-          }
-
-          const auto& primary_predicate_matching_rows =
-              hash_table.find(static_cast<HashedType>(probe_column_element.value));
+        // Values are looked up in batches, see PosHashTable::find_batch()
+        constexpr auto BATCH_SIZE = PosHashTable<HashedType>::PROBE_BATCH_SIZE;
+        auto batch_matches = typename PosHashTable<HashedType>::BatchResult{};
+        for (auto batch_begin = partition_begin; batch_begin < partition_end; batch_begin += BATCH_SIZE) {
+          const auto batch_end = std::min(batch_begin + BATCH_SIZE, partition_end);
+          hash_table.find_batch(
+              batch_end - batch_begin,
+              [&](const size_t index) -> const ProbeColumnType& { return partition[batch_begin + index].value; },
+              batch_matches);
+
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            auto& probe_column_element = partition[partition_offset];
+
+            if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
+              // From previous joins, we could potentially have NULL values that do not refer to
+              // an actual probe_column_element but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
+              continue;
+            }
 
-          if (primary_predicate_matching_rows != hash_table.end()) {
-            // Key exists, thus we have at least one hit for the primary predicate
+            const auto& primary_predicate_matching_rows = batch_matches[partition_offset - batch_begin];
 
-            // Since we cannot store NULL values directly in off-the-shelf containers,
-            // we need to the check the NULL bit vector here because a NULL value (represented
-            // as a zero) yields the same rows as an actual zero value.
-            // For inner joins, we skip NULL values and output them for outer joins.
-            // Note, if the materialization/radix partitioning phase did not explicitly consider
-            // NULL values, they will not be handed to the probe function.
-            if constexpr (keep_null_values) {
-              if ((*probe_radix_container.null_value_bitvector)[partition_offset]) {
-                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-                pos_list_probe_local.emplace_back(probe_column_element.row_id);
-                // ignore found matches and continue with next probe item
-                continue;
+            if (primary_predicate_matching_rows != hash_table.end()) {
+              // Key exists, thus we have at least one hit for the primary predicate
+
+              // Since we cannot store NULL values directly in off-the-shelf containers,
+              // we need to the check the NULL bit vector here because a NULL value (represented
+              // as a zero) yields the same rows as an actual zero value.
+              // For inner joins, we skip NULL values and output them for outer joins.
+              // Note, if the materialization/radix partitioning phase did not explicitly consider
+              // NULL values, they will not be handed to the probe function.
+              if constexpr (keep_null_values) {
+                if ((*probe_radix_container.null_value_bitvector)[partition_offset]) {
+                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                  pos_list_probe_local.emplace_back(probe_column_element.row_id);
+                  // ignore found matches and continue with next probe item
+                  continue;
+                }
               }
-            }
 
-            // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
-            // lists.
-            if (!multi_predicate_join_evaluator) {
-              for (const auto& row_id : *primary_predicate_matching_rows) {
-                pos_list_build_side_local.emplace_back(row_id);
-                pos_list_probe_local.emplace_back(probe_column_element.row_id);
-              }
-            } else {
-              auto match_found = false;
-              for (const auto& row_id : *primary_predicate_matching_rows) {
-                if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
+              // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
+              // lists.
+              if (!multi_predicate_join_evaluator) {
+                for (const auto& row_id : *primary_predicate_matching_rows) {
                   pos_list_build_side_local.emplace_back(row_id);
                   pos_list_probe_local.emplace_back(probe_column_element.row_id);
-                  match_found = true;
                 }
-              }
+              } else {
+                auto match_found = false;
+                for (const auto& row_id : *primary_predicate_matching_rows) {
+                  if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
+                    pos_list_build_side_local.emplace_back(row_id);
+                    pos_list_probe_local.emplace_back(probe_column_element.row_id);
+                    match_found = true;
+                  }
+                }
 
-              // We have not found matching items for all predicates.
-              if constexpr (keep_null_values) {
-                if (!match_found) {
-                  pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-                  pos_list_probe_local.emplace_back(probe_column_element.row_id);
+                // We have not found matching items for all predicates.
+                if constexpr (keep_null_values) {
+                  if (!match_found) {
+                    pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                    pos_list_probe_local.emplace_back(probe_column_element.row_id);
+                  }
                 }
               }
-            }
 
-          } else {
-            // We have not found matching items for the first predicate. Only continue for non-equi join modes.
-            // We use constexpr to prune this conditional for the equi-join implementation.
-            // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
-            // relation since the relations are swapped upfront.
-            if constexpr (keep_null_values) {
-              pos_list_build_side_local.emplace_back(NULL_ROW_ID);
-              pos_list_probe_local.emplace_back(probe_column_element.row_id);
+            } else {
+              // We have not found matching items for the first predicate. Only continue for non-equi join modes.
+              // We use constexpr to prune this conditional for the equi-join implementation.
+              // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
+              // relation since the relations are swapped upfront.
+              if constexpr (keep_null_values) {
+                pos_list_build_side_local.emplace_back(NULL_ROW_ID);
+                pos_list_probe_local.emplace_back(probe_column_element.row_id);
+              }
             }
           }
         }
@@ -705,38 +926,45 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& radix_probe_column,
         MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
                                                                    secondary_join_predicates);
 
-        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-          const auto& probe_column_element = partition[partition_offset];
-
-          if constexpr (mode == JoinMode::Semi) {
-            // NULLs on the probe side are never emitted
-            if (probe_column_element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-              continue;
-            }
-          } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like else if constexpr
-            // NULL values on the probe side always lead to the tuple being emitted for AntiNullAsFalse, irrespective
-            // of secondary predicates (`NULL("as false") AND <anything>` is always false)
-            if ((*probe_column_null_values)[partition_offset]) {
-              pos_list_local.emplace_back(probe_column_element.row_id);
-              continue;
-            }
-          } else if constexpr (mode == JoinMode::AntiNullAsTrue) {  // NOLINT - doesn't like else if constexpr
-            if ((*probe_column_null_values)[partition_offset]) {
-              // Primary predicate is TRUE, as long as we do not support secondary predicates with AntiNullAsTrue.
-              // This means that the probe value never gets emitted
-              continue;
+        // Values are looked up in batches, see PosHashTable::find_batch()
+        constexpr auto BATCH_SIZE = PosHashTable<HashedType>::PROBE_BATCH_SIZE;
+        auto batch_matches = typename PosHashTable<HashedType>::BatchResult{};
+        for (auto batch_begin = partition_begin; batch_begin < partition_end; batch_begin += BATCH_SIZE) {
+          const auto batch_end = std::min(batch_begin + BATCH_SIZE, partition_end);
+          hash_table.find_batch(
+              batch_end - batch_begin,
+              [&](const size_t index) -> const ProbeColumnType& { return partition[batch_begin + index].value; },
+              batch_matches);
+
+          for (auto partition_offset = batch_begin; partition_offset < batch_end; ++partition_offset) {
+            const auto& probe_column_element = partition[partition_offset];
+
+            if constexpr (mode == JoinMode::Semi) {
+              // NULLs on the probe side are never emitted
+              if (probe_column_element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+                continue;
+              }
+            } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like else if constexpr
+              // NULL values on the probe side always lead to the tuple being emitted for AntiNullAsFalse, irrespective
+              // of secondary predicates (`NULL("as false") AND <anything>` is always false)
+              if ((*probe_column_null_values)[partition_offset]) {
+                pos_list_local.emplace_back(probe_column_element.row_id);
+                continue;
+              }
+            } else if constexpr (mode == JoinMode::AntiNullAsTrue) {  // NOLINT - doesn't like else if constexpr
+              if ((*probe_column_null_values)[partition_offset]) {
+                // Primary predicate is TRUE, as long as we do not support secondary predicates with AntiNullAsTrue.
+                // This means that the probe value never gets emitted
+                continue;
+              }
             }
-          }
 
-          auto any_build_column_value_matches = false;
+            auto any_build_column_value_matches = false;
 
-          if (secondary_join_predicates.empty()) {
-            any_build_column_value_matches = hash_table.contains(static_cast<HashedType>(probe_column_element.value));
-          } else {
-            const auto primary_predicate_matching_rows =
-                hash_table.find(static_cast<HashedType>(probe_column_element.value));
-
-            if (primary_predicate_matching_rows != hash_table.end()) {
+            const auto& primary_predicate_matching_rows = batch_matches[partition_offset - batch_begin];
+            if (secondary_join_predicates.empty()) {
+              any_build_column_value_matches = primary_predicate_matching_rows != hash_table.end();
+            } else if (primary_predicate_matching_rows != hash_table.end()) {
               for (const auto& row_id : *primary_predicate_matching_rows) {
                 if (multi_predicate_join_evaluator.satisfies_all_predicates(row_id, probe_column_element.row_id)) {
                   any_build_column_value_matches = true;
@@ -744,12 +972,12 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& radix_probe_column,
                 }
               }
             }
-          }
 
-          if ((mode == JoinMode::Semi && any_build_column_value_matches) ||
-              ((mode == JoinMode::AntiNullAsTrue || mode == JoinMode::AntiNullAsFalse) &&
-               !any_build_column_value_matches)) {
-            pos_list_local.emplace_back(probe_column_element.row_id);
+            if ((mode == JoinMode::Semi && any_build_column_value_matches) ||
+                ((mode == JoinMode::AntiNullAsTrue || mode == JoinMode::AntiNullAsFalse) &&
+                 !any_build_column_value_matches)) {
+              pos_list_local.emplace_back(probe_column_element.row_id);
+            }
           }
         }
       } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like else if constexpr
@@ -783,110 +1011,4 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& radix_probe_column,
   Hyrise::get().scheduler()->wait_for_tasks(jobs);
 }
 
-using PosLists = std::vector<std::shared_ptr<const PosList>>;
-using PosListsByChunk = std::vector<std::shared_ptr<PosLists>>;
-
-/**
- * Returns a vector where each entry with index i references a PosLists object. The PosLists object
- * contains the position list of every segment/chunk in column i.
- * @param input_table
- */
-// See usage in _on_execute() for doc.
-inline PosListsByChunk setup_pos_lists_by_chunk(const std::shared_ptr<const Table>& input_table) {
-  DebugAssert(input_table->type() == TableType::References, "Function only works for reference tables");
-
-  std::map<PosLists, std::shared_ptr<PosLists>> shared_pos_lists_by_pos_lists;
-
-  PosListsByChunk pos_lists_by_segment(input_table->column_count());
-  auto pos_lists_by_segment_it = pos_lists_by_segment.begin();
-
-  const auto input_chunks_count = input_table->chunk_count();
-  const auto input_columns_count = input_table->column_count();
-
-  // For every column, for every chunk
-  for (ColumnID column_id{0}; column_id < input_columns_count; ++column_id) {
-    // Get all the input pos lists so that we only have to pointer cast the segments once
-    auto pos_list_ptrs = std::make_shared<PosLists>(input_table->chunk_count());
-    auto pos_lists_iter = pos_list_ptrs->begin();
-
-    // Iterate over every chunk and add the chunks segment with column_id to pos_list_ptrs
-    for (ChunkID chunk_id{0}; chunk_id < input_chunks_count; ++chunk_id) {
-      const auto chunk = input_table->get_chunk(chunk_id);
-      Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
-
-      const auto& ref_segment_uncasted = chunk->segments()[column_id];
-      const auto ref_segment = std::static_pointer_cast<const ReferenceSegment>(ref_segment_uncasted);
-      *pos_lists_iter = ref_segment->pos_list();
-      ++pos_lists_iter;
-    }
-
-    // pos_list_ptrs contains all position lists of the reference segments for the column_id.
-    auto iter = shared_pos_lists_by_pos_lists.emplace(*pos_list_ptrs, pos_list_ptrs).first;
-
-    *pos_lists_by_segment_it = iter->second;
-    ++pos_lists_by_segment_it;
-  }
-
-  return pos_lists_by_segment;
-}
-
-/**
- *
- * @param output_segments [in/out] Vector to which the newly created reference segments will be written.
- * @param input_table Table which all the position lists reference
- * @param input_pos_list_ptrs_sptrs_by_segments Contains all position lists to all columns of input table
- * @param pos_list contains the positions of rows to use from the input table
- */
-inline void write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
-                                  const PosListsByChunk& input_pos_list_ptrs_sptrs_by_segments,
-                                  std::shared_ptr<PosList> pos_list) {
-  std::map<std::shared_ptr<PosLists>, std::shared_ptr<PosList>> output_pos_list_cache;
-
-  // We might use this later, but want to have it outside of the for loop
-  std::shared_ptr<Table> dummy_table;
-
-  // Add segments from input table to output chunk
-  // for every column for every row in pos_list: get corresponding PosList of input_pos_list_ptrs_sptrs_by_segments
-  // and add it to new_pos_list which is added to output_segments
-  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
-    if (input_table->type() == TableType::References) {
-      if (input_table->chunk_count() > 0) {
-        const auto& input_table_pos_lists = input_pos_list_ptrs_sptrs_by_segments[column_id];
-
-        auto iter = output_pos_list_cache.find(input_table_pos_lists);
-        if (iter == output_pos_list_cache.end()) {
-          // Get the row ids that are referenced
-          auto new_pos_list = std::make_shared<PosList>(pos_list->size());
-          auto new_pos_list_iter = new_pos_list->begin();
-          for (const auto& row : *pos_list) {
-            if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-              *new_pos_list_iter = row;
-            } else {
-              const auto& referenced_pos_list = *(*input_table_pos_lists)[row.chunk_id];
-              *new_pos_list_iter = referenced_pos_list[row.chunk_offset];
-            }
-            ++new_pos_list_iter;
-          }
-
-          iter = output_pos_list_cache.emplace(input_table_pos_lists, new_pos_list).first;
-        }
-
-        auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
-            input_table->get_chunk(ChunkID{0})->get_segment(column_id));
-        output_segments.push_back(std::make_shared<ReferenceSegment>(
-            reference_segment->referenced_table(), reference_segment->referenced_column_id(), iter->second));
-      } else {
-        // If there are no Chunks in the input_table, we can't deduce the Table that input_table is referencing to.
-        // pos_list will contain only NULL_ROW_IDs anyway, so it doesn't matter which Table the ReferenceSegment that
-        // we output is referencing. HACK, but works fine: we create a dummy table and let the ReferenceSegment ref
-        // it.
-        if (!dummy_table) dummy_table = Table::create_dummy_table(input_table->column_definitions());
-        output_segments.push_back(std::make_shared<ReferenceSegment>(dummy_table, column_id, pos_list));
-      }
-    } else {
-      output_segments.push_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
-    }
-  }
-}
-
 }  // namespace opossum
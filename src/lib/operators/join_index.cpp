@@ -13,6 +13,7 @@
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -191,6 +192,9 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
                               secondary_predicate_evaluator);
       }
     }
+  } else if (_uses_primary_key_index(track_index_matches)) {  // DATA JOIN using the PrimaryKeyIndex
+    _join_using_primary_key_index(track_probe_matches, is_semi_or_anti_join);
+    _append_matches_non_inner(is_semi_or_anti_join);
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
@@ -254,6 +258,50 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   return _build_output_table({std::make_shared<Chunk>(output_segments)});
 }
 
+bool JoinIndex::_uses_primary_key_index(const bool track_index_matches) const {
+  // The matches of the index side are tracked per chunk, which the PrimaryKeyIndex does not provide
+  if (track_index_matches || _index_input_table->type() != TableType::Data) return false;
+
+  const auto primary_key_index = _index_input_table->primary_key_index();
+  return primary_key_index && _adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+         _adjusted_primary_predicate.column_ids.second == primary_key_index->column_id();
+}
+
+void JoinIndex::_join_using_primary_key_index(const bool track_probe_matches, const bool is_semi_or_anti_join) {
+  const auto& primary_key_index = *_index_input_table->primary_key_index();
+  const auto context = transaction_context();
+  auto index_matches = PosList{};
+
+  const auto chunk_count = _probe_input_table->chunk_count();
+  for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
+    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
+
+    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+    segment_iterate(*probe_segment, [&](const auto& probe_side_position) {
+      if (probe_side_position.is_null()) return;
+
+      index_matches.clear();
+      primary_key_index.lookup(*_index_input_table, probe_side_position.value(), context, index_matches);
+      if (index_matches.empty()) return;
+
+      const auto probe_row_id = RowID{probe_chunk_id, probe_side_position.chunk_offset()};
+      if (track_probe_matches) {
+        _probe_matches[probe_chunk_id][probe_row_id.chunk_offset] = true;
+      }
+
+      // Semi and anti joins write their output based on _probe_matches, see _append_matches_non_inner()
+      if (is_semi_or_anti_join) return;
+
+      std::fill_n(std::back_inserter(*_probe_pos_list), index_matches.size(), probe_row_id);
+      _index_pos_list->insert(_index_pos_list->end(), index_matches.begin(), index_matches.end());
+    });
+  }
+
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  performance_data.chunks_scanned_with_index += _index_input_table->chunk_count();
+}
+
 void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
                                       const bool track_index_matches, const bool is_semi_or_anti_join,
                                       MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
@@ -27,6 +27,11 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * Equi-joins on the column of the PrimaryKeyIndex of a data table on the index side probe that index once per probe
+   * side row instead of the indexes of all chunks, unless the unmatched index side rows are needed for the output
+   * (e.g., for JoinMode::FullOuter). If a transaction context is set, only index side rows visible to the transaction
+   * are matched in that case.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -54,6 +59,9 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
+  bool _uses_primary_key_index(const bool track_index_matches) const;
+  void _join_using_primary_key_index(const bool track_probe_matches, const bool is_semi_or_anti_join);
+
   void _fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
                              const bool track_index_matches, const bool is_semi_or_anti_join,
                              MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
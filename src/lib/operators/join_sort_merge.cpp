@@ -1,9 +1,10 @@
 #include "join_sort_merge.hpp"
 
 #include <algorithm>
-#include <map>
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -120,9 +121,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   const JoinMode _mode;
 
   const std::vector<OperatorJoinPredicate>& _secondary_join_predicates;
-  // these are used for outer joins where the primary predicate is not Equals.
-  std::map<RowID, bool> _left_row_ids_emitted{};
-  std::map<RowID, bool> _right_row_ids_emitted{};
+
+  // These are used for outer joins with secondary predicates where the primary predicate is not Equals. For each entry
+  // of the sorted tables (by cluster and index), they track whether the entry has been emitted with a join partner.
+  // As the ranges joined by one cluster span other clusters as well, the flags are set concurrently.
+  using MatchFlags = std::vector<std::vector<std::atomic<bool>>>;
+  MatchFlags _left_entries_matched;
+  MatchFlags _right_entries_matched;
 
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   size_t _cluster_count;
@@ -160,17 +165,33 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     TablePosition start;
     TablePosition end;
 
-    // Executes the given action for every row id of the table in this range.
+    // Executes the given action for every entry of the table in this range, passing its cluster, its index within
+    // the cluster, and its row id.
     template <typename F>
-    void for_every_row_id(std::unique_ptr<MaterializedSegmentList<T>>& table, F action) {
+    void for_every_entry(std::unique_ptr<MaterializedSegmentList<T>>& table, F action) {
       for (size_t cluster = start.cluster; cluster <= end.cluster; ++cluster) {
         size_t start_index = (cluster == start.cluster) ? start.index : 0;
         size_t end_index = (cluster == end.cluster) ? end.index : (*table)[cluster]->size();
         for (size_t index = start_index; index < end_index; ++index) {
-          action((*(*table)[cluster])[index].row_id);
+          action(cluster, index, (*(*table)[cluster])[index].row_id);
         }
       }
     }
+
+    // Executes the given action for every row id of the table in this range.
+    template <typename F>
+    void for_every_row_id(std::unique_ptr<MaterializedSegmentList<T>>& table, F action) {
+      for_every_entry(table, [&](size_t /*cluster*/, size_t /*index*/, RowID row_id) { action(row_id); });
+    }
+
+    // Returns the part of this range that lies within the given cluster (which may be empty).
+    TableRange intersect_cluster(std::unique_ptr<MaterializedSegmentList<T>>& table, size_t cluster) const {
+      if (cluster < start.cluster || cluster > end.cluster) return TableRange(cluster, 0, 0);
+
+      size_t start_index = (cluster == start.cluster) ? start.index : 0;
+      size_t end_index = (cluster == end.cluster) ? end.index : (*table)[cluster]->size();
+      return TableRange(cluster, start_index, std::max(start_index, end_index));
+    }
   };
 
   /**
@@ -349,12 +370,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       });
     } else {
       // primary predicate is <, <=, >, or >=
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        _left_row_ids_emitted.emplace(left_row_id, false);
+      left_range.for_every_entry(_sorted_left_table, [&](size_t left_cluster, size_t left_index, RowID left_row_id) {
         right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
           if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
             _emit_combination(output_cluster, left_row_id, right_row_id);
-            _left_row_ids_emitted[left_row_id] = true;
+            _left_entries_matched[left_cluster][left_index].store(true, std::memory_order_relaxed);
           }
         });
       });
@@ -385,12 +405,12 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       });
     } else {
       // primary predicate is <, <=, >, or >=
-      right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        _right_row_ids_emitted.emplace(right_row_id, false);
+      right_range.for_every_entry(_sorted_right_table, [&](size_t right_cluster, size_t right_index,
+                                                           RowID right_row_id) {
         left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
           if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
             _emit_combination(output_cluster, left_row_id, right_row_id);
-            _right_row_ids_emitted[right_row_id] = true;
+            _right_entries_matched[right_cluster][right_index].store(true, std::memory_order_relaxed);
           }
         });
       });
@@ -431,16 +451,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
         }
       });
     } else {
-      left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        // If left_row_id not yet in _left_row_ids_emitted, this initializes it to false
-        _left_row_ids_emitted[left_row_id];
-        right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-          // If right_row_id not yet in _right_row_id_has_match, this initializes it to false
-          _right_row_ids_emitted[right_row_id];
+      left_range.for_every_entry(_sorted_left_table, [&](size_t left_cluster, size_t left_index, RowID left_row_id) {
+        right_range.for_every_entry(_sorted_right_table, [&](size_t right_cluster, size_t right_index,
+                                                             RowID right_row_id) {
           if (multi_predicate_join_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
             _emit_combination(output_cluster, left_row_id, right_row_id);
-            _left_row_ids_emitted[left_row_id] = true;
-            _right_row_ids_emitted[right_row_id] = true;
+            _left_entries_matched[left_cluster][left_index].store(true, std::memory_order_relaxed);
+            _right_entries_matched[right_cluster][right_index].store(true, std::memory_order_relaxed);
           }
         });
       });
@@ -627,16 +644,15 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   }
 
   /**
-  * Adds the rows without matches for right outer joins for non-equi operators (<, <=, >, >=).
-  * This method adds those rows from the right table to the output that do not find a join partner.
+  * Determines the range of the sorted right table whose rows do not satisfy the primary predicate for any left row.
+  * Used for right outer joins for non-equi operators (<, <=, >, >=) without secondary predicates.
   * The outer join for the equality operator is handled in _join_runs instead.
   **/
-  void _right_outer_non_equi_join() {
+  std::optional<TableRange> _unmatched_right_range() {
     auto end_of_right_table = _end_of_table(_sorted_right_table);
 
     if (_sort_merge_join.input_table_left()->row_count() == 0) {
-      _emit_left_primary_null_combinations(0, TablePosition(0, 0).to(end_of_right_table));
-      return;
+      return TablePosition(0, 0).to(end_of_right_table);
     }
 
     auto& left_min_value = _table_min_value(_sorted_left_table);
@@ -674,34 +690,19 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       }
     }
 
-    if (unmatched_range) {
-      _emit_left_primary_null_combinations(0, *unmatched_range);
-      unmatched_range->for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        // Mark as emitted so that it doesn't get emitted again below
-        _right_row_ids_emitted[right_row_id] = true;
-      });
-    }
-
-    // Add null-combinations for right row ids where the primary predicate was satisfied but the
-    // secondary predicates were not.
-    for (const auto& right_row_id : _right_row_ids_emitted) {
-      if (!right_row_id.second) {
-        _emit_combination(0, NULL_ROW_ID, right_row_id.first);
-      }
-    }
+    return unmatched_range;
   }
 
   /**
-    * Adds the rows without matches for left outer joins for non-equi operators (<, <=, >, >=).
-    * This method adds those rows from the left table to the output that do not find a join partner.
+    * Determines the range of the sorted left table whose rows do not satisfy the primary predicate for any right row.
+    * Used for left outer joins for non-equi operators (<, <=, >, >=) without secondary predicates.
     * The outer join for the equality operator is handled in _join_runs instead.
     **/
-  void _left_outer_non_equi_join() {
+  std::optional<TableRange> _unmatched_left_range() {
     auto end_of_left_table = _end_of_table(_sorted_left_table);
 
     if (_sort_merge_join.input_table_right()->row_count() == 0) {
-      _emit_right_primary_null_combinations(0, TablePosition(0, 0).to(end_of_left_table));
-      return;
+      return TablePosition(0, 0).to(end_of_left_table);
     }
 
     auto& right_min_value = _table_min_value(_sorted_right_table);
@@ -739,20 +740,40 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
       }
     }
 
-    if (unmatched_range) {
-      _emit_right_primary_null_combinations(0, *unmatched_range);
-      unmatched_range->for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
-        // Mark as emitted so that it doesn't get emitted again below
-        _left_row_ids_emitted[left_row_id] = true;
-      });
+    return unmatched_range;
+  }
+
+  /**
+  * Creates a (false) match flag for every entry of a sorted table, see _left_entries_matched.
+  **/
+  static MatchFlags _create_match_flags(std::unique_ptr<MaterializedSegmentList<T>>& sorted_table) {
+    auto match_flags = MatchFlags(sorted_table->size());
+    for (size_t cluster = 0; cluster < sorted_table->size(); ++cluster) {
+      match_flags[cluster] = std::vector<std::atomic<bool>>((*sorted_table)[cluster]->size());
     }
+    return match_flags;
+  }
 
-    // Add null-combinations for left row ids where the primary predicate was satisfied but the
-    // secondary predicates were not.
-    for (const auto& left_row_id : _left_row_ids_emitted) {
-      if (!left_row_id.second) {
-        _emit_combination(0, left_row_id.first, NULL_ROW_ID);
+  /**
+  * Passes the row ids of a cluster of the outer table that did not find a join partner to emit. Used for outer joins
+  * for non-equi operators (<, <=, >, >=). Without secondary predicates, these are the rows in unmatched_range. With
+  * secondary predicates, rows that satisfy the primary predicate might still be left without a partner, so all rows
+  * whose match flag has not been set are passed (which includes the rows that would be in unmatched_range).
+  **/
+  template <typename F>
+  void _for_every_unmatched_row_id(size_t cluster, std::unique_ptr<MaterializedSegmentList<T>>& sorted_table,
+                                   const MatchFlags& entries_matched, const std::optional<TableRange>& unmatched_range,
+                                   F emit) {
+    if (!_secondary_join_predicates.empty()) {
+      const auto& sorted_cluster = *(*sorted_table)[cluster];
+      const auto& cluster_entries_matched = entries_matched[cluster];
+      for (size_t index = 0; index < sorted_cluster.size(); ++index) {
+        if (!cluster_entries_matched[index].load(std::memory_order_relaxed)) {
+          emit(sorted_cluster[index].row_id);
+        }
       }
+    } else if (unmatched_range) {
+      unmatched_range->intersect_cluster(sorted_table, cluster).for_every_row_id(sorted_table, emit);
     }
   }
 
@@ -760,6 +781,16 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   * Performs the join on all clusters in parallel.
   **/
   void _perform_join() {
+    const auto left_outer_non_equi = (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) &&
+                                     _primary_predicate_condition != PredicateCondition::Equals;
+    const auto right_outer_non_equi = (_mode == JoinMode::Right || _mode == JoinMode::FullOuter) &&
+                                      _primary_predicate_condition != PredicateCondition::Equals;
+
+    if (!_secondary_join_predicates.empty()) {
+      if (left_outer_non_equi) _left_entries_matched = _create_match_flags(_sorted_left_table);
+      if (right_outer_non_equi) _right_entries_matched = _create_match_flags(_sorted_right_table);
+    }
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
     // Parallel join for each cluster
@@ -792,51 +823,77 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
     // The outer joins for the non-equi cases
-    // Note: Equi outer joins can be integrated into the main algorithm, while these can not.
-    if ((_mode == JoinMode::Left || _mode == JoinMode::FullOuter) &&
-        _primary_predicate_condition != PredicateCondition::Equals) {
-      _left_outer_non_equi_join();
+    // Note: Equi outer joins can be integrated into the main algorithm, while these can not. Whether a row has found a
+    // join partner is only known once all clusters have been joined, so the unmatched rows are added in a second pass,
+    // again with one job per cluster.
+    if (!left_outer_non_equi && !right_outer_non_equi) return;
+
+    auto unmatched_left_range = std::optional<TableRange>{};
+    auto unmatched_right_range = std::optional<TableRange>{};
+    if (_secondary_join_predicates.empty()) {
+      if (left_outer_non_equi) unmatched_left_range = _unmatched_left_range();
+      if (right_outer_non_equi) unmatched_right_range = _unmatched_right_range();
     }
-    if ((_mode == JoinMode::Right || _mode == JoinMode::FullOuter) &&
-        _primary_predicate_condition != PredicateCondition::Equals) {
-      _right_outer_non_equi_join();
+
+    jobs.clear();
+    for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
+      jobs.push_back(std::make_shared<JobTask>([&, cluster_number] {
+        if (left_outer_non_equi) {
+          _for_every_unmatched_row_id(
+              cluster_number, _sorted_left_table, _left_entries_matched, unmatched_left_range,
+              [&](RowID left_row_id) { _emit_combination(cluster_number, left_row_id, NULL_ROW_ID); });
+        }
+        if (right_outer_non_equi) {
+          _for_every_unmatched_row_id(
+              cluster_number, _sorted_right_table, _right_entries_matched, unmatched_right_range,
+              [&](RowID right_row_id) { _emit_combination(cluster_number, NULL_ROW_ID, right_row_id); });
+        }
+      }));
+      jobs.back()->schedule();
     }
+
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
   }
 
   /**
-  * Concatenates a vector of pos lists into a single new pos list.
+  * Collects the pos lists of all reference segments of a table, by column and chunk, so that the segments only have to
+  * be pointer cast once. Returns an empty vector for data tables.
   **/
-  std::shared_ptr<PosList> _concatenate_pos_lists(std::vector<std::shared_ptr<PosList>>& pos_lists) {
-    auto output = std::make_shared<PosList>();
-
-    // Determine the required space
-    size_t total_size = 0;
-    for (auto& pos_list : pos_lists) {
-      total_size += pos_list->size();
-    }
-
-    // Move the entries over the output pos list
-    output->reserve(total_size);
-    for (auto& pos_list : pos_lists) {
-      output->insert(output->end(), pos_list->begin(), pos_list->end());
+  std::vector<std::vector<std::shared_ptr<const PosList>>> _input_pos_lists_by_column(
+      const std::shared_ptr<const Table>& input_table) {
+    auto input_pos_lists_by_column = std::vector<std::vector<std::shared_ptr<const PosList>>>{};
+    if (input_table->type() != TableType::References) return input_pos_lists_by_column;
+
+    const auto column_count = input_table->column_count();
+    const auto chunk_count = input_table->chunk_count();
+    input_pos_lists_by_column.resize(column_count);
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      auto& input_pos_lists = input_pos_lists_by_column[column_id];
+      input_pos_lists.reserve(chunk_count);
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+        auto base_segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+        auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(base_segment);
+        input_pos_lists.push_back(reference_segment->pos_list());
+      }
     }
 
-    return output;
+    return input_pos_lists_by_column;
   }
 
   /**
   * Adds the segments from an input table to the output table
   **/
   void _add_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
+                            const std::vector<std::vector<std::shared_ptr<const PosList>>>& input_pos_lists_by_column,
                             const std::shared_ptr<const PosList>& pos_list) {
     auto column_count = input_table->column_count();
     for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
       // Add the segment data (in the form of a poslist)
       if (input_table->type() == TableType::References) {
-        // Create a pos_list referencing the original segment instead of the reference segment
-        auto new_pos_list = _dereference_pos_list(input_table, column_id, pos_list);
-
         if (input_table->chunk_count() > 0) {
+          // Create a pos_list referencing the original segment instead of the reference segment
+          auto new_pos_list = _dereference_pos_list(input_pos_lists_by_column[column_id], pos_list);
+
           const auto base_segment = input_table->get_chunk(ChunkID{0})->get_segment(column_id);
           const auto ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(base_segment);
 
@@ -862,18 +919,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   * Turns a pos list that is pointing to reference segment entries into a pos list pointing to the original table.
   * This is done because there should not be any reference segments referencing reference segments.
   **/
-  std::shared_ptr<PosList> _dereference_pos_list(const std::shared_ptr<const Table>& input_table, ColumnID column_id,
+  std::shared_ptr<PosList> _dereference_pos_list(const std::vector<std::shared_ptr<const PosList>>& input_pos_lists,
                                                  const std::shared_ptr<const PosList>& pos_list) {
-    // Get all the input pos lists so that we only have to pointer cast the segments once
-    auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>();
-    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-      auto base_segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
-      auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(base_segment);
-      input_pos_lists.push_back(reference_segment->pos_list());
-    }
-
     // Get the row ids that are referenced
     auto new_pos_list = std::make_shared<PosList>();
+    new_pos_list->reserve(pos_list->size());
     for (const auto& row : *pos_list) {
       if (row.is_null()) {
         new_pos_list->push_back(NULL_ROW_ID);
@@ -907,31 +957,63 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
 
     _perform_join();
 
-    // merge the pos lists into single pos lists
-    auto output_left = _concatenate_pos_lists(_output_pos_lists_left);
-    auto output_right = _concatenate_pos_lists(_output_pos_lists_right);
-
-    // Add the outer join rows which had a null value in their join column
-    if (include_null_left) {
-      for (auto row_id_left : *_null_rows_left) {
-        output_left->push_back(row_id_left);
-        output_right->push_back(NULL_ROW_ID);
+    // Add the outer join rows which had a null value in their join column as an additional output chunk
+    if (include_null_left || include_null_right) {
+      auto null_pos_list_left = std::make_shared<PosList>();
+      auto null_pos_list_right = std::make_shared<PosList>();
+      const auto null_row_count = (include_null_left ? _null_rows_left->size() : size_t{0}) +
+                                  (include_null_right ? _null_rows_right->size() : size_t{0});
+      null_pos_list_left->reserve(null_row_count);
+      null_pos_list_right->reserve(null_row_count);
+
+      if (include_null_left) {
+        for (auto row_id_left : *_null_rows_left) {
+          null_pos_list_left->push_back(row_id_left);
+          null_pos_list_right->push_back(NULL_ROW_ID);
+        }
       }
-    }
-    if (include_null_right) {
-      for (auto row_id_right : *_null_rows_right) {
-        output_left->push_back(NULL_ROW_ID);
-        output_right->push_back(row_id_right);
+      if (include_null_right) {
+        for (auto row_id_right : *_null_rows_right) {
+          null_pos_list_left->push_back(NULL_ROW_ID);
+          null_pos_list_right->push_back(row_id_right);
+        }
       }
+
+      _output_pos_lists_left.emplace_back(std::move(null_pos_list_left));
+      _output_pos_lists_right.emplace_back(std::move(null_pos_list_right));
     }
 
-    // Add the segments from both input tables to the output
-    Segments output_segments;
-    _add_output_segments(output_segments, _sort_merge_join.input_table_left(), output_left);
-    _add_output_segments(output_segments, _sort_merge_join.input_table_right(), output_right);
+    // Each cluster becomes an output chunk of its own, so that the pos lists do not have to be concatenated and the
+    // chunks (including the dereferencing of reference inputs) can be written in parallel.
+    const auto& input_table_left = _sort_merge_join.input_table_left();
+    const auto& input_table_right = _sort_merge_join.input_table_right();
+    const auto input_pos_lists_left = _input_pos_lists_by_column(input_table_left);
+    const auto input_pos_lists_right = _input_pos_lists_by_column(input_table_right);
+
+    const auto output_chunk_count = _output_pos_lists_left.size();
+    auto output_chunks = std::vector<std::shared_ptr<Chunk>>(output_chunk_count);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (size_t output_chunk_id = 0; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+      // Avoid empty output chunks
+      if (_output_pos_lists_left[output_chunk_id]->empty()) continue;
+
+      jobs.push_back(std::make_shared<JobTask>([&, output_chunk_id] {
+        // Add the segments from both input tables to the output
+        Segments output_segments;
+        _add_output_segments(output_segments, input_table_left, input_pos_lists_left,
+                             _output_pos_lists_left[output_chunk_id]);
+        _add_output_segments(output_segments, input_table_right, input_pos_lists_right,
+                             _output_pos_lists_right[output_chunk_id]);
+        output_chunks[output_chunk_id] = std::make_shared<Chunk>(output_segments);
+      }));
+      jobs.back()->schedule();
+    }
+
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-    // Build the output_table with one Chunk
-    return _sort_merge_join._build_output_table({std::make_shared<Chunk>(output_segments)});
+    output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+    return _sort_merge_join._build_output_table(std::move(output_chunks));
   }
 };
 
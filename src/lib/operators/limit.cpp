@@ -14,8 +14,11 @@
 namespace opossum {
 
 Limit::Limit(const std::shared_ptr<const AbstractOperator>& in,
-             const std::shared_ptr<AbstractExpression>& row_count_expression)
-    : AbstractReadOnlyOperator(OperatorType::Limit, in), _row_count_expression(row_count_expression) {}
+             const std::shared_ptr<AbstractExpression>& row_count_expression,
+             const std::shared_ptr<AbstractExpression>& offset_expression)
+    : AbstractReadOnlyOperator(OperatorType::Limit, in),
+      _row_count_expression(row_count_expression),
+      _offset_expression(offset_expression) {}
 
 const std::string& Limit::name() const {
   static const auto name = std::string{"Limit"};
@@ -24,26 +27,17 @@ const std::string& Limit::name() const {
 
 std::shared_ptr<AbstractExpression> Limit::row_count_expression() const { return _row_count_expression; }
 
-std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
-    const std::shared_ptr<AbstractOperator>& copied_input_left,
-    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Limit>(copied_input_left, _row_count_expression->deep_copy());
-}
-
-std::shared_ptr<const Table> Limit::_on_execute() {
-  const auto input_table = input_table_left();
+std::shared_ptr<AbstractExpression> Limit::offset_expression() const { return _offset_expression; }
 
-  /**
-   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to
-   */
+size_t Limit::evaluate_row_count_expression(const AbstractExpression& expression) {
   auto num_rows = size_t{};
 
-  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+  resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
     using LimitDataType = typename decltype(data_type_t)::type;
 
     if constexpr (std::is_integral_v<LimitDataType>) {
       const auto num_rows_expression_result =
-          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(*_row_count_expression);
+          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(expression);
       Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for Limit");
       Assert(!num_rows_expression_result->is_null(0), "Expected non-null for Limit");
 
@@ -56,6 +50,26 @@ std::shared_ptr<const Table> Limit::_on_execute() {
     }
   });
 
+  return num_rows;
+}
+
+std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Limit>(copied_input_left, _row_count_expression->deep_copy(),
+                                 _offset_expression ? _offset_expression->deep_copy() : nullptr);
+}
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = input_table_left();
+
+  /**
+   * Evaluate the _row_count_expression to determine the actual number of rows to "Limit" the output to and the
+   * _offset_expression to determine how many rows to skip before that
+   */
+  const auto num_rows = evaluate_row_count_expression(*_row_count_expression);
+  auto num_skipped_rows = _offset_expression ? evaluate_row_count_expression(*_offset_expression) : size_t{0};
+
   /**
    * Perform the actual limitting
    */
@@ -67,9 +81,18 @@ std::shared_ptr<const Table> Limit::_on_execute() {
     const auto input_chunk = input_table->get_chunk(chunk_id);
     Assert(input_chunk, "Did not expect deleted chunk here.");  // see #1686
 
+    // Skip chunks (or the beginning of a chunk) that are covered by the offset
+    const auto chunk_size = static_cast<size_t>(input_chunk->size());
+    if (num_skipped_rows >= chunk_size) {
+      num_skipped_rows -= chunk_size;
+      continue;
+    }
+    const auto first_chunk_offset = static_cast<ChunkOffset>(num_skipped_rows);
+    num_skipped_rows = 0;
+
     Segments output_segments;
 
-    size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), num_rows - i);
+    size_t output_chunk_row_count = std::min<size_t>(chunk_size - first_chunk_offset, num_rows - i);
 
     for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
       const auto input_base_segment = input_chunk->get_segment(column_id);
@@ -81,13 +104,13 @@ std::shared_ptr<const Table> Limit::_on_execute() {
         output_column_id = input_ref_segment->referenced_column_id();
         referenced_table = input_ref_segment->referenced_table();
         // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_segment->pos_list()->begin();
+        auto begin = input_ref_segment->pos_list()->begin() + first_chunk_offset;
         std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
       } else {
         referenced_table = input_table;
         for (ChunkOffset chunk_offset = 0; chunk_offset < static_cast<ChunkOffset>(output_chunk_row_count);
              chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+          (*output_pos_list)[chunk_offset] = RowID{chunk_id, first_chunk_offset + chunk_offset};
         }
       }
 
@@ -104,10 +127,12 @@ std::shared_ptr<const Table> Limit::_on_execute() {
 
 void Limit::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   expression_set_parameters(_row_count_expression, parameters);
+  if (_offset_expression) expression_set_parameters(_offset_expression, parameters);
 }
 
 void Limit::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
   expression_set_transaction_context(_row_count_expression, transaction_context);
+  if (_offset_expression) expression_set_transaction_context(_offset_expression, transaction_context);
 }
 
 }  // namespace opossum
@@ -8,16 +8,23 @@
 #include "expression/abstract_expression.hpp"
 
 namespace opossum {
-// operator to limit the input to n rows
+// operator to limit the input to n rows, optionally skipping the first m rows (LIMIT n OFFSET m)
 class Limit : public AbstractReadOnlyOperator {
  public:
   Limit(const std::shared_ptr<const AbstractOperator>& in,
-        const std::shared_ptr<AbstractExpression>& row_count_expression);
+        const std::shared_ptr<AbstractExpression>& row_count_expression,
+        const std::shared_ptr<AbstractExpression>& offset_expression = nullptr);
 
   const std::string& name() const override;
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  // nullptr if no offset was given
+  std::shared_ptr<AbstractExpression> offset_expression() const;
+
+  // Evaluates an uncorrelated expression that yields the (non-negative) number of rows in a LIMIT or OFFSET clause
+  static size_t evaluate_row_count_expression(const AbstractExpression& expression);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -29,5 +36,6 @@ class Limit : public AbstractReadOnlyOperator {
 
  private:
   std::shared_ptr<AbstractExpression> _row_count_expression;
+  std::shared_ptr<AbstractExpression> _offset_expression;
 };
 }  // namespace opossum
@@ -72,6 +72,21 @@ std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
   return std::make_shared<CreateTable>(table_name, if_not_exists, _input_left);
 }
 
+void CreateTable::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // Nothing to log if the table existed already
+  if (!_insert) return;
+
+  const auto& column_definitions = input_table_left()->column_definitions();
+  log_entry.write(LogRecordType::CreateTable);
+  log_entry.write(table_name);
+  log_entry.write(static_cast<uint16_t>(column_definitions.size()));
+  for (const auto& column_definition : column_definitions) {
+    log_entry.write(column_definition.name);
+    log_entry.write(column_definition.data_type);
+    log_entry.write(column_definition.nullable);
+  }
+}
+
 void CreateTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   // No parameters possible for CREATE TABLE
 }
@@ -33,6 +33,9 @@ class CreateTable : public AbstractReadWriteOperator {
   // Rollback happens in Insert operator
   void _on_rollback_records() override {}
 
+  // Only the table is logged, the inserted rows are logged by the Insert operator
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
+
   std::shared_ptr<Insert> _insert;
 };
 }  // namespace opossum
@@ -0,0 +1,277 @@
+#include "row_key_store.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Combined into the hash of a row for each NULL value. Collisions with actual values are resolved by comparing rows.
+constexpr auto NULL_VALUE_HASH = size_t{0x9e3779b97f4a7c15};
+
+template <typename ColumnDataType>
+class RowKeyColumn : public BaseRowKeyColumn {
+ public:
+  bool value_equals(const size_t row_index, const BaseRowKeyColumn& other,
+                    const size_t other_row_index) const override {
+    const auto& other_column = static_cast<const RowKeyColumn<ColumnDataType>&>(other);
+    if (null_values[row_index] || other_column.null_values[other_row_index]) {
+      return null_values[row_index] && other_column.null_values[other_row_index];
+    }
+    return values[row_index] == other_column.values[other_row_index];
+  }
+
+  void append_value(const BaseRowKeyColumn& other, const size_t other_row_index) override {
+    const auto& other_column = static_cast<const RowKeyColumn<ColumnDataType>&>(other);
+    values.emplace_back(other_column.values[other_row_index]);
+    null_values.emplace_back(other_column.null_values[other_row_index]);
+  }
+
+  std::vector<ColumnDataType> values;
+  std::vector<bool> null_values;
+};
+
+// Writes the output chunk for the rows of a chunk of the left input that are part of the result. Segments that
+// reference the same PosList in the input share their PosList in the output as well.
+std::shared_ptr<Chunk> write_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                          const std::vector<ChunkOffset>& chunk_offsets) {
+  const auto chunk = input_table->get_chunk(chunk_id);
+  const auto column_count = input_table->column_count();
+
+  auto output_segments = Segments{};
+  output_segments.reserve(column_count);
+
+  // Maps the PosList of an input segment to the PosList of the output segment. For data tables, the key is nullptr.
+  auto output_pos_lists = std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto referenced_table = input_table;
+    auto referenced_column_id = column_id;
+    auto input_pos_list = std::shared_ptr<const PosList>{};
+
+    if (const auto reference_segment =
+            std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) {
+      referenced_table = reference_segment->referenced_table();
+      referenced_column_id = reference_segment->referenced_column_id();
+      input_pos_list = reference_segment->pos_list();
+    }
+
+    auto& output_pos_list = output_pos_lists[input_pos_list];
+    if (!output_pos_list) {
+      output_pos_list = std::make_shared<PosList>();
+      output_pos_list->reserve(chunk_offsets.size());
+      for (const auto chunk_offset : chunk_offsets) {
+        output_pos_list->emplace_back(input_pos_list ? (*input_pos_list)[chunk_offset] : RowID{chunk_id, chunk_offset});
+      }
+    }
+
+    output_segments.emplace_back(
+        std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list));
+  }
+
+  return std::make_shared<Chunk>(output_segments);
+}
+
+}  // namespace
+
+namespace opossum {
+
+RowKeys::RowKeys(const Table& table) {
+  const auto column_count = table.column_count();
+  _columns.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _columns.emplace_back(std::make_unique<RowKeyColumn<ColumnDataType>>());
+    });
+  }
+}
+
+RowKeys::RowKeys(const Table& table, const ChunkID chunk_id) : RowKeys(table) {
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
+
+  const auto row_count = chunk->size();
+  _hashes.resize(row_count);
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto& column = static_cast<RowKeyColumn<ColumnDataType>&>(*_columns[column_id]);
+      column.values.resize(row_count);
+      column.null_values.resize(row_count);
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        const auto row_index = position.chunk_offset();
+        if (position.is_null()) {
+          column.null_values[row_index] = true;
+          boost::hash_combine(_hashes[row_index], NULL_VALUE_HASH);
+        } else {
+          column.values[row_index] = position.value();
+          boost::hash_combine(_hashes[row_index], position.value());
+        }
+      });
+    });
+  }
+}
+
+size_t RowKeys::size() const { return _hashes.size(); }
+
+size_t RowKeys::hash(const size_t row_index) const { return _hashes[row_index]; }
+
+bool RowKeys::row_equals(const size_t row_index, const RowKeys& other, const size_t other_row_index) const {
+  DebugAssert(_columns.size() == other._columns.size(), "RowKeys have different numbers of columns");
+
+  const auto column_count = _columns.size();
+  for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+    if (!_columns[column_index]->value_equals(row_index, *other._columns[column_index], other_row_index)) return false;
+  }
+  return true;
+}
+
+void RowKeys::append_row(const RowKeys& other, const size_t other_row_index) {
+  _hashes.emplace_back(other._hashes[other_row_index]);
+
+  const auto column_count = _columns.size();
+  for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+    _columns[column_index]->append_value(*other._columns[column_index], other_row_index);
+  }
+}
+
+RowKeyStore::RowKeyStore(const std::shared_ptr<const Table>& table) : _distinct_rows(*table) {
+  const auto chunk_count = table->chunk_count();
+
+  // Materialize and hash the rows of each chunk in parallel
+  auto row_keys_per_chunk = std::vector<std::unique_ptr<RowKeys>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      row_keys_per_chunk[chunk_id] = std::make_unique<RowKeys>(*table, chunk_id);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  for (const auto& row_keys : row_keys_per_chunk) {
+    const auto row_count = row_keys->size();
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      const auto distinct_row_id = find(*row_keys, row_index);
+      if (distinct_row_id != INVALID_DISTINCT_ROW_ID) {
+        ++_counts[distinct_row_id];
+        continue;
+      }
+
+      const auto new_distinct_row_id = _distinct_rows.size();
+      _distinct_rows.append_row(*row_keys, row_index);
+      _counts.emplace_back(1);
+
+      auto [iter, inserted] = _distinct_row_ids_by_hash.try_emplace(row_keys->hash(row_index), new_distinct_row_id);
+      _next_distinct_row_ids.emplace_back(inserted ? INVALID_DISTINCT_ROW_ID : iter->second);
+      iter->second = new_distinct_row_id;
+    }
+  }
+}
+
+size_t RowKeyStore::find(const RowKeys& row_keys, const size_t row_index) const {
+  const auto iter = _distinct_row_ids_by_hash.find(row_keys.hash(row_index));
+  if (iter == _distinct_row_ids_by_hash.end()) return INVALID_DISTINCT_ROW_ID;
+
+  for (auto distinct_row_id = iter->second; distinct_row_id != INVALID_DISTINCT_ROW_ID;
+       distinct_row_id = _next_distinct_row_ids[distinct_row_id]) {
+    if (_distinct_rows.row_equals(distinct_row_id, row_keys, row_index)) return distinct_row_id;
+  }
+  return INVALID_DISTINCT_ROW_ID;
+}
+
+size_t RowKeyStore::count(const size_t distinct_row_id) const { return _counts[distinct_row_id]; }
+
+size_t RowKeyStore::distinct_row_count() const { return _distinct_rows.size(); }
+
+std::shared_ptr<const Table> execute_set_operation(const std::shared_ptr<const Table>& left_table,
+                                                   const std::shared_ptr<const Table>& right_table,
+                                                   const SetOperationMode mode, const bool emit_matching_rows) {
+  DebugAssert(left_table->column_definitions() == right_table->column_definitions(),
+              "Input tables must have the same column definitions");
+
+  const auto row_key_store = RowKeyStore{right_table};
+  const auto chunk_count = left_table->chunk_count();
+
+  // For each row of the left input, find the id of the equal distinct row of the right input (if any)
+  auto distinct_row_ids_per_chunk = std::vector<std::vector<size_t>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto row_keys = RowKeys{*left_table, chunk_id};
+      const auto row_count = row_keys.size();
+
+      auto& distinct_row_ids = distinct_row_ids_per_chunk[chunk_id];
+      distinct_row_ids.resize(row_count);
+      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+        distinct_row_ids[row_index] = row_key_store.find(row_keys, row_index);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  if (mode == SetOperationMode::All) {
+    // Every right row matches only one left row. As the left rows are visited in order, the first occurrences of a row
+    // are the ones that match. This pass is cheap compared to the hashing above and is thus not parallelized.
+    auto remaining_counts = std::vector<size_t>(row_key_store.distinct_row_count());
+    for (auto distinct_row_id = size_t{0}; distinct_row_id < remaining_counts.size(); ++distinct_row_id) {
+      remaining_counts[distinct_row_id] = row_key_store.count(distinct_row_id);
+    }
+
+    for (auto& distinct_row_ids : distinct_row_ids_per_chunk) {
+      for (auto& distinct_row_id : distinct_row_ids) {
+        if (distinct_row_id == RowKeyStore::INVALID_DISTINCT_ROW_ID) continue;
+
+        if (remaining_counts[distinct_row_id] > 0) {
+          --remaining_counts[distinct_row_id];
+        } else {
+          distinct_row_id = RowKeyStore::INVALID_DISTINCT_ROW_ID;
+        }
+      }
+    }
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& distinct_row_ids = distinct_row_ids_per_chunk[chunk_id];
+
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < distinct_row_ids.size(); ++chunk_offset) {
+      const auto has_match = distinct_row_ids[chunk_offset] != RowKeyStore::INVALID_DISTINCT_ROW_ID;
+      if (has_match == emit_matching_rows) chunk_offsets.emplace_back(chunk_offset);
+    }
+
+    // Only add chunk if it would contain any tuples
+    if (!chunk_offsets.empty()) {
+      output_chunks.emplace_back(write_output_chunk(left_table, chunk_id, chunk_offsets));
+    }
+  }
+
+  return std::make_shared<Table>(left_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "bytell_hash_map.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Type-erased column of RowKeys, see RowKeyColumn<ColumnDataType> in row_key_store.cpp
+class BaseRowKeyColumn {
+ public:
+  virtual ~BaseRowKeyColumn() = default;
+
+  virtual bool value_equals(const size_t row_index, const BaseRowKeyColumn& other,
+                            const size_t other_row_index) const = 0;
+  virtual void append_value(const BaseRowKeyColumn& other, const size_t other_row_index) = 0;
+};
+
+/**
+ * The values of a set of rows, stored column by column, together with a hash of each row. The hashes are computed
+ * column by column, so that the type of a column only has to be resolved once.
+ *
+ * RowKeys are used to find equal rows in two tables with the same column types. Two rows are equal if all of their
+ * values are equal. Unlike in predicates, NULL equals NULL, as required for set operations.
+ */
+class RowKeys : private Noncopyable {
+ public:
+  // Creates empty keys for rows with the column types of table
+  explicit RowKeys(const Table& table);
+
+  // Materializes and hashes all rows of a chunk
+  RowKeys(const Table& table, const ChunkID chunk_id);
+
+  size_t size() const;
+  size_t hash(const size_t row_index) const;
+
+  // Returns true if the row at row_index equals the row at other_row_index of other
+  bool row_equals(const size_t row_index, const RowKeys& other, const size_t other_row_index) const;
+
+  void append_row(const RowKeys& other, const size_t other_row_index);
+
+ protected:
+  std::vector<size_t> _hashes;
+  std::vector<std::unique_ptr<BaseRowKeyColumn>> _columns;
+};
+
+/**
+ * Stores the distinct rows of a table in a compact, column-wise format and counts how often each of them occurs. The
+ * chunks are materialized and hashed in parallel, the distinct rows are then inserted sequentially. Rows with the
+ * same hash are chained, so that the hash map only holds one entry per hash.
+ */
+class RowKeyStore : private Noncopyable {
+ public:
+  static constexpr auto INVALID_DISTINCT_ROW_ID = std::numeric_limits<size_t>::max();
+
+  explicit RowKeyStore(const std::shared_ptr<const Table>& table);
+
+  // Returns the id of the distinct row that equals the row at row_index of row_keys, or INVALID_DISTINCT_ROW_ID
+  size_t find(const RowKeys& row_keys, const size_t row_index) const;
+
+  // Returns how often the distinct row occurs in the table
+  size_t count(const size_t distinct_row_id) const;
+
+  size_t distinct_row_count() const;
+
+ protected:
+  RowKeys _distinct_rows;
+  std::vector<size_t> _counts;
+
+  // Maps a hash to the most recently inserted distinct row with that hash. _next_distinct_row_ids holds the previous
+  // one (or INVALID_DISTINCT_ROW_ID) for each distinct row.
+  ska::bytell_hash_map<size_t, size_t> _distinct_row_ids_by_hash;
+  std::vector<size_t> _next_distinct_row_ids;
+};
+
+// Executes Difference (emit_matching_rows == false) or Intersect (emit_matching_rows == true). Returns references to
+// the rows of left_table that do (or do not) have an equal row in right_table, see SetOperationMode.
+std::shared_ptr<const Table> execute_set_operation(const std::shared_ptr<const Table>& left_table,
+                                                   const std::shared_ptr<const Table>& right_table,
+                                                   const SetOperationMode mode, const bool emit_matching_rows);
+
+}  // namespace opossum
@@ -1,12 +1,19 @@
 #include "sort.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "operators/sort/normalized_sort_keys.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
@@ -14,16 +21,19 @@
 
 namespace opossum {
 
-Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
            const size_t output_chunk_size)
     : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort column");
+}
 
-ColumnID Sort::column_id() const { return _column_id; }
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{SortColumnDefinition{column_id, order_by_mode}}, output_chunk_size) {}
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
 const std::string& Sort::name() const {
   static const auto name = std::string{"Sort"};
@@ -33,29 +43,18 @@ const std::string& Sort::name() const {
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
-}
-
-void Sort::_on_cleanup() { _impl.reset(); }
-
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
+// This class fulfills only the materialization task for a sorted list of RowIDs.
 class Sort::SortImplMaterializeOutput {
  public:
   // creates a new table with reference segments
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
+  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in, const std::shared_ptr<const PosList>& sorted_rows,
                             const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+      : _table_in(in), _output_chunk_size(output_chunk_size), _sorted_rows(sorted_rows) {}
 
   std::shared_ptr<Table> execute() {
     // First we create a new table as the output
@@ -64,11 +63,12 @@ class Sort::SortImplMaterializeOutput {
     // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
 
     // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input segment with a reference
-    // to the output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
+    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead, each output chunk
+    // is filled from its own range of the sorted RowIDs. As these ranges are independent of each other, the output
+    // chunks are materialized in parallel. For each column in a row we visit the input segment with a reference to the
+    // output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
     // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
+    const auto row_count_out = _sorted_rows->size();
 
     // Ceiling of integer division
     const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
@@ -78,75 +78,29 @@ class Sort::SortImplMaterializeOutput {
     // Vector of segments for each chunk
     std::vector<Segments> output_segments_by_chunk(chunk_count_out);
 
-    // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
-
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
-
-        auto chunk_it = output_segments_by_chunk.begin();
-        auto chunk_offset_out = 0u;
-
-        auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-        auto value_segment_null_vector = pmr_concurrent_vector<bool>();
-
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
-
-        auto segment_ptr_and_accessor_by_chunk_id =
-            std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
-                                                  std::shared_ptr<AbstractSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
-
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;
-
-          auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
-          auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
-          auto& accessor = segment_ptr_and_typed_ptr_pair.second;
-
-          if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
-            accessor = create_segment_accessor<ColumnDataType>(base_segment);
-          }
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(chunk_count_out);
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
-            const auto typed_value = accessor->access(chunk_offset);
-            const auto is_null = !typed_value;
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-            value_segment_null_vector.push_back(is_null);
-          } else {
-            const auto value = (*base_segment)[chunk_offset];
-            const auto is_null = variant_is_null(value);
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : boost::get<ColumnDataType>(value));
-            value_segment_null_vector.push_back(is_null);
-          }
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count_out; ++chunk_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+        const auto row_begin = chunk_index * _output_chunk_size;
+        const auto row_end = std::min(row_begin + _output_chunk_size, row_count_out);
 
-          ++chunk_offset_out;
-
-          // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
-            value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-            value_segment_null_vector = pmr_concurrent_vector<bool>();
-            ++chunk_it;
-          }
-        }
+        auto& segments = output_segments_by_chunk[chunk_index];
+        segments.reserve(output->column_count());
 
-        // Last segment has not been added
-        if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
+        for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
+          resolve_data_type(output->column_data_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            segments.push_back(_materialize_segment<ColumnDataType>(column_id, row_begin, row_end));
+          });
         }
-      });
+      }));
+      jobs.back()->schedule();
     }
 
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
     for (auto& segments : output_segments_by_chunk) {
       output->append_chunk(segments);
     }
@@ -155,106 +109,245 @@ class Sort::SortImplMaterializeOutput {
   }
 
  protected:
+  // Materializes the values of the given column for the output rows [row_begin, row_end)
+  template <typename ColumnDataType>
+  std::shared_ptr<BaseSegment> _materialize_segment(const ColumnID column_id, const size_t row_begin,
+                                                    const size_t row_end) {
+    auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
+    auto value_segment_null_vector = pmr_concurrent_vector<bool>();
+
+    value_segment_value_vector.reserve(row_end - row_begin);
+    value_segment_null_vector.reserve(row_end - row_begin);
+
+    auto segment_ptr_and_accessor_by_chunk_id =
+        std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
+                                              std::shared_ptr<AbstractSegmentAccessor<ColumnDataType>>>>();
+
+    for (auto row_index = row_begin; row_index < row_end; ++row_index) {
+      const auto [chunk_id, chunk_offset] = (*_sorted_rows)[row_index];
+
+      auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
+      auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
+      auto& accessor = segment_ptr_and_typed_ptr_pair.second;
+
+      if (!base_segment) {
+        base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
+        accessor = create_segment_accessor<ColumnDataType>(base_segment);
+      }
+
+      // If the input segment is not a ReferenceSegment, we can take a fast(er) path
+      if (accessor) {
+        const auto typed_value = accessor->access(chunk_offset);
+        const auto is_null = !typed_value;
+        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
+        value_segment_null_vector.push_back(is_null);
+      } else {
+        const auto value = (*base_segment)[chunk_offset];
+        const auto is_null = variant_is_null(value);
+        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : boost::get<ColumnDataType>(value));
+        value_segment_null_vector.push_back(is_null);
+      }
+    }
+
+    return std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
+                                                          std::move(value_segment_null_vector));
+  }
+
   const std::shared_ptr<const Table> _table_in;
   const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
+  const std::shared_ptr<const PosList> _sorted_rows;
 };
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
+// Builds the normalized keys, sorts them, and hands the sorted RowIDs to SortImplMaterializeOutput
 class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
  public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
+  SortImpl(const std::shared_ptr<const Table>& table_in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
       : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
+        _sort_definitions(sort_definitions),
+        _output_chunk_size(output_chunk_size),
+        _keys(table_in, sort_definitions),
+        _sorted_rows(std::make_shared<PosList>()) {}
 
  protected:
+  auto _comparator() const {
+    return [&keys = _keys](const NormalizedSortKeyEntry& lhs, const NormalizedSortKeyEntry& rhs) {
+      return keys.less(lhs, rhs);
+    };
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
-    }
+    // 1. Prepare Sort: Creating a sorted run of normalized keys per input chunk. NULL handling and the order of each
+    // sort column are part of the keys.
+    auto runs = _materialize_sorted_runs();
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
-    }
+    // 2. After we got our sorted runs, we merge them into a single sorted list of RowIDs
+    _merge_runs(runs);
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
+    // 3. Materialization of the result: We take the sorted RowIDs, create chunks fill them until they are full and
+    // create the next one. Each chunk is filled row by row.
+    auto materialization = std::make_shared<SortImplMaterializeOutput>(_table_in, _sorted_rows, _output_chunk_size);
     auto output = materialization->execute();
 
+    // Chunks can only store a single column they are ordered by. This is the primary sort column.
+    const auto& primary_sort_definition = _sort_definitions.front();
     const auto chunk_count = output->chunk_count();
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      output->get_chunk(chunk_id)->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
+      output->get_chunk(chunk_id)->set_ordered_by(
+          std::make_pair(primary_sort_definition.column, primary_sort_definition.order_by_mode));
     }
 
     return output;
   }
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+  // Builds the normalized keys for each input chunk and sorts them in their own job
+  std::vector<std::vector<NormalizedSortKeyEntry>> _materialize_sorted_runs() {
+    const auto chunk_count = _table_in->chunk_count();
 
-    auto& null_value_rows = *_null_value_rows;
+    auto runs = std::vector<std::vector<NormalizedSortKeyEntry>>(chunk_count);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(chunk_count);
 
-    const auto chunk_count = _table_in->chunk_count();
     for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-      const auto chunk = _table_in->get_chunk(chunk_id);
-      Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& run = runs[chunk_id];
+        run = _keys.materialize_chunk(chunk_id);
+        std::stable_sort(run.begin(), run.end(), _comparator());
+      }));
+      jobs.back()->schedule();
+    }
+
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+    return runs;
+  }
+
+  // Merges the sorted runs into _sorted_rows. The output is split into key ranges, which are merged independently of
+  // each other. For this, we pick splitter keys from a sample of all runs and locate each splitter in each run using a
+  // binary search. All rows of a key range thus end up in the same merge job. As ties are resolved in favor of the run
+  // with the lower chunk id, the merge (and therefore the entire sort) is stable.
+  void _merge_runs(std::vector<std::vector<NormalizedSortKeyEntry>>& runs) {
+    runs.erase(std::remove_if(runs.begin(), runs.end(), [](const auto& run) { return run.empty(); }), runs.end());
+
+    const auto run_count = runs.size();
+    const auto row_count = std::accumulate(runs.begin(), runs.end(), size_t{0},
+                                           [](const auto sum, const auto& run) { return sum + run.size(); });
+    _sorted_rows->resize(row_count);
+
+    if (run_count == 0) return;
+
+    const auto comparator = _comparator();
+
+    if (run_count == 1) {
+      std::transform(runs.front().begin(), runs.front().end(), _sorted_rows->begin(),
+                     [](const auto& entry) { return entry.row_id; });
+      return;
+    }
+
+    const auto partition_count =
+        std::max(size_t{1}, std::min(Hyrise::get().topology.num_cpus(), row_count / MIN_ROWS_PER_PARTITION));
+
+    // Sample partition_count evenly spaced entries from every run and use the quantiles as splitters
+    auto samples = std::vector<NormalizedSortKeyEntry>{};
+    samples.reserve(run_count * partition_count);
+    for (const auto& run : runs) {
+      for (auto sample_index = size_t{0}; sample_index < partition_count; ++sample_index) {
+        samples.emplace_back(run[sample_index * run.size() / partition_count]);
+      }
+    }
+    std::sort(samples.begin(), samples.end(), comparator);
+
+    // partition_bounds[partition_id][run_id] is the first entry of a run that belongs to the partition. The last
+    // entry acts as a sentinel and points to the end of each run.
+    auto partition_bounds = std::vector<std::vector<size_t>>(partition_count + 1, std::vector<size_t>(run_count));
+    for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+      const auto& run = runs[run_id];
+      for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+        const auto& splitter = samples[partition_id * samples.size() / partition_count];
+        partition_bounds[partition_id][run_id] =
+            static_cast<size_t>(std::lower_bound(run.begin(), run.end(), splitter, comparator) - run.begin());
+      }
+      partition_bounds[partition_count][run_id] = run.size();
+    }
 
-      auto base_segment = chunk->get_segment(_column_id);
+    // Determine where each partition starts in the output
+    auto partition_offsets = std::vector<size_t>(partition_count + 1);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      auto partition_size = size_t{0};
+      for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+        partition_size += partition_bounds[partition_id + 1][run_id] - partition_bounds[partition_id][run_id];
+      }
+      partition_offsets[partition_id + 1] = partition_offsets[partition_id] + partition_size;
+    }
 
-      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-        if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-        } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(partition_count);
+
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      if (partition_offsets[partition_id] == partition_offsets[partition_id + 1]) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        auto positions = partition_bounds[partition_id];
+        const auto& ends = partition_bounds[partition_id + 1];
+
+        // The heap holds the ids of all runs that have entries left in this partition. Its top is the run with the
+        // smallest current entry; for equal entries, the run with the lower id is preferred.
+        const auto heap_comparator = [&](const size_t left_run_id, const size_t right_run_id) {
+          const auto& left = runs[left_run_id][positions[left_run_id]];
+          const auto& right = runs[right_run_id][positions[right_run_id]];
+          if (comparator(right, left)) return true;
+          if (comparator(left, right)) return false;
+          return left_run_id > right_run_id;
+        };
+
+        auto heap = std::vector<size_t>{};
+        heap.reserve(run_count);
+        for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+          if (positions[run_id] < ends[run_id]) heap.emplace_back(run_id);
         }
-      });
+        std::make_heap(heap.begin(), heap.end(), heap_comparator);
+
+        auto output_position = partition_offsets[partition_id];
+        while (!heap.empty()) {
+          std::pop_heap(heap.begin(), heap.end(), heap_comparator);
+          const auto run_id = heap.back();
+
+          (*_sorted_rows)[output_position] = runs[run_id][positions[run_id]].row_id;
+          ++output_position;
+          ++positions[run_id];
+
+          if (positions[run_id] < ends[run_id]) {
+            std::push_heap(heap.begin(), heap.end(), heap_comparator);
+          } else {
+            heap.pop_back();
+          }
+        }
+      }));
+      jobs.back()->schedule();
     }
-  }
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
   }
 
+  // Merging in parallel only pays off if each merge job has a minimum amount of work to do
+  static constexpr auto MIN_ROWS_PER_PARTITION = size_t{1'000};
+
   const std::shared_ptr<const Table> _table_in;
+  const std::vector<SortColumnDefinition> _sort_definitions;
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
   // chunk size of the materialized output
   const size_t _output_chunk_size;
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
+  NormalizedSortKeys _keys;
+  std::shared_ptr<PosList> _sorted_rows;
 };
 
+std::shared_ptr<const Table> Sort::_on_execute() {
+  _impl = std::make_unique<SortImpl>(input_table_left(), _sort_definitions, _output_chunk_size);
+  return _impl->_on_execute();
+}
+
+void Sort::_on_cleanup() { _impl.reset(); }
+
 }  // namespace opossum
@@ -15,18 +15,24 @@
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
+ * values will maintain their relative order.
+ * The values of all sort columns are encoded into normalized keys (see NormalizedSortKeys), so that rows are compared
+ * with a single memcmp, no matter how many columns they are sorted by. Each input chunk is sorted in its own job. The
+ * resulting runs are then merged in parallel by splitting them into key ranges, and the output chunks are materialized
+ * in parallel as well.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   // The parameter chunk_size sets the chunk size of the output table, which will always be materialized
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
+
+  // Convenience constructor for sorting by a single column
   Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
 
-  ColumnID column_id() const;
-  OrderByMode order_by_mode() const;
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
 
   const std::string& name() const override;
 
@@ -38,17 +44,13 @@ class Sort : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
+  // The operator is separated in two different classes. SortImpl builds and sorts the normalized keys and
+  // SortImplMaterializeOutput writes the sorted rows to the output table, as described later on.
   class SortImpl;
-  template <typename SortColumnType>
   class SortImplMaterializeOutput;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
@@ -0,0 +1,246 @@
+#include "normalized_sort_keys.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename UnsignedType>
+void write_big_endian(uint8_t* destination, UnsignedType value) {
+  for (auto byte_id = sizeof(UnsignedType); byte_id > 0; --byte_id) {
+    destination[byte_id - 1] = static_cast<uint8_t>(value & 0xFF);
+    value >>= 8;
+  }
+}
+
+// Maps a signed integer to an unsigned integer of the same order
+template <typename SignedType>
+std::make_unsigned_t<SignedType> normalize_integral(const SignedType value) {
+  using UnsignedType = std::make_unsigned_t<SignedType>;
+  return static_cast<UnsignedType>(value) ^ (UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1));
+}
+
+// Maps an IEEE 754 floating point number to an unsigned integer of the same order. Positive numbers only need their
+// sign bit set, negative numbers are inverted so that larger magnitudes become smaller integers.
+template <typename FloatingPointType, typename UnsignedType>
+UnsignedType normalize_floating_point(const FloatingPointType value) {
+  static_assert(sizeof(FloatingPointType) == sizeof(UnsignedType));
+  constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+
+  // -0.0 and 0.0 are equal, but differ in their bit representation
+  const auto normalized_value = value == FloatingPointType{0} ? FloatingPointType{0} : value;
+
+  auto bits = UnsignedType{};
+  std::memcpy(&bits, &normalized_value, sizeof(bits));
+  return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+}
+
+template <typename ColumnDataType>
+size_t value_width() {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    return NormalizedSortKeys::STRING_PREFIX_LENGTH;
+  } else {
+    return sizeof(ColumnDataType);
+  }
+}
+
+// Writes the ascending encoding of value to destination
+template <typename ColumnDataType>
+void encode_value(uint8_t* destination, const ColumnDataType& value) {
+  if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+    write_big_endian(destination, normalize_integral(value));
+  } else if constexpr (std::is_same_v<ColumnDataType, float>) {
+    write_big_endian(destination, normalize_floating_point<float, uint32_t>(value));
+  } else if constexpr (std::is_same_v<ColumnDataType, double>) {
+    write_big_endian(destination, normalize_floating_point<double, uint64_t>(value));
+  } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    // Shorter strings are padded with zeros, which is what the key buffer is initialized with
+    std::memcpy(destination, value.data(), std::min(value.size(), NormalizedSortKeys::STRING_PREFIX_LENGTH));
+  } else {
+    Fail("Unsupported data type for normalized sort keys");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+NormalizedSortKeys::NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                                       const std::vector<SortColumnDefinition>& sort_definitions)
+    : _table(table), _key_chunks(table->chunk_count()) {
+  Assert(!sort_definitions.empty(), "Expected at least one sort column");
+
+  for (const auto& sort_definition : sort_definitions) {
+    auto column_layout = ColumnLayout{};
+    column_layout.column_id = sort_definition.column;
+    column_layout.data_type = table->column_data_type(sort_definition.column);
+    column_layout.descending = sort_definition.order_by_mode == OrderByMode::Descending ||
+                               sort_definition.order_by_mode == OrderByMode::DescendingNullsLast;
+    column_layout.nulls_first = sort_definition.order_by_mode == OrderByMode::Ascending ||
+                                sort_definition.order_by_mode == OrderByMode::Descending;
+
+    if (table->column_is_nullable(sort_definition.column)) {
+      column_layout.null_byte_offset = _key_width;
+      ++_key_width;
+    }
+
+    resolve_data_type(column_layout.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      column_layout.value_width = value_width<ColumnDataType>();
+    });
+    column_layout.value_offset = _key_width;
+    _key_width += column_layout.value_width;
+
+    if (column_layout.data_type == DataType::String) {
+      column_layout.string_index = _string_column_layout_ids.size();
+      _string_column_layout_ids.emplace_back(_column_layouts.size());
+    }
+
+    _column_layouts.emplace_back(column_layout);
+  }
+}
+
+std::vector<NormalizedSortKeyEntry> NormalizedSortKeys::materialize_chunk(const ChunkID chunk_id) {
+  const auto chunk = _table->get_chunk(chunk_id);
+  Assert(chunk, "Did not expect deleted chunk here.");  // see #1686
+  const auto row_count = chunk->size();
+
+  auto& key_chunk = _key_chunks[chunk_id];
+  key_chunk.keys.resize(row_count * _key_width);
+  key_chunk.strings.resize(_string_column_layout_ids.size());
+
+  for (const auto& column_layout : _column_layouts) {
+    resolve_data_type(column_layout.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _write_column<ColumnDataType>(column_layout, chunk_id, key_chunk);
+    });
+  }
+
+  const auto head_width = std::min(_key_width, sizeof(uint64_t));
+
+  auto entries = std::vector<NormalizedSortKeyEntry>(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto* key = key_chunk.keys.data() + chunk_offset * _key_width;
+
+    auto key_head = uint64_t{0};
+    for (auto byte_id = size_t{0}; byte_id < head_width; ++byte_id) {
+      key_head |= uint64_t{key[byte_id]} << ((sizeof(uint64_t) - 1 - byte_id) * 8);
+    }
+
+    entries[chunk_offset] = NormalizedSortKeyEntry{key_head, key, RowID{chunk_id, chunk_offset}};
+  }
+
+  return entries;
+}
+
+void NormalizedSortKeys::compact_chunk(const ChunkID chunk_id, std::vector<NormalizedSortKeyEntry>& entries) {
+  auto& key_chunk = _key_chunks[chunk_id];
+
+  auto compacted_key_chunk = NormalizedSortKeyChunk{};
+  compacted_key_chunk.keys.resize(entries.size() * _key_width);
+  compacted_key_chunk.strings.resize(key_chunk.strings.size());
+  for (auto& strings : compacted_key_chunk.strings) {
+    strings.reserve(entries.size());
+  }
+
+  for (auto entry_index = size_t{0}; entry_index < entries.size(); ++entry_index) {
+    auto& entry = entries[entry_index];
+    DebugAssert(entry.row_id.chunk_id == chunk_id, "Entry does not belong to the chunk");
+
+    const auto key_index = _key_index(entry);
+    for (auto string_index = size_t{0}; string_index < key_chunk.strings.size(); ++string_index) {
+      compacted_key_chunk.strings[string_index].emplace_back(std::move(key_chunk.strings[string_index][key_index]));
+    }
+
+    auto* compacted_key = compacted_key_chunk.keys.data() + entry_index * _key_width;
+    std::memcpy(compacted_key, entry.key, _key_width);
+    entry.key = compacted_key;
+  }
+
+  // Moving the vectors does not move their buffers, so the updated key pointers stay valid
+  key_chunk = std::move(compacted_key_chunk);
+}
+
+template <typename ColumnDataType>
+void NormalizedSortKeys::_write_column(const ColumnLayout& column_layout, const ChunkID chunk_id,
+                                       NormalizedSortKeyChunk& key_chunk) {
+  auto* strings = static_cast<std::vector<pmr_string>*>(nullptr);
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    strings = &key_chunk.strings[*column_layout.string_index];
+    strings->resize(key_chunk.keys.size() / _key_width);
+  }
+
+  const auto null_marker = static_cast<uint8_t>(column_layout.nulls_first ? 0x00 : 0x01);
+  const auto& segment = *_table->get_chunk(chunk_id)->get_segment(column_layout.column_id);
+
+  segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+    auto* key = key_chunk.keys.data() + position.chunk_offset() * _key_width;
+
+    if (position.is_null()) {
+      DebugAssert(column_layout.null_byte_offset, "Found NULL value in non-nullable column");
+      key[*column_layout.null_byte_offset] = null_marker;
+      return;
+    }
+
+    if (column_layout.null_byte_offset) {
+      key[*column_layout.null_byte_offset] = static_cast<uint8_t>(1 - null_marker);
+    }
+
+    auto* value_key = key + column_layout.value_offset;
+    encode_value(value_key, position.value());
+
+    if (column_layout.descending) {
+      for (auto byte_id = size_t{0}; byte_id < column_layout.value_width; ++byte_id) {
+        value_key[byte_id] = static_cast<uint8_t>(~value_key[byte_id]);
+      }
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      (*strings)[position.chunk_offset()] = position.value();
+    }
+  });
+}
+
+bool NormalizedSortKeys::less(const NormalizedSortKeyEntry& lhs, const NormalizedSortKeyEntry& rhs) const {
+  if (lhs.key_head != rhs.key_head) return lhs.key_head < rhs.key_head;
+
+  // The key heads are equal. Compare the remaining keys up to the end of each string prefix and, if the prefixes are
+  // equal, break the tie by comparing the full strings.
+  auto offset = size_t{0};
+  for (const auto column_layout_id : _string_column_layout_ids) {
+    const auto& column_layout = _column_layouts[column_layout_id];
+    const auto prefix_end = column_layout.value_offset + column_layout.value_width;
+
+    const auto result = std::memcmp(lhs.key + offset, rhs.key + offset, prefix_end - offset);
+    if (result != 0) return result < 0;
+    offset = prefix_end;
+
+    // Both NULL bytes are equal at this point. If both values are NULL, they are equal as well.
+    const auto null_marker = static_cast<uint8_t>(column_layout.nulls_first ? 0x00 : 0x01);
+    if (column_layout.null_byte_offset && lhs.key[*column_layout.null_byte_offset] == null_marker) continue;
+
+    const auto& lhs_string = _key_chunks[lhs.row_id.chunk_id].strings[*column_layout.string_index][_key_index(lhs)];
+    const auto& rhs_string = _key_chunks[rhs.row_id.chunk_id].strings[*column_layout.string_index][_key_index(rhs)];
+    const auto string_result = lhs_string.compare(rhs_string);
+    if (string_result != 0) return column_layout.descending ? string_result > 0 : string_result < 0;
+  }
+
+  return std::memcmp(lhs.key + offset, rhs.key + offset, _key_width - offset) < 0;
+}
+
+size_t NormalizedSortKeys::key_width() const { return _key_width; }
+
+size_t NormalizedSortKeys::_key_index(const NormalizedSortKeyEntry& entry) const {
+  return static_cast<size_t>(entry.key - _key_chunks[entry.row_id.chunk_id].keys.data()) / _key_width;
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A single row of a table that is sorted using normalized keys
+struct NormalizedSortKeyEntry {
+  // The first (up to) eight bytes of the normalized key as a big-endian integer. As most comparisons are decided by the
+  // first bytes of the key, this saves us from following the pointer to the full key.
+  uint64_t key_head;
+  const uint8_t* key;
+  RowID row_id;
+};
+
+/**
+ * Normalized sort keys encode the values of all sort columns of a row into a single fixed-width byte string. Comparing
+ * two rows by multiple columns, each with its own order and NULL handling, then becomes a single memcmp. For each sort
+ * column, the key contains:
+ *   - A NULL byte (only for nullable columns), which places NULLs before or after all other values
+ *   - An order-preserving, big-endian encoding of the value: Integers have their sign bit flipped, floating point
+ *     numbers are mapped to integers with the same order, and strings are represented by their first
+ *     STRING_PREFIX_LENGTH bytes. For descending sort columns, these bytes are inverted.
+ *
+ * Strings that share the same prefix cannot be ordered by their keys alone. If two keys are equal up to the end of a
+ * string prefix, the full strings (which are kept alongside the keys) are compared instead.
+ *
+ * The keys are built chunk by chunk. materialize_chunk() and compact_chunk() may be called for different chunks in
+ * parallel.
+ */
+class NormalizedSortKeys : private Noncopyable {
+ public:
+  // Number of bytes of a string that are stored in the normalized key. Needs to cover the key head so that key heads
+  // never contain bytes that follow a (potentially truncated) string prefix.
+  static constexpr auto STRING_PREFIX_LENGTH = size_t{16};
+  static_assert(STRING_PREFIX_LENGTH >= sizeof(uint64_t));
+
+  NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                     const std::vector<SortColumnDefinition>& sort_definitions);
+
+  // Builds the keys for all rows of the given chunk. The returned entries are in the order of the chunk's rows and
+  // point into memory owned by this object.
+  std::vector<NormalizedSortKeyEntry> materialize_chunk(const ChunkID chunk_id);
+
+  // Releases the keys of all rows of the chunk that are not part of entries. The key pointers of the remaining entries
+  // are updated. Used by operators like TopN, which only need to keep a few rows per chunk.
+  void compact_chunk(const ChunkID chunk_id, std::vector<NormalizedSortKeyEntry>& entries);
+
+  // Returns true if the row of lhs is sorted before the row of rhs.
+  bool less(const NormalizedSortKeyEntry& lhs, const NormalizedSortKeyEntry& rhs) const;
+
+  size_t key_width() const;
+
+ protected:
+  struct ColumnLayout {
+    ColumnID column_id;
+    DataType data_type;
+    bool descending;
+    bool nulls_first;
+
+    // Offset of the NULL byte in the key, if the column is nullable
+    std::optional<size_t> null_byte_offset;
+    size_t value_offset;
+    size_t value_width;
+
+    // Index into NormalizedSortKeyChunk::strings for string columns
+    std::optional<size_t> string_index;
+  };
+
+  struct NormalizedSortKeyChunk {
+    std::vector<uint8_t> keys;
+    // Full values of the string columns, indexed by the position of the key in keys. Used to resolve ties between
+    // string prefixes.
+    std::vector<std::vector<pmr_string>> strings;
+  };
+
+  size_t _key_index(const NormalizedSortKeyEntry& entry) const;
+
+  template <typename ColumnDataType>
+  void _write_column(const ColumnLayout& column_layout, const ChunkID chunk_id, NormalizedSortKeyChunk& key_chunk);
+
+  const std::shared_ptr<const Table> _table;
+  std::vector<ColumnLayout> _column_layouts;
+  std::vector<size_t> _string_column_layout_ids;
+  size_t _key_width{0};
+
+  std::vector<NormalizedSortKeyChunk> _key_chunks;
+};
+
+}  // namespace opossum
@@ -42,7 +42,8 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
+    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<TableScan::PerformanceData>()},
+      _predicate(predicate) {}
 
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const { return _predicate; }
 
@@ -79,6 +80,7 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto in_table = input_table_left();
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
   _impl = create_impl();
   _impl_description = _impl->description();
@@ -99,6 +101,13 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Did not expect deleted chunk here.");  // see #1686
 
+    // The ChunkPruningRule cannot prune chunks for values that are unknown during optimization (e.g., parameters of
+    // prepared statements or correlated subqueries). Now that these are bound, skip chunks that cannot hold matches.
+    if (_impl->can_prune_chunk(chunk_id)) {
+      ++performance_data.chunk_scans_skipped;
+      continue;
+    }
+
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
     auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
@@ -338,4 +347,11 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
+void TableScan::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData::output_to_stream(stream, description_mode);
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  stream << std::to_string(chunk_scans_skipped) << " chunks skipped";
+}
+
 }  // namespace opossum
@@ -48,6 +48,13 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    // Chunks that were not scanned because their pruning statistics rule out matches for the bound values
+    size_t chunk_scans_skipped{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
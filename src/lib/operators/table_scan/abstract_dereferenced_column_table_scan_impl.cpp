@@ -4,10 +4,13 @@
 #include <unordered_map>
 #include <utility>
 
+#include "lossless_cast.hpp"
 #include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
@@ -75,4 +78,57 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
   }
 }
 
+std::optional<ChunkOffsetRanges> AbstractDereferencedColumnTableScanImpl::_get_zone_map_candidate_ranges(
+    const ChunkID chunk_id, const std::shared_ptr<const PosList>& position_filter, const AllTypeVariant& value,
+    const std::optional<AllTypeVariant>& value2) const {
+  // With a position filter, the scanned segment belongs to a chunk referenced by the input chunk
+  if (position_filter) return std::nullopt;
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto zone_maps = chunk->zone_maps();
+  if (!zone_maps || !(*zone_maps)[_column_id]) return std::nullopt;
+
+  auto candidate_ranges = (*zone_maps)[_column_id]->candidate_ranges(predicate_condition, value, value2);
+
+  // There is nothing to skip if all blocks are candidates
+  if (candidate_ranges.size() == 1 && candidate_ranges[0].first == 0 && candidate_ranges[0].second == chunk->size()) {
+    return std::nullopt;
+  }
+
+  return candidate_ranges;
+}
+
+bool AbstractDereferencedColumnTableScanImpl::_can_prune_chunk(const ChunkID chunk_id, const AllTypeVariant& value,
+                                                               const std::optional<AllTypeVariant>& value2) const {
+  // The pruning filters expect values of the column's data type. As in the ChunkPruningRule, values that cannot be
+  // converted losslessly (including NULL) are not used for pruning.
+  const auto column_data_type = _in_table->column_data_type(_column_id);
+  const auto cast_value = lossless_variant_cast(value, column_data_type);
+  if (!cast_value) return false;
+
+  auto cast_value2 = std::optional<AllTypeVariant>{};
+  if (value2) {
+    cast_value2 = lossless_variant_cast(*value2, column_data_type);
+    if (!cast_value2) return false;
+  }
+
+  auto chunk = _in_table->get_chunk(chunk_id);
+  auto column_id = _column_id;
+
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (!pos_list.references_single_chunk() || pos_list.empty()) return false;
+
+    chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+    column_id = reference_segment->referenced_column_id();
+  }
+
+  // The statistics might be replaced concurrently (e.g., when the chunk is encoded), so a snapshot is used. GetTable
+  // does not keep the statistics of columns it copied to apply versions.
+  const auto pruning_statistics = chunk->pruning_statistics();
+  if (!pruning_statistics || !(*pruning_statistics)[column_id]) return false;
+
+  return can_prune_segment(*(*pruning_statistics)[column_id], predicate_condition, *cast_value, cast_value2);
+}
+
 }  // namespace opossum
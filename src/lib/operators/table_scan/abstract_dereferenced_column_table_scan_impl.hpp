@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -41,6 +42,21 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
   virtual void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                            const std::shared_ptr<const PosList>& position_filter) const = 0;
 
+  // Returns the ranges of the segment that may contain matches for the given value(s) according to the zone map of
+  // the chunk (see BaseSegmentZoneMap). Returns std::nullopt if all rows have to be scanned, e.g., because the chunk
+  // has no zone map or a position filter is used. As the values are only known when the scan is executed, this also
+  // applies to values of prepared statements, which could not be used for pruning by the optimizer.
+  std::optional<ChunkOffsetRanges> _get_zone_map_candidate_ranges(
+      const ChunkID chunk_id, const std::shared_ptr<const PosList>& position_filter, const AllTypeVariant& value,
+      const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // Checks the pruning statistics (see generate_chunk_pruning_statistics()) of the chunk for the given value(s). For
+  // an input chunk of ReferenceSegments (e.g., the output of the Validate operator), the statistics of the referenced
+  // chunk are used if the chunk references a single chunk only. Unlike the ChunkPruningRule, this sees the values of
+  // prepared statements and correlated subqueries, as these are bound by the time the scan is executed.
+  bool _can_prune_chunk(const ChunkID chunk_id, const AllTypeVariant& value,
+                        const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
 };
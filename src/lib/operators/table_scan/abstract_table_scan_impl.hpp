@@ -5,10 +5,12 @@
 #endif
 
 #include <array>
+#include <optional>
 
 #include "storage/pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -25,6 +27,10 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  // Returns true if the chunk cannot contain any matches. Used by the TableScan to skip chunks before scheduling the
+  // scan jobs. Impls that cannot decide this conservatively return false.
+  virtual bool can_prune_chunk(const ChunkID chunk_id) const { return false; }
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
@@ -39,6 +45,24 @@ class AbstractTableScanImpl {
     _scan_with_iterators<CheckForNull>(func, left_it, left_end, chunk_id, matches_out, false_type);
   }
 
+  // Scans only the given ranges of chunk offsets, e.g., the blocks that a zone map could not rule out. The iterators
+  // have to iterate over the entire segment, i.e., without a position filter. If ranges is std::nullopt, all rows
+  // are scanned.
+  template <bool CheckForNull, typename BinaryFunctor, typename LeftIterator>
+  static void _scan_ranges_with_iterators(const BinaryFunctor func, const LeftIterator left_it,
+                                          const LeftIterator left_end, const ChunkID chunk_id, PosList& matches_out,
+                                          const std::optional<ChunkOffsetRanges>& ranges) {
+    if (!ranges) {
+      _scan_with_iterators<CheckForNull>(func, left_it, left_end, chunk_id, matches_out);
+      return;
+    }
+
+    for (const auto& [range_begin, range_end] : *ranges) {
+      _scan_with_iterators<CheckForNull>(func, left_it + static_cast<std::ptrdiff_t>(range_begin),
+                                         left_it + static_cast<std::ptrdiff_t>(range_end), chunk_id, matches_out);
+    }
+  }
+
   template <bool CheckForNull, typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   // This is a function that is critical for our performance. We want the compiler to try its best in optimizing it.
   // Also, we want all functions called inside to be inlined (flattened). GCC seems to like for this to not be inlined
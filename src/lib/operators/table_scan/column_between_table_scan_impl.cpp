@@ -32,20 +32,29 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+bool ColumnBetweenTableScanImpl::can_prune_chunk(const ChunkID chunk_id) const {
+  return _can_prune_chunk(chunk_id, left_value, right_value);
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
+  // Only scan the blocks that may contain matches according to the zone map
+  const auto candidate_ranges = _get_zone_map_candidate_ranges(chunk_id, position_filter, left_value, right_value);
+  if (candidate_ranges && candidate_ranges->empty()) return;
+
   // Select optimized or generic scanning implementation based on segment type
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
-    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter, candidate_ranges);
   } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    _scan_generic_segment(segment, chunk_id, matches, position_filter, candidate_ranges);
   }
 }
 
-void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
-                                                       PosList& matches,
-                                                       const std::shared_ptr<const PosList>& position_filter) const {
+void ColumnBetweenTableScanImpl::_scan_generic_segment(
+    const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter,
+    const std::optional<ChunkOffsetRanges>& candidate_ranges) const {
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     using ColumnDataType = typename decltype(it)::ValueType;
 
@@ -61,7 +70,7 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
         auto between_comparator = [&](const auto& position) {
           return between_comparator_function(position.value(), typed_left_value, typed_right_value);
         };
-        _scan_with_iterators<true>(between_comparator, it, end, chunk_id, matches);
+        _scan_ranges_with_iterators<true>(between_comparator, it, end, chunk_id, matches, candidate_ranges);
       });
     } else {
       Fail("Dictionary and Reference segments have their own code paths and should be handled there");
@@ -69,9 +78,10 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
   });
 }
 
-void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
-                                                          PosList& matches,
-                                                          const std::shared_ptr<const PosList>& position_filter) const {
+void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
+    const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter,
+    const std::optional<ChunkOffsetRanges>& candidate_ranges) const {
   ValueID lower_bound_value_id;
   if (is_lower_inclusive_between(predicate_condition)) {
     lower_bound_value_id = segment.lower_bound(left_value);
@@ -95,7 +105,7 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   if (lower_bound_value_id == ValueID{0} && upper_bound_value_id == INVALID_VALUE_ID) {
     attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
-      _scan_with_iterators<true>(always_true, left_it, left_end, chunk_id, matches);
+      _scan_ranges_with_iterators<true>(always_true, left_it, left_end, chunk_id, matches, candidate_ranges);
     });
 
     return;
@@ -128,7 +138,7 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
 
   attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
     // No need to check for NULL because NULL would be represented as a value ID outside of our range
-    _scan_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches);
+    _scan_ranges_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches, candidate_ranges);
   });
 }
 
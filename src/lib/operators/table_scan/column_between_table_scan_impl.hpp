@@ -29,6 +29,8 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   std::string description() const override;
 
+  bool can_prune_chunk(const ChunkID chunk_id) const override;
+
   const AllTypeVariant left_value;
   const AllTypeVariant right_value;
 
@@ -37,11 +39,13 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
-                             const std::shared_ptr<const PosList>& position_filter) const;
+                             const std::shared_ptr<const PosList>& position_filter,
+                             const std::optional<ChunkOffsetRanges>& candidate_ranges) const;
 
   // Optimized scan on DictionarySegments
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
-                                const std::shared_ptr<const PosList>& position_filter) const;
+                                const std::shared_ptr<const PosList>& position_filter,
+                                const std::optional<ChunkOffsetRanges>& candidate_ranges) const;
 };
 
 }  // namespace opossum
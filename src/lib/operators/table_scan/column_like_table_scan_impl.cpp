@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <map>
 #include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
@@ -17,6 +19,18 @@
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::optional<pmr_string> get_prefix(const LikeMatcher& matcher) {
+  const auto* starts_with_pattern = std::get_if<LikeMatcher::StartsWithPattern>(&matcher.pattern_variant());
+  if (!starts_with_pattern) return std::nullopt;
+  return starts_with_pattern->string;
+}
+
+}  // namespace
+
 namespace opossum {
 
 ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
@@ -24,6 +38,7 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, predicate_condition},
       _matcher{pattern},
+      _prefix{get_prefix(_matcher)},
       _invert_results(predicate_condition == PredicateCondition::NotLike) {}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
@@ -31,10 +46,17 @@ std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike";
 void ColumnLikeTableScanImpl::_scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                           PosList& matches,
                                                           const std::shared_ptr<const PosList>& position_filter) const {
+  const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
+
+  // For prefix patterns, finding the matching value IDs in the dictionary costs only two binary searches
+  if (dictionary_segment && _prefix) {
+    _scan_dictionary_segment_with_prefix(*dictionary_segment, chunk_id, matches, position_filter);
+    return;
+  }
+
   // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
   // input rows, use an optimized implementation.
-  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
-      dictionary_segment &&
+  if (dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
   } else {
@@ -71,7 +93,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   // First, build a bitmap containing 1s/0s for matching/non-matching dictionary values. Second, iterate over the
   // attribute vector and check against the bitmap. If too many input rows have already been removed (are not part of
   // position_filter), this optimization is detrimental. See caller for that case.
-  std::pair<size_t, std::vector<bool>> result;
+  std::pair<size_t, std::vector<uint8_t>> result;
 
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
@@ -87,7 +109,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
   // LIKE matches all rows, but we still need to check for NULL
-  if (match_count == dictionary_matches.size()) {
+  if (match_count == segment.unique_values_count()) {
     attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
@@ -102,23 +124,65 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   }
 
   const auto dictionary_lookup = [&dictionary_matches](const auto& position) {
-    return dictionary_matches[position.value()];
+    return dictionary_matches[position.value()] != 0;
   };
 
+  // The NULL value ID is part of the bitmap and never matches, so we do not need to check for NULL explicitly
   attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
-    _scan_with_iterators<true>(dictionary_lookup, it, end, chunk_id, matches);
+    _scan_with_iterators<false>(dictionary_lookup, it, end, chunk_id, matches);
   });
 }
 
-std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
+void ColumnLikeTableScanImpl::_scan_dictionary_segment_with_prefix(
+    const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter) const {
+  const auto [begin_value_id, end_value_id] = _find_prefix_range_in_dictionary(segment, *_prefix);
+
+  const auto matches_all_values = begin_value_id == ValueID{0} && end_value_id == segment.unique_values_count();
+  const auto matches_no_value = begin_value_id == end_value_id;
+
+  auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
+
+  // LIKE or NOT LIKE matches all rows, but we still need to check for NULL
+  if (_invert_results ? matches_no_value : matches_all_values) {
+    attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
+      static const auto always_true = [](const auto&) { return true; };
+      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+    });
+
+    return;
+  }
+
+  // LIKE or NOT LIKE matches no rows
+  if (_invert_results ? matches_all_values : matches_no_value) {
+    return;
+  }
+
+  attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    if (_invert_results) {
+      // The NULL value ID (unique_values_count()) is not smaller than end_value_id, so NULLs need to be excluded
+      const auto comparator = [begin_value_id = begin_value_id, end_value_id = end_value_id](const auto& position) {
+        return position.value() < begin_value_id || position.value() >= end_value_id;
+      };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    } else {
+      const auto comparator = [begin_value_id = begin_value_id, end_value_id = end_value_id](const auto& position) {
+        return position.value() >= begin_value_id && position.value() < end_value_id;
+      };
+      _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+    }
+  });
+}
+
+std::pair<size_t, std::vector<uint8_t>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
     const pmr_vector<pmr_string>& dictionary) const {
-  auto result = std::pair<size_t, std::vector<bool>>{};
+  auto result = std::pair<size_t, std::vector<uint8_t>>{};
 
   auto& count = result.first;
   auto& dictionary_matches = result.second;
 
   count = 0u;
-  dictionary_matches.reserve(dictionary.size());
+  dictionary_matches.reserve(dictionary.size() + 1);
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
     for (const auto& value : dictionary) {
@@ -128,7 +192,35 @@ std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_d
     }
   });
 
+  // NULL value ID
+  dictionary_matches.push_back(false);
+
   return result;
 }
 
+std::pair<ValueID, ValueID> ColumnLikeTableScanImpl::_find_prefix_range_in_dictionary(
+    const BaseDictionarySegment& segment, const pmr_string& prefix) {
+  const auto unique_values_count = ValueID{segment.unique_values_count()};
+
+  // lower_bound() returns INVALID_VALUE_ID if all values are smaller than the search value
+  const auto lower_bound = [&](const pmr_string& value) {
+    const auto value_id = segment.lower_bound(value);
+    return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+  };
+
+  // The values that start with the prefix are smaller than the smallest string that is greater than all of them. That
+  // string is found by incrementing the last character of the prefix that is not the largest possible character.
+  // std::char_traits<char> compares characters as unsigned char.
+  auto successor = prefix;
+  constexpr auto MAX_CHARACTER = std::numeric_limits<unsigned char>::max();
+  while (!successor.empty() && static_cast<unsigned char>(successor.back()) == MAX_CHARACTER) {
+    successor.pop_back();
+  }
+
+  if (successor.empty()) return {lower_bound(prefix), unique_values_count};
+
+  successor.back() = static_cast<char>(static_cast<unsigned char>(successor.back()) + 1);
+  return {lower_bound(prefix), lower_bound(successor)};
+}
+
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -25,6 +26,8 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For dictionary segments and patterns of the form 'hello%', the matching values form a range of value IDs in the
+ *   sorted dictionary. The range is found by binary search and the attribute vector is compared against its bounds.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -44,15 +47,29 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                              const std::shared_ptr<const PosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
+  void _scan_dictionary_segment_with_prefix(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                            PosList& matches,
+                                            const std::shared_ptr<const PosList>& position_filter) const;
 
   /**
    * Used for dictionary segments
-   * @returns number of matches and the result of each dictionary entry
+   * @returns number of matches and the result of each dictionary entry. The result has one additional entry for the
+   *          NULL value ID, which never matches. Bytes instead of bits are used so that the lookups can be vectorized.
    */
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<pmr_string>& dictionary) const;
+  std::pair<size_t, std::vector<uint8_t>> _find_matches_in_dictionary(const pmr_vector<pmr_string>& dictionary) const;
+
+  /**
+   * Used for dictionary segments and patterns of the form 'hello%'
+   * @returns the range [begin, end) of value IDs of the values that start with the prefix
+   */
+  static std::pair<ValueID, ValueID> _find_prefix_range_in_dictionary(const BaseDictionarySegment& segment,
+                                                                      const pmr_string& prefix);
 
   const LikeMatcher _matcher;
 
+  // Set if the pattern has the form 'hello%'
+  const std::optional<pmr_string> _prefix;
+
   // For NOT LIKE support
   const bool _invert_results;
 };
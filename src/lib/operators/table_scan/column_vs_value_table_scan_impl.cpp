@@ -28,6 +28,10 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnVsValueTableScanImpl::description() const { return "ColumnVsValue"; }
 
+bool ColumnVsValueTableScanImpl::can_prune_chunk(const ChunkID chunk_id) const {
+  return _can_prune_chunk(chunk_id, value);
+}
+
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -35,18 +39,23 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
   if (ordered_by && ordered_by->first == _column_id) {
     _scan_sorted_segment(segment, chunk_id, matches, position_filter, ordered_by->second);
   } else {
+    // Only scan the blocks that may contain matches according to the zone map
+    const auto candidate_ranges = _get_zone_map_candidate_ranges(chunk_id, position_filter, value);
+    if (candidate_ranges && candidate_ranges->empty()) return;
+
     // Select optimized or generic scanning implementation based on segment type
     if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
-      _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+      _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter, candidate_ranges);
     } else {
-      _scan_generic_segment(segment, chunk_id, matches, position_filter);
+      _scan_generic_segment(segment, chunk_id, matches, position_filter, candidate_ranges);
     }
   }
 }
 
-void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
-                                                       PosList& matches,
-                                                       const std::shared_ptr<const PosList>& position_filter) const {
+void ColumnVsValueTableScanImpl::_scan_generic_segment(
+    const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter,
+    const std::optional<ChunkOffsetRanges>& candidate_ranges) const {
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     // Don't instantiate this for this for DictionarySegments and ReferenceSegments to save compile time.
     // DictionarySegments are handled in _scan_dictionary_segment()
@@ -61,7 +70,7 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
         auto comparator = [predicate_comparator, typed_value](const auto& position) {
           return predicate_comparator(position.value(), typed_value);
         };
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+        _scan_ranges_with_iterators<true>(comparator, it, end, chunk_id, matches, candidate_ranges);
       });
     } else {
       Fail("Dictionary- and ReferenceSegments have their own code paths and should be handled there");
@@ -69,9 +78,10 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
   });
 }
 
-void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
-                                                          PosList& matches,
-                                                          const std::shared_ptr<const PosList>& position_filter) const {
+void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
+    const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter,
+    const std::optional<ChunkOffsetRanges>& candidate_ranges) const {
   /**
    * ValueID search_vid;              // left value id
    * AllTypeVariant search_vid_value; // dict.value_by_value_id(search_vid)
@@ -108,7 +118,7 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       // Matches all, so include all rows except those with NULLs in the result.
-      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+      _scan_ranges_with_iterators<true>(always_true, it, end, chunk_id, matches, candidate_ranges);
     });
 
     return;
@@ -129,9 +139,9 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
       if (predicate_condition == PredicateCondition::Equals ||
           predicate_condition == PredicateCondition::LessThanEquals ||
           predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+        _scan_ranges_with_iterators<false>(comparator, it, end, chunk_id, matches, candidate_ranges);
       } else {
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+        _scan_ranges_with_iterators<true>(comparator, it, end, chunk_id, matches, candidate_ranges);
       }
     });
   });
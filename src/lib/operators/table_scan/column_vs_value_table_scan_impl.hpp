@@ -29,6 +29,8 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   std::string description() const override;
 
+  bool can_prune_chunk(const ChunkID chunk_id) const override;
+
   const AllTypeVariant value;
 
  protected:
@@ -36,9 +38,11 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
-                             const std::shared_ptr<const PosList>& position_filter) const;
+                             const std::shared_ptr<const PosList>& position_filter,
+                             const std::optional<ChunkOffsetRanges>& candidate_ranges) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
-                                const std::shared_ptr<const PosList>& position_filter) const;
+                                const std::shared_ptr<const PosList>& position_filter,
+                                const std::optional<ChunkOffsetRanges>& candidate_ranges) const;
 
   void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                             const std::shared_ptr<const PosList>& position_filter,
@@ -0,0 +1,140 @@
+#include "top_n.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/operator_output_segments.hpp"
+#include "operators/sort/normalized_sort_keys.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+TopN::TopN(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression,
+           const std::shared_ptr<AbstractExpression>& offset_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopN, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression),
+      _offset_expression(offset_expression) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort column");
+}
+
+const std::string& TopN::name() const {
+  static const auto name = std::string{"TopN"};
+  return name;
+}
+
+const std::vector<SortColumnDefinition>& TopN::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopN::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractExpression> TopN::offset_expression() const { return _offset_expression; }
+
+std::shared_ptr<AbstractOperator> TopN::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopN>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy(),
+                                _offset_expression ? _offset_expression->deep_copy() : nullptr);
+}
+
+std::shared_ptr<const Table> TopN::_on_execute() {
+  const auto input_table = input_table_left();
+
+  const auto num_rows = Limit::evaluate_row_count_expression(*_row_count_expression);
+  const auto num_skipped_rows =
+      _offset_expression ? Limit::evaluate_row_count_expression(*_offset_expression) : size_t{0};
+  const auto candidate_count = num_rows + num_skipped_rows;
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  if (num_rows == 0 || input_table->row_count() <= num_skipped_rows) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+  }
+
+  auto keys = NormalizedSortKeys{input_table, _sort_definitions};
+
+  // A total order of all rows: Rows that are equal by their keys are ordered by their position in the input table,
+  // which yields the same result as a stable sort.
+  const auto comparator = [&keys](const NormalizedSortKeyEntry& lhs, const NormalizedSortKeyEntry& rhs) {
+    if (keys.less(lhs, rhs)) return true;
+    if (keys.less(rhs, lhs)) return false;
+    return lhs.row_id < rhs.row_id;
+  };
+
+  // 1. Select the candidate_count smallest rows of each chunk. The keys of all other rows are released right away, so
+  // that the memory consumption does not depend on the size of the input.
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_by_chunk = std::vector<std::vector<NormalizedSortKeyEntry>>(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& candidates = candidates_by_chunk[chunk_id];
+      candidates = keys.materialize_chunk(chunk_id);
+
+      if (candidates.size() > candidate_count) {
+        std::nth_element(candidates.begin(), candidates.begin() + candidate_count, candidates.end(), comparator);
+        candidates.resize(candidate_count);
+      }
+
+      keys.compact_chunk(chunk_id, candidates);
+    }));
+    jobs.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // 2. Select and sort the candidate_count smallest rows of all candidates
+  auto candidates = std::vector<NormalizedSortKeyEntry>{};
+  for (const auto& chunk_candidates : candidates_by_chunk) {
+    candidates.insert(candidates.end(), chunk_candidates.begin(), chunk_candidates.end());
+  }
+
+  const auto sorted_candidate_count = std::min(candidate_count, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + sorted_candidate_count, candidates.end(), comparator);
+
+  // 3. Skip the first num_skipped_rows rows and write the remaining ones to the output
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(sorted_candidate_count - num_skipped_rows);
+  std::transform(candidates.begin() + num_skipped_rows, candidates.begin() + sorted_candidate_count,
+                 std::back_inserter(*pos_list), [](const auto& entry) { return entry.row_id; });
+
+  auto input_pos_lists_by_segment = PosListsByChunk{};
+  if (input_table->type() == TableType::References) {
+    input_pos_lists_by_segment = setup_pos_lists_by_chunk(input_table);
+  }
+
+  auto output_segments = Segments{};
+  write_output_segments(output_segments, input_table, input_pos_lists_by_segment, pos_list);
+  output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+
+  const auto& primary_sort_definition = _sort_definitions.front();
+  output_chunks.back()->set_ordered_by(
+      std::make_pair(primary_sort_definition.column, primary_sort_definition.order_by_mode));
+
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+void TopN::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+  if (_offset_expression) expression_set_parameters(_offset_expression, parameters);
+}
+
+void TopN::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+  if (_offset_expression) expression_set_transaction_context(_offset_expression, transaction_context);
+}
+
+}  // namespace opossum
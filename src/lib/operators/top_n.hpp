@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first n rows (after skipping the first m rows) of its input in sort order. It is
+ * equivalent to a Sort followed by a Limit, including the stability of the Sort: rows that share the same values keep
+ * their relative order. Instead of sorting the entire input, TopN selects the n + m smallest rows of each chunk in its
+ * own job, using the normalized keys of the Sort operator (see NormalizedSortKeys). Only these candidates are kept and
+ * sorted in the end. As the output is typically small, it consists of ReferenceSegments.
+ */
+class TopN : public AbstractReadOnlyOperator {
+ public:
+  TopN(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression,
+       const std::shared_ptr<AbstractExpression>& offset_expression = nullptr);
+
+  const std::string& name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  // nullptr if no offset was given
+  std::shared_ptr<AbstractExpression> offset_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+  std::shared_ptr<AbstractExpression> _offset_expression;
+};
+
+}  // namespace opossum
@@ -1,7 +1,9 @@
 #include "update.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -9,10 +11,57 @@
 #include "delete.hpp"
 #include "hyrise.hpp"
 #include "insert.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "table_wrapper.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Materializes the values of a table column by column
+std::vector<std::vector<AllTypeVariant>> materialize_columns(const Table& table) {
+  auto columns = std::vector<std::vector<AllTypeVariant>>(table.column_count(),
+                                                          std::vector<AllTypeVariant>(table.row_count()));
+
+  auto chunk_begin_row_index = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      auto& values = columns[column_id];
+      segment_iterate(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) values[chunk_begin_row_index + position.chunk_offset()] = position.value();
+      });
+    }
+
+    chunk_begin_row_index += chunk->size();
+  }
+
+  return columns;
+}
+
+bool values_equal(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  if (variant_is_null(lhs) || variant_is_null(rhs)) return variant_is_null(lhs) && variant_is_null(rhs);
+  return lhs == rhs;
+}
+
+bool has_indexes(const Chunk& chunk) {
+  // Each index is found through the first of its columns
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    if (!chunk.get_indexes(std::vector<ColumnID>{column_id}).empty()) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Update::Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
@@ -26,7 +75,7 @@ const std::string& Update::name() const {
 }
 
 std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionContext> context) {
-  const auto table_to_update = Hyrise::get().storage_manager.get_table(_table_to_update_name);
+  _table_to_update = Hyrise::get().storage_manager.get_table(_table_to_update_name);
 
   // 0. Validate input
   DebugAssert(context, "Update needs a transaction context");
@@ -35,10 +84,17 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(input_table_left()->column_data_types() == input_table_right()->column_data_types(),
               "Update required identical layouts from its input tables");
 
-  // 1. Delete obsolete data with the Delete operator.
+  // 1. Write the changed values in place if possible
+  const auto updated_rows = _rows_to_update_in_place();
+  if (updated_rows) {
+    _update_in_place(*updated_rows, *context);
+    return nullptr;
+  }
+
+  // 2. Otherwise, delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
   if (input_table_left()->row_count() > 0) {
-    _delete = std::make_shared<Delete>(_input_left);
+    _delete = std::make_shared<Delete>(_table_to_update_name, _input_left);
     _delete->set_transaction_context(context);
     _delete->execute();
 
@@ -48,7 +104,7 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
-  // 2. Insert new data with the Insert operator.
+  // 3. Insert new data with the Insert operator.
   _insert = std::make_shared<Insert>(_table_to_update_name, _input_right);
   _insert->set_transaction_context(context);
   _insert->execute();
@@ -57,6 +113,185 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   return nullptr;
 }
 
+std::optional<std::vector<Update::UpdatedRow>> Update::_rows_to_update_in_place() const {
+  const auto& fields_to_update = *input_table_left();
+  const auto column_count = _table_to_update->column_count();
+  if (_table_to_update->has_mvcc() != UseMvcc::Yes || fields_to_update.type() != TableType::References ||
+      fields_to_update.column_count() != column_count) {
+    return std::nullopt;
+  }
+
+  const auto old_values = materialize_columns(fields_to_update);
+  const auto new_values = materialize_columns(*input_table_right());
+
+  // The input might reference a table created by GetTable (e.g., with versions applied), whose chunks share their
+  // MvccData with the stored chunks
+  auto stored_chunk_ids = std::unordered_map<const MvccData*, ChunkID>{};
+  const auto resolve_stored_chunk_id = [&](const Table& referenced_table,
+                                           const ChunkID chunk_id) -> std::optional<ChunkID> {
+    if (&referenced_table == _table_to_update.get()) return chunk_id;
+
+    if (stored_chunk_ids.empty()) {
+      for (auto stored_chunk_id = ChunkID{0}; stored_chunk_id < _table_to_update->chunk_count(); ++stored_chunk_id) {
+        const auto stored_chunk = _table_to_update->get_chunk(stored_chunk_id);
+        if (stored_chunk) stored_chunk_ids.emplace(stored_chunk->mvcc_data().get(), stored_chunk_id);
+      }
+    }
+
+    const auto iter = stored_chunk_ids.find(referenced_table.get_chunk(chunk_id)->mvcc_data().get());
+    if (iter == stored_chunk_ids.end()) return std::nullopt;
+    return iter->second;
+  };
+
+  const auto primary_key_index = _table_to_update->primary_key_index();
+
+  auto updated_rows = std::vector<UpdatedRow>{};
+  updated_rows.reserve(fields_to_update.row_count());
+
+  auto row_index = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < fields_to_update.chunk_count(); ++chunk_id) {
+    const auto chunk = fields_to_update.get_chunk(chunk_id);
+
+    // All columns have to reference the same columns of the updated table
+    const auto first_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    if (!first_segment) return std::nullopt;
+    const auto& referenced_table = first_segment->referenced_table();
+    if (referenced_table->column_count() != column_count) return std::nullopt;
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      if (!segment || segment->referenced_table() != referenced_table || segment->referenced_column_id() != column_id ||
+          segment->pos_list() != first_segment->pos_list()) {
+        return std::nullopt;
+      }
+    }
+
+    for (const auto& row_id : *first_segment->pos_list()) {
+      const auto chunk_id_in_stored_table = resolve_stored_chunk_id(*referenced_table, row_id.chunk_id);
+      if (!chunk_id_in_stored_table) return std::nullopt;
+
+      // Chunks that are encoded, sorted, or indexed have to keep their values
+      const auto stored_chunk = _table_to_update->get_chunk(*chunk_id_in_stored_table);
+      if (!stored_chunk->is_mutable() || stored_chunk->ordered_by() || has_indexes(*stored_chunk)) return std::nullopt;
+
+      auto updated_row = UpdatedRow{RowID{*chunk_id_in_stored_table, row_id.chunk_offset}, {}};
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& new_value = new_values[column_id][row_index];
+        if (values_equal(old_values[column_id][row_index], new_value)) continue;
+
+        // Only fixed-width values can be read while they are written, see ColumnVersionStore. The key of a row in the
+        // PrimaryKeyIndex must not change.
+        if (_table_to_update->column_data_type(column_id) == DataType::String ||
+            (primary_key_index && primary_key_index->column_id() == column_id) ||
+            !std::dynamic_pointer_cast<const BaseValueSegment>(stored_chunk->get_segment(column_id))) {
+          return std::nullopt;
+        }
+
+        updated_row.changed_values.emplace_back(column_id, new_value);
+      }
+
+      updated_rows.emplace_back(std::move(updated_row));
+      ++row_index;
+    }
+  }
+
+  return updated_rows;
+}
+
+void Update::_update_in_place(const std::vector<UpdatedRow>& updated_rows, const TransactionContext& context) {
+  _transaction_id = context.transaction_id();
+
+  for (const auto& updated_row : updated_rows) {
+    const auto chunk_offset = updated_row.row_id.chunk_offset;
+    const auto chunk = _table_to_update->get_chunk(updated_row.row_id.chunk_id);
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+
+    DebugAssert(Validate::is_row_visible(_transaction_id, context.snapshot_commit_id(), mvcc_data->tids[chunk_offset],
+                                         mvcc_data->begin_cids[chunk_offset], mvcc_data->end_cids[chunk_offset]),
+                "Trying to update a row that is not visible to the current transaction. Has the input been validated?");
+
+    // The row is locked in the ColumnVersionStore. Locking it through MvccData::tids would make it invisible to this
+    // transaction, as a locked row that was committed before is considered deleted by the locking transaction.
+    if (!mvcc_data->column_versions.try_lock_row(chunk_offset, _transaction_id)) {
+      _mark_as_failed();
+      return;
+    }
+    _locked_chunk_ids.emplace(updated_row.row_id.chunk_id);
+
+    // The row is locked by another transaction that deletes it. Rows inserted by this transaction carry its id.
+    const auto row_tid = mvcc_data->tids[chunk_offset].load();
+    if (row_tid != TransactionID{0} && row_tid != _transaction_id) {
+      _mark_as_failed();
+      return;
+    }
+
+    // A transaction that updated the row committed after our snapshot was taken, first updater wins
+    if (mvcc_data->column_versions.committed_after(chunk_offset, context.snapshot_commit_id())) {
+      _mark_as_failed();
+      return;
+    }
+
+    for (const auto& [column_id, value] : updated_row.changed_values) {
+      // The chunk is about to be encoded, see ColumnVersionStore::try_seal()
+      if (!mvcc_data->column_versions.add(column_id, chunk_offset, value, _transaction_id)) {
+        _mark_as_failed();
+        return;
+      }
+      _updated_cells.emplace_back(UpdatedCell{updated_row.row_id, column_id, value});
+    }
+  }
+}
+
+void Update::_on_commit_records(const CommitID cid) {
+  // Committing the versions also unlocks the rows
+  for (const auto chunk_id : _locked_chunk_ids) {
+    _table_to_update->get_chunk(chunk_id)->get_scoped_mvcc_data_lock()->column_versions.commit(_transaction_id, cid);
+  }
+
+  // Versions of earlier updates might be visible to all transactions by now. They are only installed once no Insert
+  // writes to the chunk anymore, see ColumnVersionStore.
+  if (_updated_cells.empty()) return;
+  const auto globally_visible_commit_id = Hyrise::get().transaction_manager.get_globally_visible_commit_id();
+  for (const auto chunk_id : _locked_chunk_ids) {
+    const auto chunk = _table_to_update->get_chunk(chunk_id);
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    if (chunk->is_mutable() || mvcc_data->pending_insert_count() > 0) continue;
+    mvcc_data->column_versions.install(*chunk, globally_visible_commit_id);
+  }
+}
+
+void Update::_on_rollback_records() {
+  // Rolling back the versions also unlocks the rows
+  for (const auto chunk_id : _locked_chunk_ids) {
+    _table_to_update->get_chunk(chunk_id)->get_scoped_mvcc_data_lock()->column_versions.rollback(_transaction_id);
+  }
+}
+
+void Update::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // Rows that were deleted and inserted again are logged by the Delete and Insert operators
+  if (_updated_cells.empty()) return;
+
+  log_entry.write(LogRecordType::Update);
+  log_entry.write(_table_to_update_name);
+  log_entry.write(static_cast<uint32_t>(_updated_cells.size()));
+  for (const auto& updated_cell : _updated_cells) {
+    log_entry.write(updated_cell.row_id.chunk_id);
+    log_entry.write(updated_cell.row_id.chunk_offset);
+    log_entry.write(updated_cell.column_id);
+
+    // Just like for inserted values, null flags are only written for nullable columns
+    resolve_data_type(_table_to_update->column_data_type(updated_cell.column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if (_table_to_update->column_is_nullable(updated_cell.column_id)) {
+        const auto is_null = variant_is_null(updated_cell.value);
+        log_entry.write(is_null);
+        if (is_null) return;
+      }
+      log_entry.write(boost::get<ColumnDataType>(updated_cell.value));
+    });
+  }
+}
+
 std::shared_ptr<AbstractOperator> Update::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
@@ -22,7 +25,10 @@ class Insert;
  *
  * Assumption: The input has been validated before.
  *
- * Note: Update does not support null values at the moment
+ * If all changed values are fixed-width and all updated rows are stored in mutable, unindexed chunks, the changed
+ * cells are updated in place: The new values are added as versions to the ColumnVersionStore of the chunk, which
+ * GetTable applies for transactions that can see them. Otherwise, the rows are deleted and inserted again with the
+ * new values, using the Delete and Insert operators.
  */
 class Update : public AbstractReadWriteOperator {
  public:
@@ -38,15 +44,34 @@ class Update : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // Commit happens in Insert and Delete operators
-  void _on_commit_records(const CommitID cid) override {}
+  // If the rows were deleted and inserted again, commit and rollback happen in the Delete and Insert operators
+  void _on_commit_records(const CommitID cid) override;
+  void _on_rollback_records() override;
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
 
-  // Rollback happens in Insert and Delete operators
-  void _on_rollback_records() override {}
+  struct UpdatedRow {
+    RowID row_id;  ///< Position in the stored table
+    std::vector<std::pair<ColumnID, AllTypeVariant>> changed_values;
+  };
+
+  // Returns the rows to update in place or std::nullopt if at least one of them cannot be updated in place
+  std::optional<std::vector<UpdatedRow>> _rows_to_update_in_place() const;
+  void _update_in_place(const std::vector<UpdatedRow>& updated_rows, const TransactionContext& context);
 
  protected:
   const std::string _table_to_update_name;
   std::shared_ptr<Delete> _delete;
   std::shared_ptr<Insert> _insert;
+
+  // State of an in-place update
+  struct UpdatedCell {
+    RowID row_id;
+    ColumnID column_id;
+    AllTypeVariant value;
+  };
+  std::shared_ptr<Table> _table_to_update;
+  TransactionID _transaction_id{0};
+  std::set<ChunkID> _locked_chunk_ids;
+  std::vector<UpdatedCell> _updated_cells;
 };
 }  // namespace opossum
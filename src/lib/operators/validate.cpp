@@ -23,6 +23,29 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+enum class ChunkVisibility { AllRowsVisible, NoRowsVisible, Mixed };
+
+// Uses the visibility summaries of the MVCC data to determine whether the rows of a chunk can be accepted or discarded
+// without checking them one by one.
+ChunkVisibility chunk_visibility(const Chunk& chunk, const MvccData& mvcc_data, const CommitID snapshot_commit_id) {
+  // Rows are only appended to mutable chunks, which are thus always checked row by row
+  if (chunk.is_mutable()) return ChunkVisibility::Mixed;
+
+  // Without deletes, rows are only invisible if they were inserted after the snapshot or by a pending transaction.
+  // This also covers rows that are deleted by our own transaction, as Delete registers itself before locking a row.
+  if (mvcc_data.pending_insert_count() == 0 && !mvcc_data.has_deletes() &&
+      mvcc_data.max_begin_cid() <= snapshot_commit_id) {
+    return ChunkVisibility::AllRowsVisible;
+  }
+
+  // The deleted row count is increased after the maximum end commit id has been updated
+  if (mvcc_data.deleted_row_count() == chunk.size() && mvcc_data.max_end_cid() <= snapshot_commit_id) {
+    return ChunkVisibility::NoRowsVisible;
+  }
+
+  return ChunkVisibility::Mixed;
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -139,6 +162,15 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
         auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
+        const auto visibility = chunk_visibility(*referenced_chunk, *mvcc_data, snapshot_commit_id);
+        if (visibility == ChunkVisibility::NoRowsVisible) continue;
+        if (visibility == ChunkVisibility::AllRowsVisible) {
+          // The input chunk is forwarded unfiltered
+          std::lock_guard<std::mutex> lock(output_mutex);
+          output_chunks.emplace_back(std::make_shared<Chunk>(chunk_in->segments()));
+          continue;
+        }
+
         for (auto row_id : pos_list_in) {
           if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
             pos_list_out->emplace_back(row_id);
@@ -175,12 +207,22 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
       const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
       pos_list_out->guarantee_single_chunk();
 
+      const auto visibility = chunk_visibility(*chunk_in, *mvcc_data, snapshot_commit_id);
+      if (visibility == ChunkVisibility::NoRowsVisible) continue;
+
       // Generate pos_list_out.
       auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+      if (visibility == ChunkVisibility::AllRowsVisible) {
+        pos_list_out->reserve(chunk_size);
+        for (auto i = 0u; i < chunk_size; i++) {
           pos_list_out->emplace_back(RowID{chunk_id, i});
         }
+      } else {
+        for (auto i = 0u; i < chunk_size; i++) {
+          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+            pos_list_out->emplace_back(RowID{chunk_id, i});
+          }
+        }
       }
 
       // Create actual ReferenceSegment objects.
@@ -12,6 +12,7 @@
 #include "strategy/column_pruning_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
 #include "strategy/in_expression_rewrite_rule.hpp"
+#include "strategy/index_join_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/join_predicate_ordering_rule.hpp"
@@ -20,6 +21,7 @@
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_n_rule.hpp"
 
 /**
  * IMPORTANT NOTES ON OPTIMIZING SUBQUERY LQPS
@@ -131,6 +133,13 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run once the inputs of the joins are final. UnionNodes created by the PredicateMergeRule on the index side prevent
+  // the use of the stored table's indexes.
+  optimizer->add_rule(std::make_unique<IndexJoinRule>());
+
+  // Fusing a Sort and a Limit into a TopN hides the Sort from other rules. Thus, this rule runs last.
+  optimizer->add_rule(std::make_unique<TopNRule>());
+
   return optimizer;
 }
 
@@ -11,10 +11,8 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "lossless_cast.hpp"
-#include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
-#include "statistics/statistics_objects/min_max_filter.hpp"
-#include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -170,30 +168,7 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
 bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
                                   const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
-
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
-
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
-
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {  // NOLINT
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-    }
-
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
-    }
-  });
-
-  return can_prune;
+  return can_prune_segment(base_segment_statistics, predicate_condition, variant_value, variant_value2);
 }
 
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) {
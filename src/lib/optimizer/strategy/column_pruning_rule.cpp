@@ -72,6 +72,7 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
       case LQPNodeType::Sort:
       case LQPNodeType::StaticTable:
       case LQPNodeType::StoredTable:
+      case LQPNodeType::TopN:
       case LQPNodeType::Union:
       case LQPNodeType::Validate:
       case LQPNodeType::Mock: {
@@ -0,0 +1,85 @@
+#include "index_join_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_index.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void IndexJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  DebugAssert(cost_estimator, "IndexJoinRule requires cost estimator to be set");
+  Assert(root->type == LQPNodeType::Root, "IndexJoinRule needs root to hold onto");
+
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+    join_node->join_type = JoinType::Default;
+    auto best_cost = cost_estimator->estimate_node_cost(join_node);
+    auto best_index_side = std::optional<IndexSide>{};
+
+    for (const auto index_side : {IndexSide::Right, IndexSide::Left}) {
+      join_node->join_type = JoinType::Index;
+      join_node->index_side = index_side;
+      if (!_is_index_join_applicable(join_node)) continue;
+
+      const auto cost = cost_estimator->estimate_node_cost(join_node);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_index_side = index_side;
+      }
+    }
+
+    join_node->join_type = best_index_side ? JoinType::Index : JoinType::Default;
+    join_node->index_side = best_index_side.value_or(IndexSide::Right);
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool IndexJoinRule::_is_index_join_applicable(const std::shared_ptr<JoinNode>& join_node) const {
+  if (join_node->join_mode == JoinMode::Cross || join_node->join_predicates().size() != 1) return false;
+
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+  const auto& index_input =
+      join_node->index_side == IndexSide::Left ? join_node->left_input() : join_node->right_input();
+  const auto stored_table_node = lqp_find_underlying_stored_table_node(index_input);
+  if (!stored_table_node) return false;
+
+  const auto& index_side_argument =
+      expression_evaluable_on_lqp(predicate->left_operand(), *index_input) ? predicate->left_operand()
+                                                                            : predicate->right_operand();
+  const auto column_id = stored_table_node->find_column_id(*index_side_argument);
+  if (!column_id) return false;
+
+  const auto indexes_statistics = stored_table_node->indexes_statistics();
+  const auto has_index = std::any_of(indexes_statistics.begin(), indexes_statistics.end(), [&](const auto& statistics) {
+    return statistics.column_ids == std::vector<ColumnID>{*column_id};
+  });
+  if (!has_index) return false;
+
+  // Inputs other than a StoredTableNode are translated to operators that output reference tables
+  const auto table_type = [](const auto& input) {
+    return input->type == LQPNodeType::StoredTable ? TableType::Data : TableType::References;
+  };
+
+  return JoinIndex::supports({join_node->join_mode, predicate->predicate_condition,
+                              predicate->left_operand()->data_type(), predicate->right_operand()->data_type(), false,
+                              table_type(join_node->left_input()), table_type(join_node->right_input()),
+                              join_node->index_side});
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class JoinNode;
+
+/**
+ * Marks JoinNodes that are cheaper to execute as a JoinIndex than as one of the default join operators, so that the
+ * LQPTranslator creates a JoinIndex for them (see JoinNode::join_type).
+ *
+ * A JoinNode is a candidate if it has a single equi-join predicate and one of its inputs (the index side) reads a
+ * stored table that has a single-column index on the join column. Only Validate and Predicate nodes may lie between
+ * the JoinNode and the StoredTableNode, so that the rows of the index side can be located through the indexes of the
+ * stored chunks. The cost estimator then decides between the JoinIndex, which looks up every row of the other input
+ * in the index of each chunk, and the default join, which processes both inputs entirely. Thus, an index join is
+ * chosen if the probe side is small compared to the index side, e.g., for selective foreign key lookups.
+ */
+class IndexJoinRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ protected:
+  bool _is_index_join_applicable(const std::shared_ptr<JoinNode>& join_node) const;
+};
+
+}  // namespace opossum
@@ -32,13 +32,22 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  // The chains of PredicateNodes are only reordered after the visitation, which must not see a modified LQP
+  auto predicate_chain_tops = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto primary_key_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+
   visit_lqp(root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
-      const auto& child = node->left_input();
+      // Validate and Predicate nodes between the PredicateNode and the StoredTableNode keep the column order, so
+      // that the column ids of the index statistics apply to the input of the PredicateNode
+      const auto stored_table_node = lqp_find_underlying_stored_table_node(node->left_input());
 
-      if (child->type == LQPNodeType::StoredTable) {
+      if (stored_table_node) {
         const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
-        const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
+
+        if (_is_primary_key_scan_applicable(*stored_table_node, predicate_node)) {
+          primary_key_predicate_nodes.emplace_back(predicate_node);
+        }
 
         const auto indexes_statistics = stored_table_node->indexes_statistics();
         for (const auto& index_statistics : indexes_statistics) {
@@ -46,11 +55,134 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const
             predicate_node->scan_type = ScanType::IndexScan;
           }
         }
+
+        if (!_is_predicate_chain_link(predicate_node)) predicate_chain_tops.emplace_back(predicate_node);
       }
     }
 
     return LQPVisitation::VisitInputs;
   });
+
+  // A lookup in the PrimaryKeyIndex returns at most one row and is preferred over all other indexes. The IndexScan
+  // can only use the PrimaryKeyIndex of the output of the GetTable, so the PredicateNode is moved directly on top of
+  // the StoredTableNode. Predicates and Validates filter the same rows in any order, so this does not change the
+  // result. Only one PredicateNode per StoredTableNode is moved, all others remain TableScans.
+  auto moved_primary_key_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  for (const auto& predicate_node : primary_key_predicate_nodes) {
+    auto lowest_node = std::static_pointer_cast<AbstractLQPNode>(predicate_node);
+    auto is_movable = true;
+    while (lowest_node->left_input()->type != LQPNodeType::StoredTable) {
+      lowest_node = lowest_node->left_input();
+      // Nodes with other outputs would lose rows for these outputs
+      if (lowest_node->output_count() != 1) is_movable = false;
+    }
+
+    // Another PredicateNode on the primary key was already moved to this StoredTableNode
+    if (lowest_node->type == LQPNodeType::Predicate &&
+        std::find(moved_primary_key_predicate_nodes.begin(), moved_primary_key_predicate_nodes.end(), lowest_node) !=
+            moved_primary_key_predicate_nodes.end()) {
+      continue;
+    }
+    if (!is_movable) continue;
+
+    if (lowest_node != predicate_node) {
+      lqp_remove_node(predicate_node);
+      lqp_insert_node(lowest_node, LQPInputSide::Left, predicate_node);
+    }
+    predicate_node->scan_type = ScanType::IndexScan;
+    moved_primary_key_predicate_nodes.emplace_back(predicate_node);
+  }
+
+  for (const auto& predicate_chain_top : predicate_chain_tops) {
+    // Chains that use the PrimaryKeyIndex are not reordered for a multi-column index
+    auto node = std::static_pointer_cast<AbstractLQPNode>(predicate_chain_top);
+    while (node->type == LQPNodeType::Predicate && node->left_input()->type != LQPNodeType::StoredTable) {
+      node = node->left_input();
+    }
+    if (std::find(moved_primary_key_predicate_nodes.begin(), moved_primary_key_predicate_nodes.end(), node) !=
+        moved_primary_key_predicate_nodes.end()) {
+      continue;
+    }
+
+    const auto stored_table_node = lqp_find_underlying_stored_table_node(predicate_chain_top);
+    for (const auto& index_statistics : stored_table_node->indexes_statistics()) {
+      if (_is_single_segment_index(index_statistics)) continue;
+      if (index_statistics.type != SegmentIndexType::AdaptiveRadixTree) continue;
+
+      if (_apply_multi_column_index(index_statistics, predicate_chain_top)) break;
+    }
+  }
+}
+
+bool IndexScanRule::_apply_multi_column_index(const IndexStatistics& index_statistics,
+                                              const std::shared_ptr<PredicateNode>& predicate_chain_top) const {
+  // Gather the chain of PredicateNodes below predicate_chain_top
+  auto predicate_chain = std::vector<std::shared_ptr<PredicateNode>>{predicate_chain_top};
+  while (predicate_chain.back()->left_input()->type == LQPNodeType::Predicate &&
+         predicate_chain.back()->left_input()->output_count() == 1) {
+    predicate_chain.emplace_back(std::static_pointer_cast<PredicateNode>(predicate_chain.back()->left_input()));
+  }
+  const auto chain_input = predicate_chain.back()->left_input();
+
+  // Find an equality predicate with a value for each indexed column
+  auto index_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  for (const auto column_id : index_statistics.column_ids) {
+    const auto predicate_node_iter =
+        std::find_if(predicate_chain.begin(), predicate_chain.end(), [&](const auto& predicate_node) {
+          const auto operator_predicates =
+              OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+          if (!operator_predicates || operator_predicates->size() != 1) return false;
+
+          const auto& operator_predicate = (*operator_predicates)[0];
+          return operator_predicate.column_id == column_id &&
+                 operator_predicate.predicate_condition == PredicateCondition::Equals &&
+                 is_variant(operator_predicate.value) &&
+                 !variant_is_null(boost::get<AllTypeVariant>(operator_predicate.value));
+        });
+    if (predicate_node_iter == predicate_chain.end()) return false;
+
+    index_predicate_nodes.emplace_back(*predicate_node_iter);
+  }
+
+  const auto row_count_table = cost_estimator->cardinality_estimator->estimate_cardinality(chain_input);
+  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+
+  // The selectivities of the predicates are assumed to be independent, as in the CardinalityEstimator
+  auto selectivity = 1.0f;
+  for (const auto& predicate_node : index_predicate_nodes) {
+    const auto row_count_input =
+        cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
+    if (row_count_input == 0.0f) continue;
+    selectivity *= cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node) / row_count_input;
+  }
+  if (selectivity > INDEX_SCAN_SELECTIVITY_THRESHOLD) return false;
+
+  // The LQPTranslator merges consecutive IndexScan PredicateNodes into a single IndexScan. Thus, the predicates on the
+  // indexed columns are moved to the bottom of the chain, where the IndexScan can use the indexes of the stored table.
+  // Predicates on the same input commute, so this does not change the result.
+  const auto other_predicate_node_iter =
+      std::find_if(predicate_chain.rbegin(), predicate_chain.rend(), [&](const auto& predicate_node) {
+        return std::find(index_predicate_nodes.begin(), index_predicate_nodes.end(), predicate_node) ==
+               index_predicate_nodes.end();
+      });
+  if (other_predicate_node_iter != predicate_chain.rend()) {
+    const auto lowest_other_predicate_node = *other_predicate_node_iter;
+    for (const auto& predicate_node : index_predicate_nodes) {
+      lqp_remove_node(predicate_node);
+      lqp_insert_node(lowest_other_predicate_node, LQPInputSide::Left, predicate_node);
+    }
+  }
+
+  for (const auto& predicate_node : index_predicate_nodes) {
+    predicate_node->scan_type = ScanType::IndexScan;
+  }
+
+  return true;
+}
+
+bool IndexScanRule::_is_predicate_chain_link(const std::shared_ptr<PredicateNode>& predicate_node) {
+  if (predicate_node->output_count() != 1) return false;
+  return predicate_node->outputs()[0]->type == LQPNodeType::Predicate;
 }
 
 bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_statistics,
@@ -81,6 +213,22 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
+bool IndexScanRule::_is_primary_key_scan_applicable(const StoredTableNode& stored_table_node,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) {
+  // Validate and Predicate nodes keep the column order, so the ColumnIDs of the StoredTableNode apply
+  const auto primary_key_column_id = stored_table_node.primary_key_column_id();
+  if (!primary_key_column_id) return false;
+
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates || operator_predicates->size() != 1) return false;
+
+  const auto& operator_predicate = (*operator_predicates)[0];
+  return operator_predicate.column_id == *primary_key_column_id &&
+         operator_predicate.predicate_condition == PredicateCondition::Equals && is_variant(operator_predicate.value) &&
+         !variant_is_null(boost::get<AllTypeVariant>(operator_predicate.value));
+}
+
 bool IndexScanRule::_is_single_segment_index(const IndexStatistics& index_statistics) {
   return index_statistics.column_ids.size() == 1;
 }
@@ -12,17 +12,26 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
- * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes or Validate/Predicate nodes on top of a
+ * StoredTableNode. These PredicateNodes are candidates for being executed by IndexScans. If the expected selectivity
+ * of the predicate falls below a certain threshold, the ScanType of the PredicateNode is set to IndexScan.
+ *
+ * Multi-column AdaptiveRadixTreeIndexes are used for chains of PredicateNodes that contain an equality predicate with
+ * a value for each indexed column (e.g., WHERE a = 1 AND b = 2 for an index on (a, b)). If their combined selectivity
+ * falls below the threshold, these PredicateNodes are moved to the bottom of the chain and their ScanType is set to
+ * IndexScan. The LQPTranslator then translates them into a single IndexScan.
+ *
+ * An equality predicate with a value on the column of the PrimaryKeyIndex of the stored table is always executed by an
+ * IndexScan, independent of its selectivity. Its PredicateNode is moved directly on top of the StoredTableNode (e.g.,
+ * below a ValidateNode), so that the IndexScan can use the PrimaryKeyIndex of the output of the GetTable.
  *
  * Note:
- * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
+ * Single-column index scans are only supported for GroupKeyIndexes. Multi-column predicates (i.e. WHERE a < b) are
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * and ART indexes.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -32,7 +41,15 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  // Returns true if the PredicateNodes of the chain starting at predicate_chain_top were set to use the index
+  bool _apply_multi_column_index(const IndexStatistics& index_statistics,
+                                 const std::shared_ptr<PredicateNode>& predicate_chain_top) const;
+  static bool _is_primary_key_scan_applicable(const StoredTableNode& stored_table_node,
+                                              const std::shared_ptr<PredicateNode>& predicate_node);
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
+
+  // Returns true if the only output of predicate_node is another PredicateNode
+  static bool _is_predicate_chain_link(const std::shared_ptr<PredicateNode>& predicate_node);
 };
 
 }  // namespace opossum
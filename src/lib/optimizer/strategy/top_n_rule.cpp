@@ -0,0 +1,42 @@
+#include "top_n_rule.hpp"
+
+#include <memory>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+
+namespace opossum {
+
+void TopNRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type != LQPNodeType::Limit) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // Look for a SortNode below the LimitNode, skipping nodes that neither filter nor reorder rows
+  auto sort_node_candidate = node->left_input();
+  while ((sort_node_candidate->type == LQPNodeType::Projection || sort_node_candidate->type == LQPNodeType::Alias) &&
+         sort_node_candidate->output_count() == 1) {
+    sort_node_candidate = sort_node_candidate->left_input();
+  }
+
+  if (sort_node_candidate->type != LQPNodeType::Sort || sort_node_candidate->output_count() != 1) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+  const auto sort_node = std::static_pointer_cast<SortNode>(sort_node_candidate);
+
+  const auto top_n_node = TopNNode::make(sort_node->node_expressions, sort_node->order_by_modes,
+                                         limit_node->num_rows_expression(), limit_node->offset_expression());
+  lqp_replace_node(sort_node, top_n_node);
+  lqp_remove_node(limit_node);
+
+  _apply_to_inputs(top_n_node);
+}
+
+}  // namespace opossum
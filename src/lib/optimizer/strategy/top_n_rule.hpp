@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Fuses a SortNode and a subsequent LimitNode into a TopNNode, so that only the first rows in sort order need to be
+ * determined instead of sorting the entire input. Projections and Aliases between the two nodes do not change the
+ * number or the order of rows and are thus skipped. These are added by the SQLTranslator if ORDER BY refers to
+ * columns that are not part of the SELECT list.
+ *
+ * EXAMPLE:
+ *   SELECT a FROM t ORDER BY b LIMIT 10 OFFSET 5
+ *   Limit(10, 5) -> Projection(a) -> Sort(b)   is rewritten to   Projection(a) -> TopN(b, 10, 5)
+ *
+ * The nodes are not fused if any of them has more than one output, as the output of the SortNode would then be needed
+ * in full.
+ */
+class TopNRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -101,9 +101,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  auto worker = Worker::get_this_thread_worker();
+
+  // Tasks spawned by a Worker for its own node are pushed to the Worker's deque. Other Workers of the node can steal
+  // them from there. High priority tasks go to the node's queue, which is checked before any stealing happens.
+  if (worker && priority == SchedulePriority::Default &&
+      (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker->queue()->node_id())) {
+    worker->queue()->push_to_worker(worker->deque_id(), task);
+    return;
+  }
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -34,11 +34,12 @@ namespace opossum {
  *
  * JobTasks can be used from anywhere to parallelize parts of their work.
  * If a task spawns jobs to be executed, the worker executing the main task waits for the jobs to complete.
- * Since the CPU to which the worker is pinned shall not be blocked, a new worker is (re-)activated temporarily.
- * The worker executing the main task is hibernated and will be re-activated once the jobs have completed.
- * There is only one active worker per CPU, which is allowed to pull new tasks from the queue.
- * Thus, while it is possible that two workers are executing a task at the same time, this is only until the non-active
- * worker finished its task. It will then be hibernated.
+ * Since the CPU to which the worker is pinned shall not be blocked, the waiting worker executes ready tasks itself
+ * (help-first) until all jobs are done. As the jobs were pushed to the worker's own deque (see WORK STEALING), it
+ * usually executes them itself, while idle workers steal some of them. No additional threads are started, so there is
+ * always exactly one worker per CPU, even for nested parallel operators (e.g., a JoinHash within a subquery). The
+ * main task continues on the call stack of the worker once the jobs are done and the worker has finished the task it
+ * executes at that time.
  *
  *
  * SCHEDULER AND TOPOLOGY
@@ -56,18 +57,19 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Tasks that a Worker spawns for its own node (e.g., the JobTasks of a parallel operator) are not pushed to the
+ * node's TaskQueue, but to a work-stealing deque owned by the Worker (see WorkStealingDeque). The Worker executes these
+ * tasks in LIFO order, which keeps their data in its cache and avoids contention on the node's queue when many short
+ * jobs are spawned. A worker gets idle if its deque and the queue of its node are empty. It then steals from the top
+ * of the deque of another Worker of the same node, starting with a randomly chosen one.
+ *
+ * If there is no task on its node, the current worker is checking another queue for a ready task. Checking another
+ * queue means accessing another node (remote node). As of the physical distance of nodes, accessing a remote nodes is
+ * ~1.6 times slower than accessing a local node. [1]
+ * Only the TaskQueues of remote nodes are checked, which (unlike the deques of their Workers) can skip tasks that are
+ * not stealable. If no task was found,
+ * the current worker sleeps until a task is pushed to its node or a timeout expires, and then checks its local node
+ * again.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -1,6 +1,8 @@
 #include "task_queue.hpp"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "abstract_task.hpp"
@@ -14,6 +16,9 @@ bool TaskQueue::empty() const {
   for (const auto& queue : _queues) {
     if (!queue.empty()) return false;
   }
+  for (const auto& worker_deque : _worker_deques) {
+    if (!worker_deque->empty()) return false;
+  }
   return true;
 }
 
@@ -28,13 +33,13 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   task->set_node_id(_node_id);
   _queues[priority].push(task);
 
-  new_task.notify_one();
+  _notify_sleeping_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
+  for (auto priority = uint32_t{0}; priority < LOW_PRIORITY; ++priority) {
+    if (_queues[priority].try_pop(task)) {
       return task;
     }
   }
@@ -43,7 +48,8 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
+  for (auto priority = uint32_t{0}; priority < LOW_PRIORITY; ++priority) {
+    auto& queue = _queues[priority];
     if (queue.try_pop(task)) {
       if (task->is_stealable()) {
         return task;
@@ -55,4 +61,66 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::pull_low_priority() {
+  std::shared_ptr<AbstractTask> task;
+  if (_queues[LOW_PRIORITY].try_pop(task)) return task;
+  return nullptr;
+}
+
+size_t TaskQueue::add_worker_deque() {
+  _worker_deques.emplace_back(std::make_unique<WorkStealingDeque>());
+  return _worker_deques.size() - 1;
+}
+
+void TaskQueue::push_to_worker(size_t worker_deque_id, const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(worker_deque_id < _worker_deques.size(), "Invalid worker deque id");
+
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_node_id);
+  _worker_deques[worker_deque_id]->push(task);
+
+  // Wake up an idle Worker of this node, which can then steal the task
+  _notify_sleeping_worker();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull_from_worker(size_t worker_deque_id) {
+  DebugAssert(worker_deque_id < _worker_deques.size(), "Invalid worker deque id");
+  return _worker_deques[worker_deque_id]->pop();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal_from_workers(size_t thief_deque_id, size_t first_victim_offset) {
+  const auto deque_count = _worker_deques.size();
+  for (auto victim_offset = size_t{0}; victim_offset < deque_count; ++victim_offset) {
+    const auto victim_deque_id = (thief_deque_id + first_victim_offset + victim_offset) % deque_count;
+    if (victim_deque_id == thief_deque_id) continue;
+
+    auto task = _worker_deques[victim_deque_id]->steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+void TaskQueue::wait_for_new_task(std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> unique_lock(_new_task_mutex);
+
+  ++_sleeping_worker_count;
+
+  // A task pushed between the Worker's last (unsuccessful) attempt to pull a task and the increment above did not
+  // notify anyone. Check again so that the Worker does not sleep until the timeout in that case.
+  if (empty()) {
+    _new_task.wait_for(unique_lock, timeout);
+  }
+
+  --_sleeping_worker_count;
+}
+
+void TaskQueue::_notify_sleeping_worker() {
+  if (_sleeping_worker_count.load() == 0) return;
+
+  // Acquiring the mutex ensures that a Worker that registered itself is already waiting on the condition variable
+  { std::lock_guard<std::mutex> lock_guard(_new_task_mutex); }
+  _new_task.notify_one();
+}
+
 }  // namespace opossum
@@ -4,21 +4,27 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
 class AbstractTask;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Additionally, it holds a WorkStealingDeque for
+ * each Worker of the node, to which tasks spawned by that Worker are pushed.
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
+  static constexpr uint32_t LOW_PRIORITY = static_cast<uint32_t>(SchedulePriority::Low);
 
   explicit TaskQueue(NodeID node_id);
 
@@ -29,28 +35,69 @@ class TaskQueue {
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Returns a Tasks that is ready to be executed and removes it from the queue. Tasks with SchedulePriority::Low are
+   * not returned, see pull_low_priority().
    */
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues. Tasks with
+   * SchedulePriority::Low are not stolen.
    */
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Returns a task with SchedulePriority::Low (i.e., background work) and removes it from the queue. Workers only call
+   * this if they found no other task, neither in this queue nor by stealing.
    */
-  std::condition_variable new_task;
+  std::shared_ptr<AbstractTask> pull_low_priority();
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Adds a deque for a Worker of this node. Must be called before the Workers are started.
+   * @return The id of the deque, which is passed to the methods below
    */
-  std::mutex lock;
+  size_t add_worker_deque();
+
+  /**
+   * Pushes a task to the deque of a Worker. Must only be called by the Worker owning the deque.
+   */
+  void push_to_worker(size_t worker_deque_id, const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Returns the task most recently pushed to the deque of a Worker and removes it from the deque. Must only be called
+   * by the Worker owning the deque.
+   */
+  std::shared_ptr<AbstractTask> pull_from_worker(size_t worker_deque_id);
+
+  /**
+   * Steals the oldest task from the deque of another Worker of this node. The deques are checked one after another,
+   * starting with the deque at first_victim_offset (relative to the thief), so that thieves do not all compete for the
+   * same deque.
+   */
+  std::shared_ptr<AbstractTask> steal_from_workers(size_t thief_deque_id, size_t first_victim_offset);
+
+  /**
+   * Called by idle Workers. Blocks until a new task is pushed to this queue or one of its deques, or until the timeout
+   * expires (whatever occurs first).
+   */
+  void wait_for_new_task(std::chrono::microseconds timeout);
 
  private:
+  // Wakes up a Worker sleeping in wait_for_new_task(), if there is one
+  void _notify_sleeping_worker();
+
   NodeID _node_id;
+
+  // Notifies one sleeping Worker as soon as a new task gets pushed into the queue
+  std::condition_variable _new_task;
+  std::mutex _new_task_mutex;
+
+  // Number of Workers in wait_for_new_task(). Pushing a task only notifies the condition variable if this is not zero,
+  // which saves the system call for the common case of busy Workers.
+  std::atomic<uint32_t> _sleeping_worker_count{0};
+
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::vector<std::unique_ptr<WorkStealingDeque>> _worker_deques;
 };
 
 }  // namespace opossum
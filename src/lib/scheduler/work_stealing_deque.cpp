@@ -0,0 +1,108 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<Slot[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+std::shared_ptr<AbstractTask>* WorkStealingDeque::Buffer::get(const int64_t index) const {
+  return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(const int64_t index, std::shared_ptr<AbstractTask>* task) {
+  slots[static_cast<size_t>(index) & (capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Free the tasks that have never been taken
+  while (pop()) {
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, bottom, top);
+  }
+
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_seq_cst);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task, so we race against the thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!task) return nullptr;
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_seq_cst);
+
+  if (top >= bottom) return nullptr;
+
+  auto* task = _buffer.load(std::memory_order_acquire)->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Another thief or the owner took the task first
+    return nullptr;
+  }
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+bool WorkStealingDeque::empty() const {
+  return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t bottom, const int64_t top) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(_buffers.back().get(), std::memory_order_release);
+  return _buffers.back().get();
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A lock-free work-stealing deque of tasks, following the dynamic circular deque by Chase and Lev [1]. Each Worker owns
+ * one deque: Tasks spawned by the Worker are pushed to and popped from the bottom of the deque (LIFO), so that a Worker
+ * continues with the jobs it just spawned and whose data is likely still in its cache. Other Workers steal from the
+ * top of the deque (FIFO), i.e., the oldest tasks.
+ *
+ * The memory orderings are based on Lê et al. [2]. Instead of standalone fences, the accesses to top and bottom that
+ * must not be reordered are sequentially consistent themselves, which thread sanitizer can reason about.
+ *
+ * push() and pop() may only be called by the owning Worker, steal() may be called by any thread.
+ *
+ * The deque stores heap-allocated shared_ptrs, as shared_ptrs themselves cannot be read atomically. A thief may read a
+ * slot that is concurrently taken by another thread, but only dereferences it after it has won the slot. When the
+ * deque grows, the old buffer might still be read by thieves, so it is only freed when the deque is destroyed.
+ *
+ * [1] Chase, Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005
+ * [2] Lê, Pop, Cohen, Zappa Nardelli: Correct and Efficient Work-Stealing for Weak Memory Models, PPoPP 2013
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 1024);
+  ~WorkStealingDeque();
+
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Returns the most recently pushed task and removes it from the deque, or nullptr if the deque is empty
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Returns the least recently pushed task and removes it from the deque, or nullptr if the deque is empty or another
+   * thread took the task first
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * The result is only a snapshot while other threads access the deque
+   */
+  bool empty() const;
+
+ private:
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    std::shared_ptr<AbstractTask>* get(const int64_t index) const;
+    void put(const int64_t index, std::shared_ptr<AbstractTask>* task);
+
+    const size_t capacity;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, const int64_t bottom, const int64_t top);
+
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Owns the current buffer and all buffers that have been replaced by a larger one
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -28,12 +29,15 @@ thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
 // The sleep time was determined experimentally
 static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
 
+// Number of unsuccessful attempts after which a waiting Worker starts to sleep instead of yielding
+static constexpr auto WORKER_YIELD_ROUNDS = uint32_t{16};
+
 namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _deque_id(queue->add_worker_deque()), _random_engine(id) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -41,6 +45,8 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+size_t Worker::deque_id() const { return _deque_id; }
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -53,11 +59,23 @@ void Worker::operator()() {
   }
 }
 
-void Worker::_work() {
-  auto task = _queue->pull();
+bool Worker::_work(const bool allow_sleep) {
+  // Tasks spawned by this Worker are executed first and in LIFO order, as their data is likely still in the cache.
+  // Then, tasks scheduled to the node are executed.
+  auto task = _queue->pull_from_worker(_deque_id);
+  if (!task) {
+    task = _queue->pull();
+  }
+
+  if (!task) {
+    // Steal from the other Workers of this node. Each attempt starts with a random Worker so that idle Workers do not
+    // all compete for the same deque.
+    task = _queue->steal_from_workers(_deque_id, _random_engine());
+  }
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
+    // Simple work stealing without explicitly transferring data between nodes. Only the queues of other nodes are
+    // checked, as their Workers' deques may contain tasks that must not be stolen from the node.
     auto work_stealing_successful = false;
     for (auto& queue : Hyrise::get().scheduler()->queues()) {
       if (queue == _queue) {
@@ -72,14 +90,20 @@ void Worker::_work() {
       }
     }
 
+    // Background tasks are only executed if there is nothing else to do
+    if (!work_stealing_successful) {
+      task = _queue->pull_low_priority();
+      work_stealing_successful = task != nullptr;
+    }
+
     // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
+    // own queue or returns after timer exceeded (whatever occurs first). A Worker that waits for other tasks to finish
+    // returns immediately and backs off in _wait_for_tasks(), as the awaited tasks do not notify it when they are done.
     if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
+      if (allow_sleep) {
+        _queue->wait_for_new_task(WORKER_SLEEP_TIME);
       }
-      return;
+      return false;
     }
   }
 
@@ -88,6 +112,19 @@ void Worker::_work() {
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
   _num_finished_tasks++;
+
+  return true;
+}
+
+void Worker::_back_off(const uint32_t idle_rounds) {
+  // The awaited tasks are often about to finish, so the first rounds only yield
+  if (idle_rounds < WORKER_YIELD_ROUNDS) {
+    std::this_thread::yield();
+    return;
+  }
+
+  const auto shift = std::min(idle_rounds - WORKER_YIELD_ROUNDS, uint32_t{8});
+  std::this_thread::sleep_for(std::min(std::chrono::microseconds{uint32_t{1} << shift}, WORKER_SLEEP_TIME));
 }
 
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
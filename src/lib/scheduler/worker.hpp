@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <random>
 #include <thread>
 #include <vector>
 
@@ -13,8 +14,9 @@ namespace opossum {
 class TaskQueue;
 
 /**
- * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
- * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is
+ * set. There is exactly one Worker (and thus one thread) per CPU. A Worker that waits for tasks executes other tasks
+ * in the meantime instead of blocking its CPU, see _wait_for_tasks().
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -31,6 +33,11 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
 
+  /**
+   * Id of the Worker's WorkStealingDeque in its TaskQueue
+   */
+  size_t deque_id() const;
+
   void start();
   void join();
 
@@ -41,8 +48,26 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
  protected:
   void operator()();
-  void _work();
 
+  /**
+   * Executes one ready task and returns true. If no task is found, the Worker either sleeps until a new task is pushed
+   * to its node or a timeout expires (allow_sleep == true), or returns immediately (allow_sleep == false). In both
+   * cases, false is returned.
+   */
+  bool _work(const bool allow_sleep = true);
+
+  /**
+   * Called by a waiting Worker that found no task to execute for idle_rounds consecutive attempts. It first yields
+   * and then sleeps for exponentially growing periods, so that a long wait does not keep the CPU busy.
+   */
+  static void _back_off(const uint32_t idle_rounds);
+
+  /**
+   * Help-first waiting: Instead of blocking, the Worker keeps executing ready tasks until all tasks are done. Most
+   * likely, these are the awaited tasks themselves, as they were pushed to the Worker's deque last. If the awaited
+   * tasks are executed by other Workers, the Worker does not wait for new tasks to be pushed (as the awaited tasks do not
+   * notify it), but backs off while it finds nothing to do.
+   */
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     auto tasks_completed = [&tasks]() {
@@ -55,8 +80,13 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
       return true;
     };
 
+    auto idle_rounds = uint32_t{0};
     while (!tasks_completed()) {
-      _work();
+      if (_work(false)) {
+        idle_rounds = 0;
+      } else {
+        _back_off(idle_rounds++);
+      }
     }
   }
 
@@ -70,8 +100,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
+  size_t _deque_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+
+  // Used to select the first Worker to steal from. Only accessed by the Worker's own thread.
+  std::minstd_rand _random_engine;
 };
 
 }  // namespace opossum
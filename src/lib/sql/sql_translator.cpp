@@ -418,7 +418,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_delete(const hsql::De
     data_to_delete_node = _translate_predicate_expression(delete_where_expression, data_to_delete_node);
   }
 
-  return DeleteNode::make(data_to_delete_node);
+  return DeleteNode::make(delete_statement.tableName, data_to_delete_node);
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::UpdateStatement& update) {
@@ -1050,9 +1050,11 @@ void SQLTranslator::_translate_order_by(const std::vector<hsql::OrderDescription
 }
 
 void SQLTranslator::_translate_limit(const hsql::LimitDescription& limit) {
-  AssertInput(!limit.offset, "OFFSET not supported");
+  AssertInput(limit.limit, "OFFSET without LIMIT not supported");
   const auto num_rows_expression = _translate_hsql_expr(*limit.limit, _sql_identifier_resolver);
-  _current_lqp = LimitNode::make(num_rows_expression, _current_lqp);
+  const auto offset_expression =
+      limit.offset ? _translate_hsql_expr(*limit.offset, _sql_identifier_resolver) : nullptr;
+  _current_lqp = LimitNode::make(num_rows_expression, offset_expression, _current_lqp);
 }
 
 // NOLINTNEXTLINE - while this particular method could be made static, others cannot.
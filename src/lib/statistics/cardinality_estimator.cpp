@@ -1,5 +1,6 @@
 #include "cardinality_estimator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -19,6 +20,7 @@
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "lossy_cast.hpp"
@@ -62,6 +64,45 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+std::shared_ptr<TableStatistics> estimate_limit(const std::shared_ptr<AbstractExpression>& num_rows_expression,
+                                                const std::shared_ptr<AbstractExpression>& offset_expression,
+                                                const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // For LimitNodes with a value as limit_expression, create a TableStatistics object with that value as row_count.
+  // Otherwise, forward the input statistics for now.
+
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(num_rows_expression);
+  if (!value_expression) return input_table_statistics;
+
+  const auto row_count = lossy_variant_cast<float>(value_expression->value);
+  if (!row_count) {
+    // `value_expression->value` being NULL does not make much sense, but that is not the concern of the
+    // CardinalityEstimator
+    return input_table_statistics;
+  }
+
+  // Rows skipped by an OFFSET are not part of the output. If the offset is not a value, ignore it.
+  auto available_row_count = input_table_statistics->row_count;
+  if (const auto offset_value_expression = std::dynamic_pointer_cast<ValueExpression>(offset_expression)) {
+    const auto offset = lossy_variant_cast<float>(offset_value_expression->value);
+    if (offset) available_row_count = std::max(0.0f, available_row_count - *offset);
+  }
+
+  // Number of rows can never exceed number of input rows
+  const auto clamped_row_count = std::min(*row_count, available_row_count);
+
+  auto column_statistics =
+      std::vector<std::shared_ptr<BaseAttributeStatistics>>{input_table_statistics->column_statistics.size()};
+
+  for (auto column_id = ColumnID{0}; column_id < input_table_statistics->column_statistics.size(); ++column_id) {
+    resolve_data_type(input_table_statistics->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      column_statistics[column_id] = std::make_shared<AttributeStatistics<ColumnDataType>>();
+    });
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), clamped_row_count);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -157,6 +198,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
       output_table_statistics = left_input_table_statistics;
     } break;
 
+    case LQPNodeType::TopN: {
+      const auto top_n_node = std::dynamic_pointer_cast<TopNNode>(lqp);
+      output_table_statistics = estimate_top_n_node(*top_n_node, left_input_table_statistics);
+    } break;
+
     case LQPNodeType::StoredTable: {
       const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(lqp);
 
@@ -431,34 +477,13 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_union_node(
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_limit_node(
     const LimitNode& limit_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
-  // For LimitNodes with a value as limit_expression, create a TableStatistics object with that value as row_count.
-  // Otherwise, forward the input statistics for now.
-
-  if (const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node.num_rows_expression())) {
-    const auto row_count = lossy_variant_cast<float>(value_expression->value);
-    if (!row_count) {
-      // `value_expression->value` being NULL does not make much sense, but that is not the concern of the
-      // CardinalityEstimator
-      return input_table_statistics;
-    }
-
-    // Number of rows can never exceed number of input rows
-    const auto clamped_row_count = std::min(*row_count, input_table_statistics->row_count);
-
-    auto column_statistics =
-        std::vector<std::shared_ptr<BaseAttributeStatistics>>{limit_node.column_expressions().size()};
-
-    for (auto column_id = ColumnID{0}; column_id < input_table_statistics->column_statistics.size(); ++column_id) {
-      resolve_data_type(input_table_statistics->column_data_type(column_id), [&](const auto data_type_t) {
-        using ColumnDataType = typename decltype(data_type_t)::type;
-        column_statistics[column_id] = std::make_shared<AttributeStatistics<ColumnDataType>>();
-      });
-    }
+  return estimate_limit(limit_node.num_rows_expression(), limit_node.offset_expression(), input_table_statistics);
+}
 
-    return std::make_shared<TableStatistics>(std::move(column_statistics), clamped_row_count);
-  } else {
-    return input_table_statistics;
-  }
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_top_n_node(
+    const TopNNode& top_n_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // The TopNNode emits the same rows as a Sort followed by a Limit. Sorting does not change the statistics.
+  return estimate_limit(top_n_node.num_rows_expression(), top_n_node.offset_expression(), input_table_statistics);
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_predicate(
@@ -24,6 +24,7 @@ class PredicateNode;
 class JoinNode;
 class UnionNode;
 class LimitNode;
+class TopNNode;
 
 /**
  * Hyrise's default, statistics-based cardinality estimator
@@ -64,6 +65,9 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
 
   static std::shared_ptr<TableStatistics> estimate_limit_node(
       const LimitNode& limit_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
+
+  static std::shared_ptr<TableStatistics> estimate_top_n_node(
+      const TopNNode& top_n_node, const std::shared_ptr<TableStatistics>& input_table_statistics);
   /** @} */
 
   /**
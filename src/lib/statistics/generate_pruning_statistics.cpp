@@ -15,6 +15,7 @@
 #include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/table.hpp"
 
 namespace {
@@ -78,6 +79,12 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
   }
 
   chunk->set_pruning_statistics(chunk_statistics);
+
+  auto zone_maps = ChunkZoneMaps{chunk->column_count()};
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    zone_maps[column_id] = create_segment_zone_map(*chunk->get_segment(column_id));
+  }
+  chunk->set_zone_maps(zone_maps);
 }
 
 void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table) {
@@ -93,4 +100,32 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table) {
   }
 }
 
+bool can_prune_segment(const BaseAttributeStatistics& segment_statistics, const PredicateCondition predicate_condition,
+                       const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) {
+  auto can_prune = false;
+
+  resolve_data_type(segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& typed_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(segment_statistics);
+
+    // Range filters are only available for arithmetic (non-string) types.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {  // NOLINT
+      if (typed_statistics.range_filter) {
+        if (typed_statistics.range_filter->does_not_contain(predicate_condition, value, value2)) {
+          can_prune = true;
+        }
+      }
+    }
+
+    if (typed_statistics.min_max_filter) {
+      if (typed_statistics.min_max_filter->does_not_contain(predicate_condition, value, value2)) {
+        can_prune = true;
+      }
+    }
+  });
+
+  return can_prune;
+}
+
 }  // namespace opossum
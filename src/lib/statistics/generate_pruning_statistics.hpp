@@ -1,15 +1,20 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
 namespace opossum {
 
+class BaseAttributeStatistics;
 class Chunk;
 class Table;
 
 /**
- * Generate Pruning Filters for an immutable Chunk
+ * Generate Pruning Filters and zone maps (see BaseSegmentZoneMap) for an immutable Chunk
  */
 void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk);
 
@@ -18,4 +23,12 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk);
  */
 void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table);
 
+/**
+ * Returns true if the pruning statistics of a segment show that none of its values satisfies
+ * `column <predicate_condition> value (AND value2)`. The values are expected to be of the column's data type.
+ * Used by the ChunkPruningRule at optimization time and by the TableScan for values only known at execution time.
+ */
+bool can_prune_segment(const BaseAttributeStatistics& segment_statistics, const PredicateCondition predicate_condition,
+                       const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2 = std::nullopt);
+
 }  // namespace opossum
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -12,13 +13,19 @@
 #include "index/abstract_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
+#include "segment_zone_map.hpp"
 #include "utils/assert.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
 Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc, Indexes indexes)
-    : _segments(std::move(segments)), _mvcc_data(mvcc_data), _indexes(std::move(indexes)) {
+    : _segments(std::move(segments)),
+      _mvcc_data(mvcc_data),
+      _indexes(std::make_shared<const Indexes>(std::move(indexes))),
+      _reserved_row_count(size()),
+      _grown_row_count(size()) {
   Assert(!_segments.empty(),
          "Chunks without Segments are not legal, as the row count of such a Chunk cannot be determined");
 
@@ -27,7 +34,9 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
   const auto is_reference_chunk =
       !_segments.empty() ? std::dynamic_pointer_cast<ReferenceSegment>(_segments.front()) != nullptr : false;
 
-  DebugAssert(!_mvcc_data || _mvcc_data->size() == chunk_size, "Invalid MvccData size");
+  // Chunks that share the MvccData of a mutable chunk (see GetTable) might be created while rows are added to it. The
+  // MvccData is grown first in that case.
+  DebugAssert(!_mvcc_data || _mvcc_data->size() >= chunk_size, "Invalid MvccData size");
   for (const auto& segment : _segments) {
     DebugAssert(
         !mvcc_data || !std::dynamic_pointer_cast<ReferenceSegment>(segment),
@@ -68,6 +77,64 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  ++_reserved_row_count;
+  ++_grown_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset max_chunk_size) {
+  // A concurrent Insert might have filled the Chunk and marked it immutable after the caller checked is_mutable()
+  if (!is_mutable()) {
+    const auto reserved_row_count = _reserved_row_count.load();
+    return {reserved_row_count, reserved_row_count};
+  }
+
+  // A compare-and-swap instead of a fetch-add, so that the reserved row count never exceeds max_chunk_size
+  auto begin = _reserved_row_count.load();
+  auto end = begin;
+  do {
+    if (begin >= max_chunk_size) return {begin, begin};
+    end = begin + std::min(row_count, static_cast<ChunkOffset>(max_chunk_size - begin));
+  } while (!_reserved_row_count.compare_exchange_weak(begin, end));
+
+  return {begin, end};
+}
+
+void Chunk::grow_reserved_rows(const ChunkOffset begin, const ChunkOffset end, const TransactionID transaction_id) {
+  DebugAssert(begin < end && end <= _reserved_row_count, "Rows have not been reserved");
+
+  while (_grown_row_count.load() != begin) {
+    std::this_thread::yield();
+  }
+
+  // Grow MVCC vectors and mark new (but still empty) rows as being under modification by the inserting transaction.
+  // Do so before resizing the Segments, because the resize of `_segments.front()` is what releases the new row count.
+  if (has_mvcc_data()) {
+    get_scoped_mvcc_data_lock()->grow_by(end - begin, transaction_id, MvccData::MAX_COMMIT_ID);
+  }
+
+  // Grow data Segments. Do so in REVERSE column order so that the resize of `_segments.front()` happens last.
+  for (auto reverse_column_id = ColumnID{0}; reverse_column_id < column_count(); ++reverse_column_id) {
+    const auto column_id = static_cast<ColumnID>(column_count() - reverse_column_id - 1);
+    const auto segment = get_segment(column_id);
+
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+      Assert(value_segment, "Cannot insert into non-ValueSegments");
+
+      value_segment->values().resize(end);
+      if (value_segment->is_nullable()) {
+        value_segment->null_values().resize(end);
+      }
+    });
+
+    // Make sure the first column's resize actually happens last and doesn't get reordered.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  _grown_row_count = end;
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -96,8 +163,9 @@ std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
 
 std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  const auto indexes = std::atomic_load(&_indexes);
   auto result = std::vector<std::shared_ptr<AbstractIndex>>();
-  std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(result),
+  std::copy_if(indexes->cbegin(), indexes->cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
 }
@@ -109,11 +177,12 @@ std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(const std::vector
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_type,
                                                 const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
-  auto index_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
+  const auto indexes = std::atomic_load(&_indexes);
+  auto index_it = std::find_if(indexes->cbegin(), indexes->cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
 
-  return (index_it == _indexes.cend()) ? nullptr : *index_it;
+  return (index_it == indexes->cend()) ? nullptr : *index_it;
 }
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_type,
@@ -122,10 +191,20 @@ std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_typ
   return get_index(index_type, segments);
 }
 
-void Chunk::remove_index(const std::shared_ptr<AbstractIndex>& index) {
-  auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
-  DebugAssert(it != _indexes.cend(), "Trying to remove a non-existing index");
-  _indexes.erase(it);
+void Chunk::remove_index(const std::shared_ptr<AbstractIndex>& index) { replace_indexes({index}, {}); }
+
+void Chunk::replace_indexes(const std::vector<std::shared_ptr<AbstractIndex>>& indexes_to_remove,
+                            const std::vector<std::shared_ptr<AbstractIndex>>& indexes_to_add) {
+  // Writers are serialized, readers keep using the previous indexes until the new ones are stored
+  const auto lock = std::lock_guard<std::mutex>{_index_mutex};
+  auto indexes = std::make_shared<Indexes>(*std::atomic_load(&_indexes));
+  for (const auto& index : indexes_to_remove) {
+    const auto it = std::find(indexes->cbegin(), indexes->cend(), index);
+    DebugAssert(it != indexes->cend(), "Trying to remove a non-existing index");
+    indexes->erase(it);
+  }
+  indexes->insert(indexes->cend(), indexes_to_add.cbegin(), indexes_to_add.cend());
+  std::atomic_store(&_indexes, std::shared_ptr<const Indexes>{std::move(indexes)});
 }
 
 bool Chunk::references_exactly_one_table() const {
@@ -150,7 +229,7 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indexes is not implemented yet.
-  if (!_indexes.empty()) {
+  if (!std::atomic_load(&_indexes)->empty()) {
     Fail("Cannot migrate Chunk with Indexes.");
   }
 
@@ -173,6 +252,12 @@ size_t Chunk::estimate_memory_usage() const {
 
   // TODO(anybody) Index memory usage missing
 
+  if (const auto zone_maps = std::atomic_load(&_zone_maps)) {
+    for (const auto& zone_map : *zone_maps) {
+      if (zone_map) bytes += zone_map->estimate_memory_usage();
+    }
+  }
+
   if (_mvcc_data) {
     bytes += sizeof(_mvcc_data->tids) + sizeof(_mvcc_data->begin_cids) + sizeof(_mvcc_data->end_cids);
     bytes += _mvcc_data->tids.size() * sizeof(decltype(_mvcc_data->tids)::value_type);
@@ -199,15 +284,31 @@ std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments_for_ids(
   return segments;
 }
 
-const std::optional<ChunkPruningStatistics>& Chunk::pruning_statistics() const { return _pruning_statistics; }
+std::shared_ptr<const ChunkPruningStatistics> Chunk::pruning_statistics() const {
+  return std::atomic_load(&_pruning_statistics);
+}
 
 void Chunk::set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics) {
   Assert(!is_mutable(), "Cannot set pruning statistics on mutable chunks.");
   Assert(!pruning_statistics || pruning_statistics->size() == column_count(),
          "Pruning statistics must have same number of segments as Chunk");
 
-  _pruning_statistics = pruning_statistics;
+  auto statistics = std::shared_ptr<const ChunkPruningStatistics>{};
+  if (pruning_statistics) statistics = std::make_shared<const ChunkPruningStatistics>(*pruning_statistics);
+  std::atomic_store(&_pruning_statistics, statistics);
 }
+
+std::shared_ptr<const ChunkZoneMaps> Chunk::zone_maps() const { return std::atomic_load(&_zone_maps); }
+
+void Chunk::set_zone_maps(const std::optional<ChunkZoneMaps>& zone_maps) {
+  Assert(!is_mutable(), "Cannot set zone maps on mutable chunks.");
+  Assert(!zone_maps || zone_maps->size() == column_count(), "Zone maps must have same number of segments as Chunk");
+
+  auto chunk_zone_maps = std::shared_ptr<const ChunkZoneMaps>{};
+  if (zone_maps) chunk_zone_maps = std::make_shared<const ChunkZoneMaps>(*zone_maps);
+  std::atomic_store(&_zone_maps, chunk_zone_maps);
+}
+
 void Chunk::increase_invalid_row_count(const uint64_t count) const { _invalid_row_count += count; }
 
 void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
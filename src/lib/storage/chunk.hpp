@@ -9,8 +9,10 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -26,10 +28,12 @@ namespace opossum {
 class AbstractIndex;
 class BaseSegment;
 class BaseAttributeStatistics;
+class BaseSegmentZoneMap;
 
 using Segments = pmr_vector<std::shared_ptr<BaseSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractIndex>>;
 using ChunkPruningStatistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>;
+using ChunkZoneMaps = std::vector<std::shared_ptr<BaseSegmentZoneMap>>;
 
 /**
  * A Chunk is a horizontal partition of a table.
@@ -69,6 +73,21 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Used by Insert to append rows to a mutable chunk without locking the table: Reserves up to row_count rows for the
+   * calling thread and returns their offsets [begin, end). Fewer rows than requested (or none) are reserved if the
+   * chunk reaches max_chunk_size. The reserved rows are not part of the chunk until grow_reserved_rows() is called.
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count, const ChunkOffset max_chunk_size);
+
+  /**
+   * Grows the MVCC data and the ValueSegments by the reserved rows [begin, end), which are locked for the inserting
+   * transaction, but not yet filled. tbb::concurrent_vector does not wait for the construction of elements that were
+   * grown by other threads. Thus, rows are grown in the order of their reservation, i.e., this waits until all rows
+   * before begin have been grown (which is quick, as the rows are filled afterwards).
+   */
+  void grow_reserved_rows(const ChunkOffset begin, const ChunkOffset end, const TransactionID transaction_id);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -98,6 +117,11 @@ class Chunk : private Noncopyable {
 
   std::shared_ptr<MvccData> mvcc_data() const;
 
+  /**
+   * Indexes are replaced copy-on-write: Readers work on a snapshot of the chunk's indexes, which create_index(),
+   * remove_index(), and replace_indexes() atomically exchange.
+   * @{
+   */
   std::vector<std::shared_ptr<AbstractIndex>> get_indexes(
       const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
   std::vector<std::shared_ptr<AbstractIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
@@ -120,7 +144,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
-    _indexes.emplace_back(index);
+    replace_indexes({}, {index});
     return index;
   }
 
@@ -132,6 +156,12 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<AbstractIndex>& index);
 
+  // Removes the indexes in indexes_to_remove and adds those in indexes_to_add in one step, so that concurrent readers
+  // see either all previous or all new indexes
+  void replace_indexes(const std::vector<std::shared_ptr<AbstractIndex>>& indexes_to_remove,
+                       const std::vector<std::shared_ptr<AbstractIndex>>& indexes_to_add);
+  /** @} */
+
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
   bool references_exactly_one_table() const;
@@ -139,13 +169,24 @@ class Chunk : private Noncopyable {
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
   /**
-   * To perform Chunk pruning, a Chunk can be associated with statistics.
+   * To perform Chunk pruning, a Chunk can be associated with statistics. They are set atomically, pruning_statistics()
+   * returns a snapshot (or nullptr if there are none).
    * @{
    */
-  const std::optional<ChunkPruningStatistics>& pruning_statistics() const;
+  std::shared_ptr<const ChunkPruningStatistics> pruning_statistics() const;
   void set_pruning_statistics(const std::optional<ChunkPruningStatistics>& pruning_statistics);
   /** @} */
 
+  /**
+   * Block-level minimums and maximums of the segments of an immutable Chunk, used by the TableScan to skip blocks
+   * inside the Chunk. See BaseSegmentZoneMap. They are set atomically, zone_maps() returns a snapshot (or nullptr if
+   * there are none).
+   * @{
+   */
+  std::shared_ptr<const ChunkZoneMaps> zone_maps() const;
+  void set_zone_maps(const std::optional<ChunkZoneMaps>& zone_maps);
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -188,12 +229,18 @@ class Chunk : private Noncopyable {
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
-  Indexes _indexes;
-  std::optional<ChunkPruningStatistics> _pruning_statistics;
-  bool _is_mutable = true;
+  std::shared_ptr<const Indexes> _indexes;
+  std::mutex _index_mutex;
+  std::shared_ptr<const ChunkPruningStatistics> _pruning_statistics;
+  std::shared_ptr<const ChunkZoneMaps> _zone_maps;
+  std::atomic_bool _is_mutable{true};
   std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
   mutable std::atomic_uint64_t _invalid_row_count = 0;
   std::optional<CommitID> _cleanup_commit_id;
+
+  // Rows reserved by and grown for Insert, see reserve_rows() and grow_reserved_rows()
+  std::atomic<ChunkOffset> _reserved_row_count;
+  std::atomic<ChunkOffset> _grown_row_count;
 };
 
 }  // namespace opossum
@@ -11,6 +11,7 @@
 
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/encoding_advisor.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment.hpp"
@@ -129,6 +130,11 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   encode_chunk(chunk, column_data_types, chunk_encoding_spec);
 }
 
+void ChunkEncoder::encode_chunk_automatically(const std::shared_ptr<Chunk>& chunk,
+                                              const std::vector<DataType>& column_data_types) {
+  encode_chunk(chunk, column_data_types, EncodingAdvisor::advise_chunk_encoding(*chunk, column_data_types));
+}
+
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs) {
   const auto column_data_types = table->column_data_types();
@@ -46,6 +46,12 @@ class ChunkEncoder {
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                            const SegmentEncodingSpec& segment_encoding_spec = {});
 
+  /**
+   * @brief Encodes a chunk using the SegmentEncodingSpecs chosen for its segments by the EncodingAdvisor
+   */
+  static void encode_chunk_automatically(const std::shared_ptr<Chunk>& chunk,
+                                         const std::vector<DataType>& column_data_types);
+
   /**
    * @brief Encodes the specified chunks of the passed table
    *
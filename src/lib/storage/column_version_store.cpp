@@ -0,0 +1,202 @@
+#include "column_version_store.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool ColumnVersionStore::try_lock_row(const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto [iter, inserted] = _row_locks.emplace(chunk_offset, transaction_id);
+  return inserted || iter->second == transaction_id;
+}
+
+bool ColumnVersionStore::is_locked_by_other(const ChunkOffset chunk_offset, const TransactionID transaction_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _row_locks.find(chunk_offset);
+  return iter != _row_locks.end() && iter->second != transaction_id;
+}
+
+bool ColumnVersionStore::add(const ColumnID column_id, const ChunkOffset chunk_offset, const AllTypeVariant& value,
+                             const TransactionID transaction_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_sealed) return false;
+
+  _versions.emplace_back(Version{column_id, chunk_offset, value, transaction_id, std::nullopt});
+  _version_count = _versions.size();
+  return true;
+}
+
+void ColumnVersionStore::commit(const TransactionID transaction_id, const CommitID commit_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (auto& version : _versions) {
+    if (!version.commit_id && version.transaction_id == transaction_id) version.commit_id = commit_id;
+  }
+  _release_row_locks(transaction_id);
+}
+
+void ColumnVersionStore::rollback(const TransactionID transaction_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _versions.erase(std::remove_if(_versions.begin(), _versions.end(),
+                                 [&](const auto& version) {
+                                   return !version.commit_id && version.transaction_id == transaction_id;
+                                 }),
+                  _versions.end());
+  _version_count = _versions.size();
+  _release_row_locks(transaction_id);
+}
+
+bool ColumnVersionStore::empty() const { return _version_count == 0; }
+
+bool ColumnVersionStore::try_seal() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (!_versions.empty()) return false;
+
+  _sealed = true;
+  return true;
+}
+
+bool ColumnVersionStore::committed_after(const ChunkOffset chunk_offset, const CommitID snapshot_commit_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return std::any_of(_versions.begin(), _versions.end(), [&](const auto& version) {
+    return version.chunk_offset == chunk_offset && version.commit_id && *version.commit_id > snapshot_commit_id;
+  });
+}
+
+std::vector<ColumnVersionStore::Version> ColumnVersionStore::visible_versions(const TransactionID transaction_id,
+                                                                              const CommitID snapshot_commit_id) const {
+  auto visible_versions = std::vector<Version>{};
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (const auto& version : _versions) {
+    if (version.commit_id ? *version.commit_id <= snapshot_commit_id : version.transaction_id == transaction_id) {
+      visible_versions.emplace_back(version);
+    }
+  }
+
+  return visible_versions;
+}
+
+void ColumnVersionStore::install(Chunk& chunk, const CommitID commit_id) {
+  DebugAssert(!chunk.is_mutable(), "Versions cannot be installed while Inserts might write to the chunk");
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  // If a segment was encoded in the meantime, the versions of its column cannot be installed anymore and stay in the
+  // store
+  const auto column_count = chunk.column_count();
+  auto value_segments = std::vector<std::shared_ptr<const BaseValueSegment>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    value_segments[column_id] = std::dynamic_pointer_cast<const BaseValueSegment>(chunk.get_segment(column_id));
+  }
+
+  auto installed_versions = std::vector<Version>{};
+  auto remaining_versions = std::vector<Version>{};
+  for (auto& version : _versions) {
+    if (version.commit_id && *version.commit_id <= commit_id && value_segments[version.column_id]) {
+      installed_versions.emplace_back(std::move(version));
+    } else {
+      remaining_versions.emplace_back(std::move(version));
+    }
+  }
+  if (installed_versions.empty()) return;
+
+  // apply() writes the versions in the order in which they were added, so that the latest version of a cell wins
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto has_versions = std::any_of(installed_versions.begin(), installed_versions.end(),
+                                          [&](const auto& version) { return version.column_id == column_id; });
+    if (!has_versions) continue;
+
+    const auto& value_segment = *value_segments[column_id];
+    chunk.replace_segment(column_id, apply(value_segment, value_segment.is_nullable(), column_id, installed_versions));
+  }
+
+  _versions = std::move(remaining_versions);
+  _version_count = _versions.size();
+}
+
+std::shared_ptr<BaseSegment> ColumnVersionStore::apply(const BaseSegment& segment, const bool nullable,
+                                                       const ColumnID column_id, const std::vector<Version>& versions) {
+  auto versioned_segment = std::shared_ptr<BaseSegment>{};
+
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      Fail("Versions of string columns are not supported");
+    } else {
+      // The segment might grow concurrently, rows beyond its current size are not visible anyway
+      const auto row_count = segment.size();
+      auto values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_concurrent_vector<bool>(nullable ? row_count : 0);
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        const auto chunk_offset = position.chunk_offset();
+        if (chunk_offset >= row_count) return;
+
+        if (position.is_null()) {
+          null_values[chunk_offset] = true;
+        } else {
+          values[chunk_offset] = position.value();
+        }
+      });
+
+      const auto value_segment =
+          nullable ? std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values))
+                   : std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+      for (const auto& version : versions) {
+        if (version.column_id == column_id) write_value(*value_segment, version.chunk_offset, version.value);
+      }
+
+      versioned_segment = value_segment;
+    }
+  });
+
+  return versioned_segment;
+}
+
+bool ColumnVersionStore::write_value(BaseSegment& segment, const ChunkOffset chunk_offset,
+                                     const AllTypeVariant& value) {
+  auto written = false;
+
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto* value_segment = dynamic_cast<ValueSegment<ColumnDataType>*>(&segment);
+    if (!value_segment) return;
+
+    if (variant_is_null(value)) {
+      Assert(value_segment->is_nullable(), "Cannot write NULL to a segment that is not nullable");
+      value_segment->null_values()[chunk_offset] = true;
+    } else {
+      value_segment->values()[chunk_offset] = boost::get<ColumnDataType>(value);
+      if (value_segment->is_nullable()) value_segment->null_values()[chunk_offset] = false;
+    }
+    written = true;
+  });
+
+  return written;
+}
+
+void ColumnVersionStore::_release_row_locks(const TransactionID transaction_id) {
+  for (auto iter = _row_locks.begin(); iter != _row_locks.end();) {
+    if (iter->second == transaction_id) {
+      iter = _row_locks.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+/**
+ * Stores the values that Update wrote to single cells of a chunk, which is referenced by the MvccData of the chunk.
+ *
+ * Update does not overwrite values in the segments of the chunk right away, as operators might read the segments
+ * directly (e.g., a TableScan below a Validate) and would then see values that are not visible to their transaction.
+ * Instead, the new values are added to this store as versions of the updated cells. GetTable applies the versions that
+ * are visible to its transaction to copies of the affected segments. As soon as a committed version is visible to all
+ * active transactions and to all transactions that will be started, it can be installed, i.e., written to a copy of
+ * the segment that replaces the segment in the chunk, and removed from the store. Operators that still read the
+ * previous segment are not affected. Versions are only installed once no Insert writes to the chunk anymore, as the
+ * values written to the previous segment would be lost otherwise.
+ *
+ * Versions can only be installed into ValueSegments. Chunks with uninstalled versions are not considered completed by
+ * the ChunkCompressionTask for this reason, and the store is sealed before a chunk is encoded.
+ *
+ * Update locks the rows it writes versions for in this store, not through MvccData::tids, which mark rows as deleted
+ * by the locking transaction (see Validate::is_row_visible()). Update fails for rows that are locked in MvccData::tids
+ * by another transaction, and Delete fails for rows that are locked in this store by another transaction.
+ * Additionally, transactions fail to update or delete a row for which a version was committed after their snapshot.
+ */
+class ColumnVersionStore : private Noncopyable {
+ public:
+  struct Version {
+    ColumnID column_id;
+    ChunkOffset chunk_offset;
+    AllTypeVariant value;
+    TransactionID transaction_id;
+    std::optional<CommitID> commit_id;  ///< std::nullopt until the transaction commits
+  };
+
+  // Locks the row for updates by the given transaction. Returns false if it is locked by another transaction.
+  bool try_lock_row(const ChunkOffset chunk_offset, const TransactionID transaction_id);
+
+  // True if the row is locked by a transaction other than the given one
+  bool is_locked_by_other(const ChunkOffset chunk_offset, const TransactionID transaction_id) const;
+
+  // The new value of a cell written by a transaction that holds the lock on the row. Returns false if the store was
+  // sealed.
+  bool add(const ColumnID column_id, const ChunkOffset chunk_offset, const AllTypeVariant& value,
+           const TransactionID transaction_id);
+
+  // Both commit() and rollback() release the row locks of the transaction. The versions are committed before other
+  // transactions can lock the rows, so that they detect the conflict.
+  void commit(const TransactionID transaction_id, const CommitID commit_id);
+  void rollback(const TransactionID transaction_id);
+
+  // True if no versions are stored. Does not acquire the lock.
+  bool empty() const;
+
+  /**
+   * Prevents any further versions from being added, so that the segments of the chunk can be replaced by encoded ones
+   * (into which versions cannot be installed). Fails and returns false if the store is not empty.
+   */
+  bool try_seal();
+
+  // True if a version of the row was committed after the given snapshot
+  bool committed_after(const ChunkOffset chunk_offset, const CommitID snapshot_commit_id) const;
+
+  // Versions that are visible to the given transaction, in the order in which they were added
+  std::vector<Version> visible_versions(const TransactionID transaction_id, const CommitID snapshot_commit_id) const;
+
+  /**
+   * Writes the committed versions with a commit id of at most the given one to copies of the segments of the chunk,
+   * replaces the segments with the copies, and removes the versions from the store. The caller has to make sure that
+   * these versions are visible to all active transactions (see TransactionManager::get_globally_visible_commit_id())
+   * and that the chunk is immutable and has no pending inserts.
+   */
+  void install(Chunk& chunk, const CommitID commit_id);
+
+  /**
+   * Returns a copy of the segment with the versions of the given column applied. Only for fixed-width data types.
+   */
+  static std::shared_ptr<BaseSegment> apply(const BaseSegment& segment, const bool nullable, const ColumnID column_id,
+                                            const std::vector<Version>& versions);
+
+  // Writes a value to a ValueSegment. Returns false if the segment is not a ValueSegment.
+  static bool write_value(BaseSegment& segment, const ChunkOffset chunk_offset, const AllTypeVariant& value);
+
+ private:
+  // Requires the lock on _mutex
+  void _release_row_locks(const TransactionID transaction_id);
+
+  mutable std::mutex _mutex;
+  std::vector<Version> _versions;
+  std::unordered_map<ChunkOffset, TransactionID> _row_locks;
+  std::atomic<size_t> _version_count{0};
+  bool _sealed{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,308 @@
+#include "encoding_advisor.hpp"
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Counts the bits like SimdBp128Compressor::_bits_needed_per_block(), but at least one
+uint32_t required_bits(const uint64_t max_value) {
+  auto bits = uint32_t{1};
+  for (auto remaining_value = max_value >> 1u; remaining_value != 0; remaining_value >>= 1u) {
+    ++bits;
+  }
+  return bits;
+}
+
+// Size of a vector of `count` values smaller than or equal to max_value compressed using the given type
+size_t compressed_vector_size(const size_t count, const uint64_t max_value,
+                              const std::optional<VectorCompressionType> vector_compression_type) {
+  if (vector_compression_type == VectorCompressionType::SimdBp128) {
+    // Bit-packed values and one byte of meta data per block of 128 values
+    return count * required_bits(max_value) / 8 + count / 128;
+  }
+
+  const auto value_bytes = max_value <= std::numeric_limits<uint8_t>::max()    ? 1
+                           : max_value <= std::numeric_limits<uint16_t>::max() ? 2
+                                                                               : 4;
+  return count * value_bytes;
+}
+
+// Size of a value stored in a vector, e.g., in a dictionary. The characters of strings are stored on the heap.
+size_t value_size(const DataType data_type, const double average_string_length) {
+  auto size = size_t{0};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    size = sizeof(ColumnDataType);
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      size += static_cast<size_t>(std::ceil(average_string_length));
+    }
+  });
+  return size;
+}
+
+// Ratio between the size of the data and its size after compressing it with LZ4
+double lz4_compression_ratio(const std::vector<char>& data) {
+  if (data.empty()) return 1.0;
+
+  auto compressed_data = std::vector<char>(LZ4_compressBound(static_cast<int>(data.size())));
+  const auto compressed_size = LZ4_compress_default(data.data(), compressed_data.data(), static_cast<int>(data.size()),
+                                                    static_cast<int>(compressed_data.size()));
+  if (compressed_size <= 0) return 1.0;
+
+  return std::max(1.0, static_cast<double>(data.size()) / compressed_size);
+}
+
+template <typename T>
+EncodingAdvisor::SegmentCharacteristics analyze_values(const std::shared_ptr<const BaseSegment>& segment) {
+  auto characteristics = EncodingAdvisor::SegmentCharacteristics{};
+  const auto row_count = size_t{segment->size()};
+  characteristics.row_count = row_count;
+  if (row_count == 0) return characteristics;
+
+  // The blocks of the sample are spread evenly across the segment. Small segments are sampled entirely.
+  const auto block_count = std::min(EncodingAdvisor::SAMPLE_BLOCK_COUNT,
+                                    (row_count + EncodingAdvisor::SAMPLE_BLOCK_SIZE - 1) /
+                                        EncodingAdvisor::SAMPLE_BLOCK_SIZE);
+  const auto block_distance = std::max(size_t{EncodingAdvisor::SAMPLE_BLOCK_SIZE}, row_count / block_count);
+
+  const auto accessor = create_segment_accessor<T>(segment);
+
+  auto sample_size = size_t{0};
+  auto sample_null_count = size_t{0};
+  auto sample_run_count = size_t{0};
+  auto value_counts = std::unordered_map<T, size_t>{};
+  auto previous_sorted_value = std::optional<T>{};
+  auto string_length_sum = size_t{0};
+  auto raw_values = std::vector<char>{};
+  auto previous_value = std::optional<std::optional<T>>{};
+  auto previous_block_end = ChunkOffset{0};
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = static_cast<ChunkOffset>(block_index * block_distance);
+    const auto block_end =
+        static_cast<ChunkOffset>(std::min(size_t{block_begin} + EncodingAdvisor::SAMPLE_BLOCK_SIZE, row_count));
+
+    // Runs might have ended in between two blocks that are not adjacent, so the next block starts a new run
+    if (block_begin != previous_block_end) previous_value.reset();
+    previous_block_end = block_end;
+
+    auto block_min = std::optional<T>{};
+    auto block_max = std::optional<T>{};
+
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto value = accessor->access(chunk_offset);
+      ++sample_size;
+
+      if (!previous_value || *previous_value != value) ++sample_run_count;
+      previous_value = value;
+
+      if (!value) {
+        ++sample_null_count;
+        continue;
+      }
+
+      ++value_counts[*value];
+
+      if (previous_sorted_value && *value < *previous_sorted_value) characteristics.is_sorted = false;
+      previous_sorted_value = value;
+
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        string_length_sum += value->size();
+        characteristics.max_string_length = std::max(characteristics.max_string_length, value->size());
+        raw_values.insert(raw_values.end(), value->begin(), value->end());
+      } else {
+        const auto* value_bytes = reinterpret_cast<const char*>(&*value);
+        raw_values.insert(raw_values.end(), value_bytes, value_bytes + sizeof(T));
+      }
+
+      if constexpr (std::is_integral_v<T>) {
+        block_min = std::min(block_min.value_or(*value), *value);
+        block_max = std::max(block_max.value_or(*value), *value);
+      }
+    }
+
+    if constexpr (std::is_integral_v<T>) {
+      if (block_min) {
+        const auto block_range = static_cast<uint64_t>(*block_max) - static_cast<uint64_t>(*block_min);
+        characteristics.block_value_range_bits =
+            std::max(characteristics.block_value_range_bits, required_bits(block_range));
+      }
+    }
+  }
+
+  const auto scale = static_cast<double>(row_count) / sample_size;
+  characteristics.null_count = static_cast<size_t>(std::round(sample_null_count * scale));
+
+  // The distinct count is estimated using the Guaranteed-Error Estimator (GEE, Charikar et al., "Towards estimation
+  // error guarantees for distinct values", PODS 2000): values that occur once in the sample are assumed to represent
+  // sqrt(row_count / sample_size) distinct values of the segment.
+  const auto sample_distinct_count = value_counts.size();
+  const auto singleton_count = static_cast<size_t>(
+      std::count_if(value_counts.begin(), value_counts.end(), [](const auto& entry) { return entry.second == 1; }));
+  const auto estimated_distinct_count =
+      std::sqrt(scale) * static_cast<double>(singleton_count) + (sample_distinct_count - singleton_count);
+  characteristics.distinct_count =
+      std::max(sample_distinct_count, std::min(static_cast<size_t>(std::round(estimated_distinct_count)),
+                                               row_count - characteristics.null_count));
+
+  // In a sorted segment, each distinct value forms a single run
+  const auto null_run_count = size_t{characteristics.null_count > 0 ? 1u : 0u};
+  characteristics.run_count = characteristics.is_sorted
+                                  ? characteristics.distinct_count + null_run_count
+                                  : static_cast<size_t>(std::round(sample_run_count * scale));
+
+  const auto non_null_sample_size = sample_size - sample_null_count;
+  if (non_null_sample_size > 0) {
+    characteristics.average_string_length = static_cast<double>(string_length_sum) / non_null_sample_size;
+  }
+
+  characteristics.lz4_compression_ratio = lz4_compression_ratio(raw_values);
+
+  return characteristics;
+}
+
+}  // namespace
+
+namespace opossum {
+
+EncodingAdvisor::SegmentCharacteristics EncodingAdvisor::analyze_segment(
+    const std::shared_ptr<const BaseSegment>& segment, const DataType data_type) {
+  auto characteristics = SegmentCharacteristics{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    characteristics = analyze_values<ColumnDataType>(segment);
+  });
+  return characteristics;
+}
+
+size_t EncodingAdvisor::estimate_memory_usage(const SegmentCharacteristics& characteristics, const DataType data_type,
+                                              const SegmentEncodingSpec& encoding_spec) {
+  const auto row_count = characteristics.row_count;
+  const auto distinct_count = characteristics.distinct_count;
+  const auto null_values_size = characteristics.null_count > 0 ? row_count / 8 : 0;
+
+  const auto value_size = ::value_size(data_type, characteristics.average_string_length);
+
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return row_count * value_size + null_values_size;
+
+    case EncodingType::Dictionary:
+      // NULL is represented by the value id distinct_count
+      return distinct_count * value_size +
+             compressed_vector_size(row_count, distinct_count, encoding_spec.vector_compression_type);
+
+    case EncodingType::FixedStringDictionary:
+      return distinct_count * characteristics.max_string_length +
+             compressed_vector_size(row_count, distinct_count, encoding_spec.vector_compression_type);
+
+    case EncodingType::FrameOfReference: {
+      const auto block_count = (row_count + FrameOfReferenceSegment<int32_t>::block_size - 1) /
+                               FrameOfReferenceSegment<int32_t>::block_size;
+      const auto max_offset = (uint64_t{1} << characteristics.block_value_range_bits) - 1;
+      return block_count * value_size +
+             compressed_vector_size(row_count, max_offset, encoding_spec.vector_compression_type) +
+             null_values_size;
+    }
+
+    case EncodingType::RunLength:
+      // Value, end position and NULL flag per run
+      return characteristics.run_count * (value_size + sizeof(ChunkOffset)) + characteristics.run_count / 8;
+
+    case EncodingType::LZ4: {
+      if (data_type != DataType::String) {
+        const auto raw_size = row_count * value_size;
+        return static_cast<size_t>(raw_size / characteristics.lz4_compression_ratio) + null_values_size;
+      }
+
+      // The characters of all strings are compressed, their offsets are stored in a compressed vector
+      const auto raw_size = static_cast<size_t>(row_count * characteristics.average_string_length);
+      return static_cast<size_t>(raw_size / characteristics.lz4_compression_ratio) +
+             compressed_vector_size(row_count, raw_size, encoding_spec.vector_compression_type);
+    }
+  }
+
+  Fail("Invalid enum value");
+}
+
+double EncodingAdvisor::estimate_scan_cost(const SegmentCharacteristics& characteristics,
+                                           const SegmentEncodingSpec& encoding_spec) {
+  // Relative per-row costs. Scans of dictionary-encoded segments compare value ids and are used as the baseline. Bit-
+  // packed vectors are more expensive to decompress than byte-aligned ones. LZ4 has to decompress entire blocks.
+  const auto vector_decompression_cost =
+      encoding_spec.vector_compression_type == VectorCompressionType::SimdBp128 ? 0.5 : 0.0;
+  const auto run_share = characteristics.row_count > 0
+                             ? static_cast<double>(characteristics.run_count) / characteristics.row_count
+                             : 1.0;
+
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+    case EncodingType::Dictionary:
+    case EncodingType::FixedStringDictionary:
+      return 1.0 + vector_decompression_cost;
+    case EncodingType::FrameOfReference:
+      return 1.5 + vector_decompression_cost;
+    case EncodingType::RunLength:
+      // Each run is compared once, but positions are still emitted per row
+      return 0.5 + 2.0 * run_share;
+    case EncodingType::LZ4:
+      return 10.0;
+  }
+
+  Fail("Invalid enum value");
+}
+
+SegmentEncodingSpec EncodingAdvisor::advise_segment_encoding(const std::shared_ptr<const BaseSegment>& segment,
+                                                             const DataType data_type) {
+  const auto characteristics = analyze_segment(segment, data_type);
+
+  auto best_encoding_spec = SegmentEncodingSpec{};
+  auto best_score = std::numeric_limits<double>::max();
+  for (const auto& encoding_spec : all_segment_encoding_specs) {
+    if (encoding_spec.encoding_type == EncodingType::Unencoded) continue;
+    if (!encoding_supports_data_type(encoding_spec.encoding_type, data_type)) continue;
+
+    const auto score = static_cast<double>(estimate_memory_usage(characteristics, data_type, encoding_spec)) +
+                       SCAN_COST_WEIGHT * estimate_scan_cost(characteristics, encoding_spec) *
+                           static_cast<double>(characteristics.row_count);
+    if (score < best_score) {
+      best_score = score;
+      best_encoding_spec = encoding_spec;
+    }
+  }
+
+  return best_encoding_spec;
+}
+
+ChunkEncodingSpec EncodingAdvisor::advise_chunk_encoding(const Chunk& chunk,
+                                                         const std::vector<DataType>& column_data_types) {
+  Assert(column_data_types.size() == chunk.column_count(),
+         "Number of column types must match the chunk’s column count.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(chunk.column_count());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto& segment = chunk.get_segment(column_id);
+    chunk_encoding_spec.emplace_back(advise_segment_encoding(segment, column_data_types[column_id]));
+  }
+  return chunk_encoding_spec;
+}
+
+}  // namespace opossum
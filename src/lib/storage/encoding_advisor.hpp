@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+/**
+ * Chooses the encoding of a segment based on the characteristics of its data, so that segments do not have to be
+ * encoded using a fixed SegmentEncodingSpec per column.
+ *
+ * The characteristics are determined from a sample of the segment, which consists of SAMPLE_BLOCK_COUNT blocks of
+ * SAMPLE_BLOCK_SIZE consecutive rows spread evenly across the segment. For each SegmentEncodingSpec that supports the
+ * data type of the segment (see all_segment_encoding_specs), the advisor estimates the memory usage of the encoded
+ * segment and the cost of scanning it. The spec with the lowest weighted sum of both is chosen.
+ *
+ * The estimates are coarse. They are meant to pick a reasonable encoding, not to predict the actual memory usage.
+ */
+class EncodingAdvisor {
+ public:
+  struct SegmentCharacteristics {
+    size_t row_count{0};
+
+    // Estimated for the entire segment from the sample
+    size_t null_count{0};
+    size_t distinct_count{0};
+    size_t run_count{0};
+
+    // True if the non-NULL values of the sample are in ascending order
+    bool is_sorted{true};
+
+    // Number of bits needed to store the difference between the largest and the smallest value of a sample block. Only
+    // for integral data types.
+    uint32_t block_value_range_bits{0};
+
+    // Only for strings
+    double average_string_length{0.0};
+    size_t max_string_length{0};
+
+    // Ratio between the size of the sampled values and their size after LZ4 compression
+    double lz4_compression_ratio{1.0};
+  };
+
+  static SegmentCharacteristics analyze_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                const DataType data_type);
+
+  // Estimated memory usage in bytes of a segment with the given characteristics when encoded using the spec
+  static size_t estimate_memory_usage(const SegmentCharacteristics& characteristics, const DataType data_type,
+                                      const SegmentEncodingSpec& encoding_spec);
+
+  // Estimated relative cost of scanning a segment with the given characteristics when encoded using the spec
+  static double estimate_scan_cost(const SegmentCharacteristics& characteristics,
+                                   const SegmentEncodingSpec& encoding_spec);
+
+  static SegmentEncodingSpec advise_segment_encoding(const std::shared_ptr<const BaseSegment>& segment,
+                                                     const DataType data_type);
+
+  static ChunkEncodingSpec advise_chunk_encoding(const Chunk& chunk, const std::vector<DataType>& column_data_types);
+
+  static constexpr auto SAMPLE_BLOCK_SIZE = ChunkOffset{2048};
+  static constexpr auto SAMPLE_BLOCK_COUNT = size_t{8};
+
+  // Weight of the scan cost (per row) relative to the memory usage (in bytes)
+  static constexpr auto SCAN_COST_WEIGHT = 1.0;
+};
+
+}  // namespace opossum
@@ -22,65 +22,114 @@ size_t AdaptiveRadixTreeIndex::estimate_memory_consumption(ChunkOffset row_count
 }
 
 AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
-    : AbstractIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
-      _indexed_segment(segments_to_index.empty()  // Empty segment list is illegal
-                           ? nullptr              // but range check needed for accessing the first segment
-                           : std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index.front())) {
-  Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
-  Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
-
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_indexed_segment->attribute_vector()->size());
-
-  const auto null_value_id = _indexed_segment->null_value_id();
-  _null_positions.reserve(_indexed_segment->attribute_vector()->size());
-
-  resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
-    auto chunk_offset = ChunkOffset{0u};
-    auto value_id_iter = attribute_vector.cbegin();
-    for (; value_id_iter != attribute_vector.cend(); ++value_id_iter, ++chunk_offset) {
-      if (static_cast<ValueID>(*value_id_iter) == null_value_id) {
-        _null_positions.emplace_back(chunk_offset);
-      } else {
-        pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_iter}), chunk_offset);
+    : AbstractIndex{get_index_type_of<AdaptiveRadixTreeIndex>()} {
+  Assert(!segments_to_index.empty(), "AdaptiveRadixTree requires at least one segment to be indexed");
+
+  _indexed_segments.reserve(segments_to_index.size());
+  for (const auto& segment : segments_to_index) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    Assert(dictionary_segment, "AdaptiveRadixTree only works with dictionary segments for now");
+    Assert(segment->size() == segments_to_index.front()->size(), "AdaptiveRadixTree requires segments of equal size");
+    _indexed_segments.emplace_back(dictionary_segment);
+  }
+
+  const auto segment_count = _indexed_segments.size();
+  const auto row_count = _indexed_segments.front()->attribute_vector()->size();
+
+  // Gather the value ids of all indexed segments row by row. Rows that are NULL in any segment are not inserted.
+  auto value_ids = std::vector<ValueID>(row_count * segment_count);
+  auto is_null = std::vector<bool>(row_count);
+
+  for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+    const auto null_value_id = _indexed_segments[segment_id]->null_value_id();
+
+    const auto& segment_attribute_vector = *_indexed_segments[segment_id]->attribute_vector();
+    resolve_compressed_vector_type(segment_attribute_vector, [&](const auto& attribute_vector) {
+      auto chunk_offset = ChunkOffset{0u};
+      auto value_id_iter = attribute_vector.cbegin();
+      for (; value_id_iter != attribute_vector.cend(); ++value_id_iter, ++chunk_offset) {
+        const auto value_id = static_cast<ValueID>(*value_id_iter);
+        value_ids[chunk_offset * segment_count + segment_id] = value_id;
+        if (value_id == null_value_id) is_null[chunk_offset] = true;
       }
+    });
+  }
+
+  // For each row, create a pair consisting of a BinaryComparable of its value ids and its ChunkOffset (needed for
+  // bulk-inserting).
+  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
+  pairs_to_insert.reserve(row_count);
+  _null_positions.reserve(row_count);
+
+  auto row_value_ids = std::vector<ValueID>(segment_count);
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < row_count; ++chunk_offset) {
+    if (is_null[chunk_offset]) {
+      _null_positions.emplace_back(chunk_offset);
+      continue;
     }
-  });
+
+    const auto row_begin = value_ids.cbegin() + chunk_offset * segment_count;
+    std::copy(row_begin, row_begin + segment_count, row_value_ids.begin());
+    pairs_to_insert.emplace_back(BinaryComparable(row_value_ids), chunk_offset);
+  }
 
   _null_positions.shrink_to_fit();
   _root = _bulk_insert(pairs_to_insert);
 }
 
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
-  Assert((values.size() == 1), "Adaptive Radix Tree Index expects exactly one input value");
-  // the caller is responsible for not passing a NULL value
-  Assert(!variant_is_null(values[0]), "Null was passed to lower_bound().");
-
-  ValueID value_id = _indexed_segment->lower_bound(values[0]);
-  if (value_id == INVALID_VALUE_ID) {
-    return _chunk_offsets.end();
-  } else if (_root) {  // _root is nullptr if the index contains NULL positions only
-    return _root->lower_bound(BinaryComparable(value_id), 0);
-  } else {
-    return _cend();
-  }
+  Assert(!values.empty() && values.size() <= _indexed_segments.size(),
+         "Adaptive Radix Tree Index expects between one value and one value per indexed segment");
+
+  // _root is nullptr if the index contains NULL positions only
+  if (!_root) return _cend();
+
+  return _root->lower_bound(_create_key(values, false), 0);
 }
 
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
-  Assert((values.size() == 1), "Adaptive Radix Tree Index expects exactly one input value");
-  // the caller is responsible for not passing a NULL value
-  Assert(!variant_is_null(values[0]), "Null was passed to upper_bound().");
-
-  ValueID value_id = _indexed_segment->upper_bound(values[0]);
-  if (value_id == INVALID_VALUE_ID) {
-    return _chunk_offsets.end();
-  } else if (_root) {  // _root is nullptr if the index contains NULL positions only
-    return _root->lower_bound(BinaryComparable(value_id), 0);
-  } else {
-    return _cend();
+  Assert(!values.empty() && values.size() <= _indexed_segments.size(),
+         "Adaptive Radix Tree Index expects between one value and one value per indexed segment");
+
+  // _root is nullptr if the index contains NULL positions only
+  if (!_root) return _cend();
+
+  // The upper bound of the values is the lower bound of the smallest key that is greater than theirs
+  return _root->lower_bound(_create_key(values, true), 0);
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable AdaptiveRadixTreeIndex::_create_key(const std::vector<AllTypeVariant>& values,
+                                                                             const bool is_upper_bound) const {
+  // Segments without a value are filled with the smallest value id
+  auto value_ids = std::vector<ValueID>(_indexed_segments.size(), ValueID{0u});
+
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    // the caller is responsible for not passing a NULL value
+    Assert(!variant_is_null(values[value_index]), "Null was passed to lower_bound() or upper_bound().");
+
+    const auto& segment = *_indexed_segments[value_index];
+
+    // INVALID_VALUE_ID is returned if all values of the segment are smaller. In the key, it is replaced by the number
+    // of unique values, which is greater than all value ids of the segment.
+    const auto to_key_value_id = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? ValueID{segment.unique_values_count()} : value_id;
+    };
+
+    const auto lower_value_id = to_key_value_id(segment.lower_bound(values[value_index]));
+    const auto upper_value_id = to_key_value_id(segment.upper_bound(values[value_index]));
+
+    if (lower_value_id == upper_value_id) {
+      // The value is not contained in the segment. All keys with smaller values in this segment come before all keys
+      // with greater values, independent of the remaining values.
+      value_ids[value_index] = lower_value_id;
+      break;
+    }
+
+    const auto is_last_value = value_index + 1 == values.size();
+    value_ids[value_index] = is_last_value && is_upper_bound ? upper_value_id : lower_value_id;
   }
+
+  return BinaryComparable(value_ids);
 }
 
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
@@ -118,7 +167,7 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
 
     // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
     auto upper = it;
-    return std::make_shared<Leaf>(lower, upper);
+    return std::make_shared<Leaf>(lower, upper, values.front().first);
   }
 
   // radix-partition on the depths-byte into 256 partitions
@@ -150,7 +199,7 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
 }
 
 std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
-  return {_indexed_segment};
+  return {_indexed_segments.cbegin(), _indexed_segments.cend()};
 }
 
 size_t AdaptiveRadixTreeIndex::_memory_consumption() const {
@@ -167,6 +216,14 @@ AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _par
   }
 }
 
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(const std::vector<ValueID>& values) {
+  _parts.reserve(values.size() * sizeof(ValueID));
+  for (const auto value : values) {
+    const auto value_parts = BinaryComparable(value);
+    _parts.insert(_parts.end(), value_parts._parts.cbegin(), value_parts._parts.cend());
+  }
+}
+
 size_t AdaptiveRadixTreeIndex::BinaryComparable::size() const { return _parts.size(); }
 
 uint8_t AdaptiveRadixTreeIndex::BinaryComparable::operator[](size_t position) const {
@@ -184,4 +241,12 @@ bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
   return true;
 }
 
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right) {
+  for (size_t i = 0; i < std::min(left.size(), right.size()); ++i) {
+    if (left[i] != right[i]) return left[i] < right[i];
+  }
+  return left.size() < right.size();
+}
+
 }  // namespace opossum
@@ -15,8 +15,15 @@ class ARTNode;
 class BaseDictionarySegment;
 
 /**
- * The AdaptiveRadixTreeIndex (ART) currently works on single DictionarySegments. Conceptually it also works on
+ * The AdaptiveRadixTreeIndex (ART) currently works on one or more DictionarySegments. Conceptually it also works on
  * ValueSegments.
+ * The key of a row is the concatenation of its value ids in the indexed segments, each stored with its most
+ * significant byte first. As the order of the value ids matches the order of the values, comparing these keys
+ * byte-wise yields the lexicographical order of the value tuples. Rows that are NULL in any of the indexed segments
+ * are not part of the tree (see AbstractIndex::null_cbegin()).
+ * Like the CompositeGroupKeyIndex, the ART on multiple segments can be queried with fewer values than segments,
+ * i.e., for a prefix of the key. lower_bound({a}) then points to the first row whose first value is not smaller than
+ * a, upper_bound({a}) to the first row whose first value is greater than a.
  * The ART does not compare full keys, but only partial keys in each node: On level n, the n-th byte of the full key
  * is compared.
  * In order to store the partial keys, it uses 4 different node-types, which can hold up to 4, 16, 48 and 256 partial
@@ -61,6 +68,9 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
    public:
     explicit BinaryComparable(ValueID value);
 
+    // Concatenation of the BinaryComparables of the value ids
+    explicit BinaryComparable(const std::vector<ValueID>& values);
+
     size_t size() const;
 
     uint8_t operator[](size_t position) const;
@@ -87,11 +97,20 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
 
   size_t _memory_consumption() const final;
 
-  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+  /**
+   * Creates the smallest key that is not smaller than the keys of all rows that are less than (or, if is_upper_bound is
+   * set, less than or equal to) the given prefix of values, so that the position of the first key in the tree that is
+   * not smaller than it is the lower (or upper) bound of the values.
+   */
+  BinaryComparable _create_key(const std::vector<AllTypeVariant>& values, const bool is_upper_bound) const;
+
+  std::vector<std::shared_ptr<const BaseDictionarySegment>> _indexed_segments;
   std::vector<ChunkOffset> _chunk_offsets;
   std::shared_ptr<ARTNode> _root;
 };
 
 bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
                 const AdaptiveRadixTreeIndex::BinaryComparable& right);
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right);
 }  // namespace opossum
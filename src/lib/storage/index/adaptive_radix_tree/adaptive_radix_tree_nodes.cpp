@@ -63,10 +63,10 @@ AbstractIndex::Iterator ARTNode4::_delegate_to_child(const AdaptiveRadixTreeInde
                                                      const std::function<Iterator(size_t, size_t)>& function) const {
   auto partial_key = key[depth];
   for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
-    if (_partial_keys[partial_key_id] < partial_key) continue;                                   // key not found yet
+    if (_partial_keys[partial_key_id] < partial_key) continue;  // key not found yet
+    if (!_children[partial_key_id]) return end();               // no more keys available, case1b
     if (_partial_keys[partial_key_id] == partial_key) return function(partial_key_id, ++depth);  // case0
-    if (!_children[partial_key_id]) return end();  // no more keys available, case1b
-    return _children[partial_key_id]->begin();     // case2
+    return _children[partial_key_id]->begin();                                                   // case2
   }
   return end();  // case1a
 }
@@ -144,16 +144,16 @@ AbstractIndex::Iterator ARTNode16::_delegate_to_child(
   auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
   auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, ++depth);  // case0
-  }
   if (partial_key_pos >= 16) {
     return end();  // case 1a
   }
-  if (_children[partial_key_pos]) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (!_children[partial_key_pos]) {
+    return end();  // case1b
   }
-  return end();  // case1b
+  if (*partial_key_iterator == partial_key) {
+    return function(partial_key_pos, ++depth);  // case0
+  }
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 AbstractIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key,
@@ -285,7 +285,7 @@ AbstractIndex::Iterator ARTNode48::begin() const {
 AbstractIndex::Iterator ARTNode48::end() const {
   for (uint8_t i = static_cast<uint8_t>(_index_to_child.size()) - 1; i > 0; --i) {
     if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+      return _children[_index_to_child[i]]->end();
     }
   }
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
@@ -370,20 +370,22 @@ AbstractIndex::Iterator ARTNode256::begin() const {
 AbstractIndex::Iterator ARTNode256::end() const {
   for (int16_t i = static_cast<int16_t>(_children.size()) - 1; i >= 0; --i) {
     if (_children[i]) {
-      return _children[i]->begin();
+      return _children[i]->end();
     }
   }
   Fail("Empty _children array in ARTNode256 should never happen");
 }
 
-Leaf::Leaf(AbstractIndex::Iterator& lower, AbstractIndex::Iterator& upper) : _begin(lower), _end(upper) {}
+Leaf::Leaf(AbstractIndex::Iterator& lower, AbstractIndex::Iterator& upper,
+           const AdaptiveRadixTreeIndex::BinaryComparable& key)
+    : _begin(lower), _end(upper), _key(key) {}
 
-AbstractIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const {
-  return _begin;
+AbstractIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const {
+  return _key < key ? _end : _begin;
 }
 
-AbstractIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const {
-  return _end;
+AbstractIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const {
+  return key < _key ? _begin : _end;
 }
 
 AbstractIndex::Iterator Leaf::begin() const { return _begin; }
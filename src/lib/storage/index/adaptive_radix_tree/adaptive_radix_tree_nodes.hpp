@@ -174,22 +174,26 @@ class ARTNode256 final : public ARTNode {
  *     eg: at ChunkOffset fe, the value is 0x00000001, not 0x00000000
  *     for the last leaf, _upper_bound = _chunk_offsets.end()
  *
- * lower_bound() nets the same as begin(), upper_bound the same as end()
+ * Besides, the leaf stores the full key of the value. A leaf can be created at a depth at which only a prefix of the
+ * searched key was compared. Thus, lower_bound() and upper_bound() compare the full keys: For keys smaller than the
+ * key of the leaf, both return begin(); for greater keys, both return end(). For the key of the leaf, lower_bound()
+ * nets the same as begin(), upper_bound() the same as end().
  */
 class Leaf final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
 
  public:
-  explicit Leaf(Iterator& lower, Iterator& upper);
+  Leaf(Iterator& lower, Iterator& upper, const AdaptiveRadixTreeIndex::BinaryComparable& key);
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
+  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const override;
+  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const override;
   Iterator begin() const override;
   Iterator end() const override;
 
  private:
   Iterator _begin;
   Iterator _end;
+  AdaptiveRadixTreeIndex::BinaryComparable _key;
 };
 
 }  // namespace opossum
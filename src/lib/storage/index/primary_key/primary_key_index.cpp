@@ -0,0 +1,85 @@
+#include "primary_key_index.hpp"
+
+#include <memory>
+
+#include "concurrency/transaction_context.hpp"
+#include "lossless_cast.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrimaryKeyIndex::PrimaryKeyIndex(const ColumnID column_id, const DataType data_type)
+    : PrimaryKeyIndex{column_id, data_type, std::make_shared<RowIDsByKey>(), std::nullopt} {}
+
+PrimaryKeyIndex::PrimaryKeyIndex(const ColumnID column_id, const DataType data_type,
+                                 const std::shared_ptr<RowIDsByKey>& row_ids,
+                                 std::optional<std::vector<ChunkID>> chunk_ids)
+    : _column_id{column_id}, _data_type{data_type}, _row_ids{row_ids}, _chunk_ids{std::move(chunk_ids)} {}
+
+std::shared_ptr<PrimaryKeyIndex> PrimaryKeyIndex::derive(const ColumnID column_id,
+                                                         std::vector<ChunkID> chunk_ids) const {
+  // Deriving from a derived index would require to chain the chunk id mappings
+  Assert(!_chunk_ids, "Cannot derive from a derived PrimaryKeyIndex");
+
+  // The constructor is private, so std::make_shared cannot be used
+  return std::shared_ptr<PrimaryKeyIndex>(new PrimaryKeyIndex(column_id, _data_type, _row_ids, std::move(chunk_ids)));
+}
+
+ColumnID PrimaryKeyIndex::column_id() const { return _column_id; }
+
+void PrimaryKeyIndex::insert(const AllTypeVariant& key, const RowID& row_id) {
+  DebugAssert(!variant_is_null(key), "Primary key must not be NULL");
+  DebugAssert(data_type_from_all_type_variant(key) == _data_type, "Key does not match the data type of the index");
+  DebugAssert(!_chunk_ids, "Rows cannot be inserted into a derived PrimaryKeyIndex");
+  _row_ids->emplace(key, row_id);
+}
+
+void PrimaryKeyIndex::lookup(const Table& table, const AllTypeVariant& key,
+                             const std::shared_ptr<const TransactionContext>& transaction_context,
+                             PosList& row_ids) const {
+  if (variant_is_null(key)) return;
+
+  // The key has to be of the data type of the column to be found in the hash map, e.g., an int literal compared to a
+  // long column. Keys that cannot be represented in the data type of the column do not match any row.
+  const auto typed_key = lossless_variant_cast(key, _data_type);
+  if (!typed_key) return;
+
+  const auto check_visibility = transaction_context && table.has_mvcc() == UseMvcc::Yes;
+
+  const auto [begin, end] = _row_ids->equal_range(*typed_key);
+  for (auto iter = begin; iter != end; ++iter) {
+    auto row_id = iter->second;
+    if (_chunk_ids) {
+      if (row_id.chunk_id >= _chunk_ids->size() || (*_chunk_ids)[row_id.chunk_id] == INVALID_CHUNK_ID) continue;
+      row_id.chunk_id = (*_chunk_ids)[row_id.chunk_id];
+    }
+
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    if (!chunk) continue;
+
+    if (check_visibility) {
+      const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      if (!Validate::is_row_visible(transaction_context->transaction_id(), transaction_context->snapshot_commit_id(),
+                                    mvcc_data->tids[row_id.chunk_offset], mvcc_data->begin_cids[row_id.chunk_offset],
+                                    mvcc_data->end_cids[row_id.chunk_offset])) {
+        continue;
+      }
+    }
+
+    row_ids.emplace_back(row_id);
+  }
+}
+
+size_t PrimaryKeyIndex::size() const { return _row_ids->size(); }
+
+size_t PrimaryKeyIndex::estimate_memory_usage() const {
+  // Derived indexes share the entries of the index they were derived from
+  if (_chunk_ids) return sizeof(*this) + _chunk_ids->size() * sizeof(ChunkID);
+
+  // Ignores the buckets of the hash map and the memory allocated by string keys
+  return sizeof(*this) + _row_ids->size() * (sizeof(AllTypeVariant) + sizeof(RowID) + sizeof(void*));
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "tbb/concurrent_unordered_map.h"
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+/**
+ * Maps the values of the primary key column of a table to the RowIDs of the rows that hold them. Unlike the indexes
+ * derived from AbstractIndex, which are created per chunk on immutable segments, the PrimaryKeyIndex covers the entire
+ * table, including its mutable chunks. It is registered on the Table (see Table::create_primary_key_index()) and kept
+ * up to date by Insert, so that a point lookup costs a single hash table probe instead of one probe per chunk.
+ *
+ * Rows are never removed from the index. Instead, lookups check the visibility of the found rows through the MvccData
+ * of their chunks, which covers rows that were deleted, rolled back, or not committed yet. Updates of the key column
+ * are executed as a Delete followed by an Insert (see Update), so the key of an indexed row never changes.
+ *
+ * Uniqueness of the keys is not enforced. Keys must not be NULL.
+ *
+ * Tables that GetTable derives from the stored table (e.g., with pruned chunks or columns) share its entries through
+ * an index returned by derive(), which translates the RowIDs of the stored table to those of the derived table.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  PrimaryKeyIndex(const ColumnID column_id, const DataType data_type);
+
+  /**
+   * Returns an index for a table derived from the indexed table that holds the key column at column_id. chunk_ids maps
+   * the ChunkIDs of the indexed table to those of the derived table (INVALID_CHUNK_ID for chunks it does not hold).
+   * Chunks that were added to the indexed table after the derived table was created are not part of it.
+   */
+  std::shared_ptr<PrimaryKeyIndex> derive(const ColumnID column_id, std::vector<ChunkID> chunk_ids) const;
+
+  ColumnID column_id() const;
+
+  // Thread-safe, may be called concurrently with other insert() and lookup() calls
+  void insert(const AllTypeVariant& key, const RowID& row_id);
+
+  /**
+   * Appends the RowIDs of the rows with the given key to row_ids. If a transaction context is given and the table uses
+   * MVCC, only the rows visible to the transaction are appended. Rows in chunks that were removed from the table are
+   * skipped.
+   */
+  void lookup(const Table& table, const AllTypeVariant& key,
+              const std::shared_ptr<const TransactionContext>& transaction_context, PosList& row_ids) const;
+
+  size_t size() const;
+
+  size_t estimate_memory_usage() const;
+
+ private:
+  using RowIDsByKey = tbb::concurrent_unordered_multimap<AllTypeVariant, RowID, std::hash<AllTypeVariant>>;
+
+  PrimaryKeyIndex(const ColumnID column_id, const DataType data_type, const std::shared_ptr<RowIDsByKey>& row_ids,
+                  std::optional<std::vector<ChunkID>> chunk_ids);
+
+  const ColumnID _column_id;
+  const DataType _data_type;
+
+  // Shared with the indexes derived from this one
+  const std::shared_ptr<RowIDsByKey> _row_ids;
+
+  // Set for derived indexes, see derive()
+  const std::optional<std::vector<ChunkID>> _chunk_ids;
+};
+
+}  // namespace opossum
@@ -65,11 +65,21 @@ std::optional<T> LZ4Segment<T>::get_typed_value(const ChunkOffset chunk_offset)
   return decompress(chunk_offset);
 }
 
+template <typename T>
+const pmr_vector<pmr_vector<char>>& LZ4Segment<T>::lz4_blocks() const {
+  return _lz4_blocks;
+}
+
 template <typename T>
 const std::optional<pmr_vector<bool>>& LZ4Segment<T>::null_values() const {
   return _null_values;
 }
 
+template <typename T>
+const std::optional<std::unique_ptr<const BaseCompressedVector>>& LZ4Segment<T>::string_offsets() const {
+  return _string_offsets;
+}
+
 template <typename T>
 std::optional<std::unique_ptr<BaseVectorDecompressor>> LZ4Segment<T>::string_offset_decompressor() const {
   if (_string_offsets && *_string_offsets) {
@@ -84,6 +94,21 @@ const pmr_vector<char>& LZ4Segment<T>::dictionary() const {
   return _dictionary;
 }
 
+template <typename T>
+size_t LZ4Segment<T>::block_size() const {
+  return _block_size;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::last_block_size() const {
+  return _last_block_size;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::compressed_size() const {
+  return _compressed_size;
+}
+
 template <typename T>
 ChunkOffset LZ4Segment<T>::size() const {
   return static_cast<ChunkOffset>(_num_elements);
@@ -96,9 +96,14 @@ class LZ4Segment : public BaseEncodedSegment {
                       const size_t block_size, const size_t last_block_size, const size_t compressed_size,
                       const size_t num_elements);
 
+  const pmr_vector<pmr_vector<char>>& lz4_blocks() const;
   const std::optional<pmr_vector<bool>>& null_values() const;
+  const std::optional<std::unique_ptr<const BaseCompressedVector>>& string_offsets() const;
   std::optional<std::unique_ptr<BaseVectorDecompressor>> string_offset_decompressor() const;
   const pmr_vector<char>& dictionary() const;
+  size_t block_size() const;
+  size_t last_block_size() const;
+  size_t compressed_size() const;
 
   /**
    * @defgroup BaseSegment interface
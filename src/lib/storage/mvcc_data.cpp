@@ -41,6 +41,49 @@ void MvccData::grow_by(size_t delta, TransactionID transaction_id, CommitID begi
 
   begin_cids.grow_to_at_least(_size, begin_commit_id);
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
+
+  if (begin_commit_id == MAX_COMMIT_ID) {
+    // The rows are inserted by a transaction that has not committed yet
+    _pending_insert_count += delta;
+  } else {
+    _update_max(_max_begin_cid, begin_commit_id);
+  }
+}
+
+void MvccData::register_insert_commit(const size_t row_count, const CommitID commit_id) {
+  // The maximum has to be updated before the rows are no longer pending. Otherwise, a concurrent Validate could
+  // consider the rows visible even though the snapshot of its transaction is older than commit_id.
+  _update_max(_max_begin_cid, commit_id);
+  _pending_insert_count -= row_count;
+}
+
+void MvccData::register_insert_rollback(const size_t row_count) {
+  _has_deletes = true;
+  _deleted_row_count += row_count;
+  _pending_insert_count -= row_count;
+}
+
+void MvccData::register_delete() { _has_deletes = true; }
+
+void MvccData::register_delete_commit(const size_t row_count, const CommitID commit_id) {
+  _update_max(_max_end_cid, commit_id);
+  _deleted_row_count += row_count;
+}
+
+size_t MvccData::pending_insert_count() const { return _pending_insert_count; }
+
+CommitID MvccData::max_begin_cid() const { return _max_begin_cid; }
+
+bool MvccData::has_deletes() const { return _has_deletes; }
+
+size_t MvccData::deleted_row_count() const { return _deleted_row_count; }
+
+CommitID MvccData::max_end_cid() const { return _max_end_cid; }
+
+void MvccData::_update_max(std::atomic<CommitID>& max_commit_id, const CommitID commit_id) {
+  auto current_max_commit_id = max_commit_id.load();
+  while (current_max_commit_id < commit_id && !max_commit_id.compare_exchange_weak(current_max_commit_id, commit_id)) {
+  }
 }
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
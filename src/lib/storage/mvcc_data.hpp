@@ -3,6 +3,7 @@
 #include <atomic>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
+#include "column_version_store.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
 
@@ -22,6 +23,9 @@ struct MvccData {
   pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
   pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
 
+  // Values written by Update that are not yet visible to all transactions, see ColumnVersionStore
+  ColumnVersionStore column_versions;
+
   explicit MvccData(const size_t size, CommitID begin_commit_id);
 
   size_t size() const;
@@ -37,6 +41,31 @@ struct MvccData {
    */
   void grow_by(size_t delta, TransactionID transaction_id, CommitID begin_commit_id);
 
+  /**
+   * Visibility summaries of all rows, which allow Validate to accept or discard all rows of a chunk without checking
+   * each of them. They are maintained by Insert and Delete through the register_* methods below. The summaries are
+   * conservative: Rolled back deletes, for example, are still counted in has_deletes().
+   */
+  void register_insert_commit(const size_t row_count, const CommitID commit_id);
+  void register_insert_rollback(const size_t row_count);
+  void register_delete();
+  void register_delete_commit(const size_t row_count, const CommitID commit_id);
+
+  // Number of rows that were inserted by transactions that have neither committed nor rolled back yet
+  size_t pending_insert_count() const;
+
+  // Highest begin commit id of all committed rows
+  CommitID max_begin_cid() const;
+
+  // True if a row was ever locked for deletion or an inserted row was rolled back
+  bool has_deletes() const;
+
+  // Number of rows that were deleted by a committed transaction or whose insert was rolled back
+  size_t deleted_row_count() const;
+
+  // Highest end commit id of all deleted rows
+  CommitID max_end_cid() const;
+
  private:
   /**
    * @brief Mutex used to manage access to MVCC data
@@ -47,7 +76,15 @@ struct MvccData {
    */
   std::shared_mutex _mutex;
 
+  static void _update_max(std::atomic<CommitID>& max_commit_id, const CommitID commit_id);
+
   size_t _size{0};
+
+  std::atomic<size_t> _pending_insert_count{0};
+  std::atomic<CommitID> _max_begin_cid{0};
+  std::atomic_bool _has_deletes{false};
+  std::atomic<size_t> _deleted_row_count{0};
+  std::atomic<CommitID> _max_end_cid{0};
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
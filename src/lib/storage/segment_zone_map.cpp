@@ -0,0 +1,145 @@
+#include "segment_zone_map.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+SegmentZoneMap<T>::SegmentZoneMap(const BaseSegment& segment)
+    : _segment_size{static_cast<ChunkOffset>(segment.size())},
+      _block_min_max((_segment_size + BLOCK_SIZE - 1) / BLOCK_SIZE) {
+  Assert(!dynamic_cast<const ReferenceSegment*>(&segment), "Zone maps can only be built on data segments");
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+
+    auto& min_max = _block_min_max[position.chunk_offset() / BLOCK_SIZE];
+    const auto& value = position.value();
+    if (!min_max) {
+      min_max.emplace(value, value);
+    } else if (value < min_max->first) {
+      min_max->first = value;
+    } else if (min_max->second < value) {
+      min_max->second = value;
+    }
+  });
+}
+
+template <typename T>
+ChunkOffsetRanges SegmentZoneMap<T>::candidate_ranges(const PredicateCondition predicate_condition,
+                                                      const AllTypeVariant& value,
+                                                      const std::optional<AllTypeVariant>& value2) const {
+  auto ranges = ChunkOffsetRanges{};
+
+  const auto is_comparison = predicate_condition == PredicateCondition::Equals ||
+                             predicate_condition == PredicateCondition::NotEquals ||
+                             predicate_condition == PredicateCondition::LessThan ||
+                             predicate_condition == PredicateCondition::LessThanEquals ||
+                             predicate_condition == PredicateCondition::GreaterThan ||
+                             predicate_condition == PredicateCondition::GreaterThanEquals ||
+                             is_between_predicate_condition(predicate_condition);
+
+  // Other predicates and values of other data types (including NULL) cannot be evaluated using the zone map
+  if (!is_comparison || data_type_from_all_type_variant(value) != data_type_from_type<T>() ||
+      (value2 && data_type_from_all_type_variant(*value2) != data_type_from_type<T>())) {
+    ranges.emplace_back(ChunkOffset{0}, _segment_size);
+    return ranges;
+  }
+
+  const auto typed_value = boost::get<T>(value);
+  const auto typed_value2 = value2 ? std::optional<T>{boost::get<T>(*value2)} : std::nullopt;
+  DebugAssert(!is_between_predicate_condition(predicate_condition) || typed_value2,
+              "Between predicates require a second value");
+
+  const auto block_count = static_cast<ChunkOffset>(_block_min_max.size());
+  for (auto block_id = ChunkOffset{0}; block_id < block_count; ++block_id) {
+    const auto& min_max = _block_min_max[block_id];
+    if (!min_max || !_block_may_match(*min_max, predicate_condition, typed_value, typed_value2)) continue;
+
+    const auto block_begin = block_id * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _segment_size);
+    if (!ranges.empty() && ranges.back().second == block_begin) {
+      ranges.back().second = block_end;
+    } else {
+      ranges.emplace_back(block_begin, block_end);
+    }
+  }
+
+  return ranges;
+}
+
+template <typename T>
+bool SegmentZoneMap<T>::_block_may_match(const std::pair<T, T>& min_max, const PredicateCondition predicate_condition,
+                                         const T& value, const std::optional<T>& value2) const {
+  const auto& [min, max] = min_max;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return !(value < min) && !(max < value);
+    case PredicateCondition::NotEquals:
+      return min < max || min < value || value < min;
+    case PredicateCondition::LessThan:
+      return min < value;
+    case PredicateCondition::LessThanEquals:
+      return !(value < min);
+    case PredicateCondition::GreaterThan:
+      return value < max;
+    case PredicateCondition::GreaterThanEquals:
+      return !(max < value);
+    default:
+      break;
+  }
+
+  // Between predicates: The block may match if it overlaps with the range of the predicate
+  const auto lower_matches = is_lower_inclusive_between(predicate_condition) ? !(max < value) : value < max;
+  const auto upper_matches = is_upper_inclusive_between(predicate_condition) ? !(*value2 < min) : min < *value2;
+  return lower_matches && upper_matches;
+}
+
+template <typename T>
+size_t SegmentZoneMap<T>::block_count() const {
+  return _block_min_max.size();
+}
+
+template <typename T>
+size_t SegmentZoneMap<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _block_min_max.capacity() * sizeof(std::optional<std::pair<T, T>>);
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto& min_max : _block_min_max) {
+      if (min_max) bytes += min_max->first.capacity() + min_max->second.capacity();
+    }
+  }
+
+  return bytes;
+}
+
+template <typename T>
+const std::vector<std::optional<std::pair<T, T>>>& SegmentZoneMap<T>::block_min_max() const {
+  return _block_min_max;
+}
+
+std::shared_ptr<BaseSegmentZoneMap> create_segment_zone_map(const BaseSegment& segment) {
+  if (dynamic_cast<const ReferenceSegment*>(&segment)) return nullptr;
+
+  auto zone_map = std::shared_ptr<BaseSegmentZoneMap>{};
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    zone_map = std::make_shared<SegmentZoneMap<ColumnDataType>>(segment);
+  });
+
+  return zone_map;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentZoneMap);
+
+}  // namespace opossum
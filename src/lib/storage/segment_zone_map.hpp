@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Range of chunk offsets [first, second)
+using ChunkOffsetRange = std::pair<ChunkOffset, ChunkOffset>;
+using ChunkOffsetRanges = std::vector<ChunkOffsetRange>;
+
+/**
+ * A zone map stores the minimum and maximum value of each block of BLOCK_SIZE consecutive rows of an immutable
+ * segment. While the ChunkPruningStatistics can only rule out entire chunks, zone maps allow the TableScan to skip
+ * blocks inside a chunk. This pays off for columns whose values correlate with the insertion order (e.g., dates),
+ * where a range predicate only matches a few blocks of a chunk.
+ *
+ * Zone maps are built together with the ChunkPruningStatistics (see generate_chunk_pruning_statistics()) and are
+ * stored in the Chunk.
+ */
+class BaseSegmentZoneMap {
+ public:
+  virtual ~BaseSegmentZoneMap() = default;
+
+  /**
+   * Returns the ranges of blocks that may contain rows satisfying `column <predicate_condition> value (AND value2)`.
+   * Consecutive blocks are merged into a single range. For predicate conditions that the zone map cannot evaluate
+   * (e.g., LIKE), the entire segment is returned.
+   */
+  virtual ChunkOffsetRanges candidate_ranges(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                             const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  virtual size_t block_count() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+};
+
+template <typename T>
+class SegmentZoneMap : public BaseSegmentZoneMap {
+ public:
+  explicit SegmentZoneMap(const BaseSegment& segment);
+
+  ChunkOffsetRanges candidate_ranges(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                     const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
+
+  size_t block_count() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // The minimum and maximum of a block are std::nullopt if the block contains NULLs only
+  const std::vector<std::optional<std::pair<T, T>>>& block_min_max() const;
+
+ private:
+  bool _block_may_match(const std::pair<T, T>& min_max, const PredicateCondition predicate_condition, const T& value,
+                        const std::optional<T>& value2) const;
+
+  ChunkOffset _segment_size;
+  std::vector<std::optional<std::pair<T, T>>> _block_min_max;
+};
+
+/**
+ * Creates the zone map for a segment. Returns nullptr for ReferenceSegments.
+ */
+std::shared_ptr<BaseSegmentZoneMap> create_segment_zone_map(const BaseSegment& segment);
+
+}  // namespace opossum
@@ -11,6 +11,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -122,6 +123,11 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   last_chunk->append(values);
+
+  if (_primary_key_index) {
+    _primary_key_index->insert(values[_primary_key_index->column_id()],
+                               RowID{ChunkID{chunk_count() - 1}, ChunkOffset{last_chunk->size() - 1}});
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -141,6 +147,51 @@ void Table::append_mutable_chunk() {
   append_chunk(segments, mvcc_data);
 }
 
+void Table::try_append_mutable_chunk(const ChunkID expected_chunk_count) {
+  const auto append_lock = acquire_append_mutex();
+  if (chunk_count() != expected_chunk_count) return;
+
+  auto chunk = std::atomic_exchange(&_prepared_mutable_chunk, std::shared_ptr<Chunk>{});
+  if (!chunk) {
+    chunk = _create_mutable_chunk(std::min(_max_chunk_size, Chunk::DEFAULT_SIZE));
+  }
+
+  _chunks.push_back(chunk);
+}
+
+void Table::prepare_mutable_chunk() {
+  if (std::atomic_load(&_prepared_mutable_chunk)) return;
+
+  std::atomic_store(&_prepared_mutable_chunk, _create_mutable_chunk(std::min(_max_chunk_size, Chunk::DEFAULT_SIZE)));
+}
+
+std::shared_ptr<Chunk> Table::_create_mutable_chunk(const ChunkOffset capacity) const {
+  DebugAssert(_type == TableType::Data, "Only data tables have mutable chunks");
+
+  Segments segments;
+  for (const auto& column_definition : _column_definitions) {
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable);
+      value_segment->values().reserve(capacity);
+      if (column_definition.nullable) {
+        value_segment->null_values().reserve(capacity);
+      }
+      segments.push_back(value_segment);
+    });
+  }
+
+  std::shared_ptr<MvccData> mvcc_data;
+  if (_use_mvcc == UseMvcc::Yes) {
+    mvcc_data = std::make_shared<MvccData>(0, CommitID{0});
+    mvcc_data->tids.reserve(capacity);
+    mvcc_data->begin_cids.reserve(capacity);
+    mvcc_data->end_cids.reserve(capacity);
+  }
+
+  return std::make_shared<Chunk>(segments, mvcc_data);
+}
+
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
   const auto chunk_count = _chunks.size();
@@ -200,7 +251,11 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
   }
 #endif
 
-  _chunks.push_back(std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  const auto chunk_iter = _chunks.push_back(std::make_shared<Chunk>(segments, mvcc_data, alloc));
+
+  if (_primary_key_index) {
+    _add_to_primary_key_index(static_cast<ChunkID>(std::distance(_chunks.begin(), chunk_iter)), **chunk_iter);
+  }
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -267,6 +322,39 @@ void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_s
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
 
+void Table::create_primary_key_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "PrimaryKeyIndex can only be created on data tables");
+  Assert(!_primary_key_index, "Table already has a PrimaryKeyIndex");
+  Assert(column_id < column_count(), "column_id invalid");
+  Assert(!column_is_nullable(column_id), "Primary key column must not be nullable");
+
+  _primary_key_index = std::make_shared<PrimaryKeyIndex>(column_id, column_data_type(column_id));
+
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    _add_to_primary_key_index(chunk_id, *chunk);
+  }
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::primary_key_index() const { return _primary_key_index; }
+
+void Table::set_primary_key_index(const std::shared_ptr<PrimaryKeyIndex>& primary_key_index) {
+  Assert(!_primary_key_index, "Table already has a PrimaryKeyIndex");
+  Assert(primary_key_index->column_id() < column_count(), "column_id invalid");
+  _primary_key_index = primary_key_index;
+}
+
+void Table::_add_to_primary_key_index(const ChunkID chunk_id, const Chunk& chunk) {
+  const auto column_id = _primary_key_index->column_id();
+  segment_iterate(*chunk.get_segment(column_id), [&](const auto& position) {
+    Assert(!position.is_null(), "Primary key must not be NULL");
+    _primary_key_index->insert(position.value(), RowID{chunk_id, position.chunk_offset()});
+  });
+}
+
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -282,6 +370,10 @@ size_t Table::estimate_memory_usage() const {
     bytes += column_definition.name.size();
   }
 
+  if (_primary_key_index) {
+    bytes += _primary_key_index->estimate_memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
@@ -17,6 +17,7 @@
 
 namespace opossum {
 
+class PrimaryKeyIndex;
 class TableStatistics;
 
 /**
@@ -108,6 +109,20 @@ class Table : private Noncopyable {
 
   // Create and append a Chunk consisting of ValueSegments.
   void append_mutable_chunk();
+
+  /**
+   * Used by Insert when the last Chunk is full or immutable: Appends a mutable Chunk unless a concurrent Insert has
+   * already done so, i.e., unless the Table no longer has expected_chunk_count Chunks. Takes the Chunk created by
+   * prepare_mutable_chunk() if there is one.
+   */
+  void try_append_mutable_chunk(const ChunkID expected_chunk_count);
+
+  /**
+   * Creates the next mutable Chunk ahead of need, so that Inserts neither allocate it nor wait for it when the last
+   * Chunk becomes full. The capacity of its segments and MVCC data is reserved for max_chunk_size rows (at most
+   * Chunk::DEFAULT_SIZE), so that growing them does not allocate memory either.
+   */
+  void prepare_mutable_chunk();
   /** @} */
 
   /**
@@ -180,12 +195,29 @@ class Table : private Noncopyable {
     _indexes.emplace_back(index_statistics);
   }
 
+  /**
+   * Creates a table-wide PrimaryKeyIndex on the column and adds all existing rows to it. Afterwards, the rows added by
+   * Insert, append(), and append_chunk() are added as well. Must not be called concurrently with Inserts.
+   */
+  void create_primary_key_index(const ColumnID column_id);
+
+  // nullptr if no PrimaryKeyIndex was created
+  std::shared_ptr<PrimaryKeyIndex> primary_key_index() const;
+
+  // Used by GetTable to share the PrimaryKeyIndex of a stored table with its output (see PrimaryKeyIndex::derive())
+  void set_primary_key_index(const std::shared_ptr<PrimaryKeyIndex>& primary_key_index);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
   size_t estimate_memory_usage() const;
 
  protected:
+  std::shared_ptr<Chunk> _create_mutable_chunk(const ChunkOffset capacity) const;
+
+  // Adds the rows of the chunk to the PrimaryKeyIndex
+  void _add_to_primary_key_index(const ChunkID chunk_id, const Chunk& chunk);
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
@@ -203,6 +235,8 @@ class Table : private Noncopyable {
 
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::shared_ptr<Chunk> _prepared_mutable_chunk;  // Accessed atomically, see prepare_mutable_chunk()
   std::vector<IndexStatistics> _indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 };
 }  // namespace opossum
@@ -1,11 +1,16 @@
 #include "chunk_compression_task.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "hyrise.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 
 #include "types.hpp"
@@ -17,10 +22,22 @@ ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const
     : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
 
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+    : ChunkCompressionTask{table_name, chunk_ids, std::nullopt} {}
+
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<ChunkEncodingSpec>& chunk_encoding_spec,
+                                           const SchedulePriority priority)
+    : ChunkCompressionTask{Hyrise::get().storage_manager.get_table(table_name), chunk_ids, chunk_encoding_spec,
+                           priority} {}
+
+ChunkCompressionTask::ChunkCompressionTask(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<ChunkEncodingSpec>& chunk_encoding_spec,
+                                           const SchedulePriority priority)
+    : AbstractTask{priority}, _table{table}, _chunk_ids{chunk_ids}, _chunk_encoding_spec{chunk_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
-  auto table = Hyrise::get().storage_manager.get_table(_table_name);
+  // The table is held by the task, so that it can be encoded even if it is dropped concurrently
+  const auto& table = _table;
 
   Assert(table, "Table does not exist.");
 
@@ -32,7 +49,28 @@ void ChunkCompressionTask::_on_execute() {
     DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    // Updates cannot be installed into encoded segments anymore, see ColumnVersionStore
+    if (chunk->has_mvcc_data()) {
+      Assert(chunk->get_scoped_mvcc_data_lock()->column_versions.try_seal(), "Chunk has uninstalled updates.");
+    }
+
+    // Indexes are only used for the segments they were created on (see AbstractIndex::is_index_for()), so the indexes
+    // of the table have to be rebuilt on the encoded segments. The new indexes are built before they are added to the
+    // chunk and replace the previous ones in one step. Until then, operators that look for an index of an encoded
+    // segment do not find one and fall back to scanning the segment (see IndexScan and JoinIndex).
+    auto previous_indexes = std::vector<std::shared_ptr<AbstractIndex>>{};
+    for (const auto& index_statistics : table->indexes_statistics()) {
+      const auto index = chunk->get_index(index_statistics.type, index_statistics.column_ids);
+      if (index) previous_indexes.emplace_back(index);
+    }
+
+    if (_chunk_encoding_spec) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *_chunk_encoding_spec);
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
+
+    chunk->replace_indexes(previous_indexes, _build_indexes(*table, *chunk));
   }
 }
 
@@ -41,14 +79,40 @@ bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chu
 
   auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-  for (const auto begin_cid : mvcc_data->begin_cids) {
-    // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
-    //               When activating the ChunkCompressionTask, please look for a different means of determining whether
-    //               all Inserts to a Chunk finished.
-    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
-  }
+  // Updated values can only be installed into ValueSegments, see ColumnVersionStore
+  if (!mvcc_data->column_versions.empty()) return false;
 
-  return true;
+  // The values of pending Inserts might not have been written to the segments yet
+  return mvcc_data->pending_insert_count() == 0;
+}
+
+std::vector<std::shared_ptr<AbstractIndex>> ChunkCompressionTask::_build_indexes(const Table& table,
+                                                                                 const Chunk& chunk) {
+  auto indexes = std::vector<std::shared_ptr<AbstractIndex>>{};
+  for (const auto& index_statistics : table.indexes_statistics()) {
+    auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+    for (const auto column_id : index_statistics.column_ids) {
+      segments.emplace_back(chunk.get_segment(column_id));
+    }
+
+    switch (index_statistics.type) {
+      case SegmentIndexType::GroupKey:
+        indexes.emplace_back(std::make_shared<GroupKeyIndex>(segments));
+        break;
+      case SegmentIndexType::CompositeGroupKey:
+        indexes.emplace_back(std::make_shared<CompositeGroupKeyIndex>(segments));
+        break;
+      case SegmentIndexType::AdaptiveRadixTree:
+        indexes.emplace_back(std::make_shared<AdaptiveRadixTreeIndex>(segments));
+        break;
+      case SegmentIndexType::BTree:
+        indexes.emplace_back(std::make_shared<BTreeIndex>(segments));
+        break;
+      case SegmentIndexType::Invalid:
+        Fail("Invalid index type");
+    }
+  }
+  return indexes;
 }
 
 }  // namespace opossum
@@ -1,16 +1,21 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
+class AbstractIndex;
 class Chunk;
+class Table;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the default encoding or the given ChunkEncodingSpec
  *
  * The task compresses a chunk by sequentially compressing segments.
  * From each value segment, a dictionary segment is created that replaces the
@@ -29,11 +34,22 @@ class Chunk;
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
+ *
+ * Pruning statistics are generated for the encoded chunk, and the indexes of the table (see Table::create_index()) are
+ * (re-)built on its encoded segments.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                       const std::optional<ChunkEncodingSpec>& chunk_encoding_spec,
+                       const SchedulePriority priority = SchedulePriority::Default);
+
+  // Used by background jobs that work on a copy of the stored tables, which might be dropped concurrently
+  ChunkCompressionTask(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                       const std::optional<ChunkEncodingSpec>& chunk_encoding_spec,
+                       const SchedulePriority priority = SchedulePriority::Default);
 
  protected:
   void _on_execute() override;
@@ -46,8 +62,12 @@ class ChunkCompressionTask : public AbstractTask {
    */
   static bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
 
+  // Builds the indexes of the table (see Table::create_index()) on the segments of the chunk without adding them to it
+  static std::vector<std::shared_ptr<AbstractIndex>> _build_indexes(const Table& table, const Chunk& chunk);
+
  private:
-  const std::string _table_name;
+  const std::shared_ptr<Table> _table;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<ChunkEncodingSpec> _chunk_encoding_spec;
 };
 }  // namespace opossum
@@ -177,6 +177,9 @@ const boost::bimap<TableType, std::string> table_type_to_string =
 const boost::bimap<UnionMode, std::string> union_mode_to_string =
     make_bimap<UnionMode, std::string>({{UnionMode::All, "UnionAll"}, {UnionMode::Positions, "UnionPositions"}});
 
+const boost::bimap<SetOperationMode, std::string> set_operation_mode_to_string =
+    make_bimap<SetOperationMode, std::string>({{SetOperationMode::Any, "Any"}, {SetOperationMode::All, "All"}});
+
 std::ostream& operator<<(std::ostream& stream, PredicateCondition predicate_condition) {
   return stream << predicate_condition_to_string.left.at(predicate_condition);
 }
@@ -193,6 +196,10 @@ std::ostream& operator<<(std::ostream& stream, UnionMode union_mode) {
   return stream << union_mode_to_string.left.at(union_mode);
 }
 
+std::ostream& operator<<(std::ostream& stream, SetOperationMode set_operation_mode) {
+  return stream << set_operation_mode_to_string.left.at(set_operation_mode);
+}
+
 std::ostream& operator<<(std::ostream& stream, TableType table_type) {
   return stream << table_type_to_string.left.at(table_type);
 }
@@ -180,7 +180,8 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 // The Scheduler currently supports just these 3 priorities, subject to change.
 enum class SchedulePriority {
   Default = 1,  // Schedule task at the end of the queue
-  High = 0      // Schedule task at the beginning of the queue
+  High = 0,     // Schedule task at the beginning of the queue
+  Low = 2       // Schedule task for background work, which is only executed if there is no other task
 };
 
 enum class PredicateCondition {
@@ -235,8 +236,26 @@ enum class JoinMode { Inner, Left, Right, FullOuter, Cross, Semi, AntiNullAsTrue
 
 enum class UnionMode { Positions, All };
 
+// Determines how the set operators (Difference and Intersect) treat duplicate rows. Both operators emit rows of their
+// left input.
+// Any: Whether a left row is emitted only depends on whether the right input contains any equal row. Duplicates in
+//      the left input are preserved.
+// All: Bag semantics, as for EXCEPT ALL and INTERSECT ALL. Every right row matches at most one equal left row.
+enum class SetOperationMode { Any, All };
+
 enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
 
+// Defines one column of a (multi-column) sort, e.g., for the Sort operator. The first definition is the primary sort
+// criterion, following definitions are used to break ties.
+struct SortColumnDefinition final {
+  explicit SortColumnDefinition(const ColumnID init_column,
+                                const OrderByMode init_order_by_mode = OrderByMode::Ascending)
+      : column(init_column), order_by_mode(init_order_by_mode) {}
+
+  ColumnID column;
+  OrderByMode order_by_mode;
+};
+
 enum class TableType { References, Data };
 
 enum class DescriptionMode { SingleLine, MultiLine };
@@ -271,12 +290,14 @@ extern const boost::bimap<PredicateCondition, std::string> predicate_condition_t
 extern const boost::bimap<OrderByMode, std::string> order_by_mode_to_string;
 extern const boost::bimap<JoinMode, std::string> join_mode_to_string;
 extern const boost::bimap<UnionMode, std::string> union_mode_to_string;
+extern const boost::bimap<SetOperationMode, std::string> set_operation_mode_to_string;
 extern const boost::bimap<TableType, std::string> table_type_to_string;
 
 std::ostream& operator<<(std::ostream& stream, PredicateCondition predicate_condition);
 std::ostream& operator<<(std::ostream& stream, OrderByMode order_by_mode);
 std::ostream& operator<<(std::ostream& stream, JoinMode join_mode);
 std::ostream& operator<<(std::ostream& stream, UnionMode union_mode);
+std::ostream& operator<<(std::ostream& stream, SetOperationMode set_operation_mode);
 std::ostream& operator<<(std::ostream& stream, TableType table_type);
 
 }  // namespace opossum
@@ -7,6 +7,7 @@
 #include "operators/limit.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_n.hpp"
 #include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "visualization/abstract_visualizer.hpp"
@@ -65,6 +66,13 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
     case OperatorType::Limit: {
       const auto limit = std::dynamic_pointer_cast<const Limit>(op);
       _visualize_subqueries(op, limit->row_count_expression(), visualized_ops);
+      if (limit->offset_expression()) _visualize_subqueries(op, limit->offset_expression(), visualized_ops);
+    } break;
+
+    case OperatorType::TopN: {
+      const auto top_n = std::dynamic_pointer_cast<const TopN>(op);
+      _visualize_subqueries(op, top_n->row_count_expression(), visualized_ops);
+      if (top_n->offset_expression()) _visualize_subqueries(op, top_n->offset_expression(), visualized_ops);
     } break;
 
     default: {}  // OperatorType has no expressions
@@ -0,0 +1,109 @@
+#include "chunk_compression_plugin.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/base_value_segment.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+const std::string ChunkCompressionPlugin::description() const {
+  return "This is the Hyrise ChunkCompressionPlugin, which encodes chunks filled by inserts in the background";
+}
+
+void ChunkCompressionPlugin::start() {
+  _loop_thread_compression =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_COMPRESSION, [&](size_t) { _compression_loop(); });
+}
+
+void ChunkCompressionPlugin::stop() {
+  // Destroying the loop thread waits for the current iteration (and thus for its tasks) to finish
+  _loop_thread_compression.reset();
+}
+
+void ChunkCompressionPlugin::set_chunk_encoding_spec(const std::string& table_name,
+                                                     const ChunkEncodingSpec& chunk_encoding_spec) {
+  std::lock_guard<std::mutex> lock(_chunk_encoding_specs_mutex);
+  _chunk_encoding_specs[table_name] = chunk_encoding_spec;
+}
+
+void ChunkCompressionPlugin::_compression_loop() {
+  // Copy the tables, so that tables can be added or dropped while we are working on them
+  const auto tables = _storage_manager.tables();
+
+  auto tasks = std::vector<std::shared_ptr<ChunkCompressionTask>>{};
+  for (const auto& [table_name, table] : tables) {
+    if (table->has_mvcc() != UseMvcc::Yes) continue;
+
+    auto chunk_encoding_spec = std::optional<ChunkEncodingSpec>{};
+    {
+      std::lock_guard<std::mutex> lock(_chunk_encoding_specs_mutex);
+      const auto chunk_encoding_spec_iter = _chunk_encoding_specs.find(table_name);
+      if (chunk_encoding_spec_iter != _chunk_encoding_specs.end()) {
+        chunk_encoding_spec = chunk_encoding_spec_iter->second;
+      }
+    }
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (!_try_prepare_compression(*table, chunk_id)) continue;
+
+      // Without an encoding set for the table, the encoding of each segment is chosen by the EncodingAdvisor
+      auto chunk_specific_encoding_spec = ChunkEncodingSpec{};
+      if (chunk_encoding_spec) {
+        chunk_specific_encoding_spec = *chunk_encoding_spec;
+      } else {
+        chunk_specific_encoding_spec =
+            EncodingAdvisor::advise_chunk_encoding(*table->get_chunk(chunk_id), table->column_data_types());
+
+        // The indexes of the table are rebuilt on the encoded segments and require dictionary segments
+        for (const auto& index_statistics : table->indexes_statistics()) {
+          for (const auto column_id : index_statistics.column_ids) {
+            if (chunk_specific_encoding_spec[column_id].encoding_type != EncodingType::Dictionary) {
+              chunk_specific_encoding_spec[column_id] = SegmentEncodingSpec{EncodingType::Dictionary};
+            }
+          }
+        }
+      }
+
+      // One task per chunk, so that the chunks can be encoded in parallel
+      // The task gets the table instead of its name, as the table might be dropped before the task is executed
+      tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table, std::vector<ChunkID>{chunk_id},
+                                                                chunk_specific_encoding_spec, SchedulePriority::Low));
+    }
+  }
+
+  // Waiting for the tasks ensures that no chunk is encoded twice, as chunks are only picked up again once they consist
+  // of encoded segments
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+}
+
+bool ChunkCompressionPlugin::_try_prepare_compression(const Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id()) return false;
+  if (chunk->size() != table.max_chunk_size()) return false;
+
+  // Chunks that were encoded before do not contain ValueSegments anymore
+  auto has_value_segments = false;
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    if (std::dynamic_pointer_cast<BaseValueSegment>(chunk->get_segment(column_id))) {
+      has_value_segments = true;
+      break;
+    }
+  }
+  if (!has_value_segments) return false;
+
+  // The values of pending Inserts might not have been written to the segments yet, and versions of Updates cannot be
+  // installed into encoded segments. Both are retried in the next iteration.
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  return mvcc_data->pending_insert_count() == 0 && mvcc_data->column_versions.try_seal();
+}
+
+EXPORT_PLUGIN(ChunkCompressionPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Background encoding of chunks that were filled by Inserts. Insert marks a chunk immutable as soon as all of its rows
+ * have been reserved. Once the Inserts into the chunk are committed or rolled back, the chunk still consists of
+ * ValueSegments, which are larger and slower to scan than encoded segments. This plugin periodically looks for such
+ * chunks and encodes them using ChunkCompressionTasks, which also generate the pruning statistics of the chunks and
+ * build the indexes of their tables.
+ *
+ * The tasks are scheduled with SchedulePriority::Low, so that Workers only execute them if there are no queries to
+ * run. Chunks are encoded using the ChunkEncodingSpec set for their table. Otherwise, the encoding of each segment is
+ * chosen by the EncodingAdvisor, except for indexed columns, which are dictionary-encoded.
+ */
+class ChunkCompressionPlugin : public AbstractPlugin, public Singleton<ChunkCompressionPlugin> {
+  friend class ChunkCompressionPluginTest;
+
+ public:
+  ChunkCompressionPlugin() : _storage_manager(Hyrise::get().storage_manager) {}
+
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  void set_chunk_encoding_spec(const std::string& table_name, const ChunkEncodingSpec& chunk_encoding_spec);
+
+ private:
+  void _compression_loop();
+
+  // Returns true if the chunk is filled, will not be changed by pending Inserts or Updates anymore, and has not been
+  // encoded yet. Prevents any further Updates of the chunk from writing in place (see ColumnVersionStore::try_seal()).
+  static bool _try_prepare_compression(const Table& table, const ChunkID chunk_id);
+
+  static constexpr auto IDLE_DELAY_COMPRESSION = std::chrono::milliseconds{1000};
+
+  StorageManager& _storage_manager;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_compression;
+
+  std::unordered_map<std::string, ChunkEncodingSpec> _chunk_encoding_specs;
+  std::mutex _chunk_encoding_specs_mutex;
+};
+
+}  // namespace opossum
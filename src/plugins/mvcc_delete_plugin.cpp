@@ -0,0 +1,136 @@
+#include "mvcc_delete_plugin.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+const std::string MvccDeletePlugin::description() const {
+  return "This is the Hyrise MvccDeletePlugin, which removes invalidated rows from the tables";
+}
+
+void MvccDeletePlugin::start() {
+  _loop_thread_logical_delete =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_LOGICAL_DELETE, [&](size_t) { _logical_delete_loop(); });
+  _loop_thread_physical_delete =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_PHYSICAL_DELETE, [&](size_t) { _physical_delete_loop(); });
+}
+
+void MvccDeletePlugin::stop() {
+  // Destroying the loop threads waits for the current iterations to finish
+  _loop_thread_logical_delete.reset();
+  _loop_thread_physical_delete.reset();
+
+  _physical_delete_queue = {};
+}
+
+void MvccDeletePlugin::_logical_delete_loop() {
+  // Copy the tables, so that tables can be added or dropped while we are working on them
+  const auto tables = _storage_manager.tables();
+
+  for (const auto& [table_name, table] : tables) {
+    if (table->has_mvcc() != UseMvcc::Yes) continue;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->size() == 0 || chunk->get_cleanup_commit_id()) continue;
+
+      // Only chunks that do not receive any more rows are compacted. Rows of pending inserts are not visible to the
+      // transaction of the logical delete and would thus be lost.
+      if (chunk->is_mutable() && chunk->size() < table->max_chunk_size()) continue;
+      if (chunk->get_scoped_mvcc_data_lock()->pending_insert_count() > 0) continue;
+
+      const auto invalidated_rows_share = static_cast<double>(chunk->invalid_row_count()) / chunk->size();
+      if (invalidated_rows_share < INVALIDATED_ROWS_THRESHOLD) continue;
+
+      if (_try_logical_delete(table_name, table, chunk_id)) {
+        std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+        _physical_delete_queue.emplace(table, chunk_id);
+      }
+    }
+  }
+}
+
+void MvccDeletePlugin::_physical_delete_loop() {
+  std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+
+  // As the cleanup commit ids increase along the queue, we can stop at the first chunk that cannot be deleted yet
+  while (!_physical_delete_queue.empty()) {
+    auto& [table, chunk_id] = _physical_delete_queue.front();
+    if (!_try_physical_delete(*table, chunk_id)) break;
+
+    _physical_delete_queue.pop();
+  }
+}
+
+bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                           const ChunkID chunk_id) {
+  // GetTable and Insert resolve the table by its name. Skip tables that were dropped (or replaced) since the tables
+  // were copied in _logical_delete_loop() instead of failing in the background thread.
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table) return false;
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+  // Select the visible rows of the chunk
+  auto pruned_chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = table->chunk_count();
+  for (auto pruned_chunk_id = ChunkID{0}; pruned_chunk_id < chunk_count; ++pruned_chunk_id) {
+    if (pruned_chunk_id != chunk_id) pruned_chunk_ids.emplace_back(pruned_chunk_id);
+  }
+
+  const auto get_table = std::make_shared<GetTable>(table_name, pruned_chunk_ids, std::vector<ColumnID>{});
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // The rows are deleted from the chunk and inserted into the last chunk. An Update would write the unchanged values
+  // in place instead. Delete does not accept empty input.
+  if (validate->get_output()->row_count() > 0) {
+    const auto delete_op = std::make_shared<Delete>(table_name, validate);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+
+    if (delete_op->execute_failed()) {
+      transaction_context->rollback();
+      return false;
+    }
+  }
+
+  const auto insert = std::make_shared<Insert>(table_name, validate);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  transaction_context->commit();
+  table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  return true;
+}
+
+bool MvccDeletePlugin::_try_physical_delete(Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  DebugAssert(chunk && chunk->get_cleanup_commit_id(), "Chunk must be marked for cleanup before it is removed");
+
+  // Transactions with a snapshot commit id below or equal to the cleanup commit id might still access the chunk. A
+  // transaction whose snapshot equals the cleanup commit id might have started before the cleanup commit id was set, so
+  // that its GetTable did not exclude the chunk.
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+  if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id <= *chunk->get_cleanup_commit_id()) return false;
+
+  table.remove_chunk(chunk_id);
+  return true;
+}
+
+EXPORT_PLUGIN(MvccDeletePlugin)
+
+}  // namespace opossum
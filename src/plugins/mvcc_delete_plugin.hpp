@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <utility>
+
+#include "hyrise.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Garbage collection for MVCC. Deleted and updated rows remain in their chunks, so that scans have to skip more and
+ * more invalidated rows over time. This plugin compacts such chunks in two steps, each running in its own thread:
+ *
+ * 1. Logical delete: For chunks that do not receive any new rows and whose share of invalidated rows exceeds
+ *    INVALIDATED_ROWS_THRESHOLD, the remaining visible rows are deleted and re-inserted into the table within a
+ *    single transaction. Afterwards, all rows of the chunk are invalidated, so the chunk is marked for cleanup with
+ *    the commit id of that transaction. GetTable skips the chunk for all transactions that start later. If the delete
+ *    conflicts with another transaction, it is rolled back and the chunk is retried in the next iteration.
+ * 2. Physical delete: As soon as no active transaction can see a chunk that was marked for cleanup anymore, i.e., the
+ *    lowest active snapshot commit id has passed its cleanup commit id, the chunk is removed from its table.
+ */
+class MvccDeletePlugin : public AbstractPlugin, public Singleton<MvccDeletePlugin> {
+  friend class MvccDeletePluginTest;
+
+ public:
+  MvccDeletePlugin() : _storage_manager(Hyrise::get().storage_manager) {}
+
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+ private:
+  using TableAndChunkID = std::pair<std::shared_ptr<Table>, ChunkID>;
+
+  void _logical_delete_loop();
+  void _physical_delete_loop();
+
+  // Returns false if the chunk could not be marked for cleanup because of a conflicting transaction or because the
+  // table is no longer stored under `table_name`
+  static bool _try_logical_delete(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                  const ChunkID chunk_id);
+
+  // Returns false if the chunk might still be visible to an active transaction
+  static bool _try_physical_delete(Table& table, const ChunkID chunk_id);
+
+  static constexpr auto INVALIDATED_ROWS_THRESHOLD = 0.9;
+  static constexpr auto IDLE_DELAY_LOGICAL_DELETE = std::chrono::milliseconds{1000};
+  static constexpr auto IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds{1000};
+
+  StorageManager& _storage_manager;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete;
+  std::unique_ptr<PausableLoopThread> _loop_thread_physical_delete;
+
+  // Chunks that were marked for cleanup, ordered by their cleanup commit id
+  std::queue<TableAndChunkID> _physical_delete_queue;
+  std::mutex _physical_delete_queue_mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "benchmark_table_encoder.hpp"
+#include "encoding_config.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class BenchmarkTableEncoderTest : public BaseTest {};
+
+TEST_F(BenchmarkTableEncoderTest, DictionaryEncodingForIndexedColumnsWithEncodingAdvisor) {
+  // Long runs of equal values, for which the EncodingAdvisor might choose another encoding than dictionary encoding
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_id = 0; row_id < 1'000; ++row_id) {
+    table->append({row_id / 500, row_id / 500});
+  }
+  table->get_chunk(ChunkID{0})->mark_immutable();
+
+  BenchmarkTableEncoder::encode("table", table, EncodingConfig::automatic(), {ColumnID{0}});
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(
+      ColumnID{0})));
+  EXPECT_NO_THROW(table->create_index<GroupKeyIndex>({ColumnID{0}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/active_snapshot_registry.hpp"
+
+namespace opossum {
+
+class ActiveSnapshotRegistryTest : public BaseTest {};
+
+TEST_F(ActiveSnapshotRegistryTest, RegisterAndDeregister) {
+  auto registry = ActiveSnapshotRegistry{};
+  EXPECT_EQ(registry.lowest(), std::nullopt);
+
+  const auto slot_5 = registry.register_snapshot(CommitID{5});
+  const auto slot_3 = registry.register_snapshot(CommitID{3});
+  const auto slot_3_again = registry.register_snapshot(CommitID{3});
+  EXPECT_NE(slot_3, slot_3_again);
+  EXPECT_EQ(registry.lowest(), CommitID{3});
+  EXPECT_EQ(registry.snapshot_commit_ids().size(), 3u);
+
+  registry.deregister_snapshot(slot_3, CommitID{3});
+  EXPECT_EQ(registry.lowest(), CommitID{3});
+
+  registry.deregister_snapshot(slot_3_again, CommitID{3});
+  EXPECT_EQ(registry.lowest(), CommitID{5});
+
+  // A slot that is occupied by another snapshot commit id is not freed
+  registry.deregister_snapshot(slot_5, CommitID{4});
+  EXPECT_EQ(registry.lowest(), CommitID{5});
+
+  registry.deregister_snapshot(slot_5, CommitID{5});
+  EXPECT_EQ(registry.lowest(), std::nullopt);
+}
+
+TEST_F(ActiveSnapshotRegistryTest, AppendBlocks) {
+  auto registry = ActiveSnapshotRegistry{};
+
+  // More active transactions than slots in a block
+  const auto transaction_count = ActiveSnapshotRegistry::SLOTS_PER_BLOCK * 2 + 1;
+  auto slot_ids = std::vector<ActiveSnapshotRegistry::SlotID>{};
+  for (auto transaction_index = size_t{0}; transaction_index < transaction_count; ++transaction_index) {
+    slot_ids.emplace_back(registry.register_snapshot(static_cast<CommitID>(transaction_count - transaction_index)));
+  }
+
+  EXPECT_EQ(registry.snapshot_commit_ids().size(), transaction_count);
+  EXPECT_EQ(registry.lowest(), CommitID{1});
+
+  // The last registered transaction has the lowest snapshot commit id and is stored in the third block
+  EXPECT_GE(slot_ids.back(), ActiveSnapshotRegistry::SLOTS_PER_BLOCK * 2);
+  registry.deregister_snapshot(slot_ids.back(), CommitID{1});
+  EXPECT_EQ(registry.lowest(), CommitID{2});
+
+  // Freed slots are reused
+  EXPECT_EQ(registry.register_snapshot(CommitID{1}), slot_ids.back());
+
+  for (auto transaction_index = size_t{0}; transaction_index < transaction_count; ++transaction_index) {
+    const auto snapshot_commit_id = static_cast<CommitID>(transaction_count - transaction_index);
+    registry.deregister_snapshot(slot_ids[transaction_index], snapshot_commit_id);
+  }
+  EXPECT_EQ(registry.lowest(), std::nullopt);
+}
+
+TEST_F(ActiveSnapshotRegistryTest, ConcurrentRegistration) {
+  auto registry = ActiveSnapshotRegistry{};
+  const auto long_running_slot = registry.register_snapshot(CommitID{1});
+
+  const auto thread_count = size_t{8};
+  const auto iteration_count = size_t{1'000};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto iteration = size_t{0}; iteration < iteration_count; ++iteration) {
+        const auto snapshot_commit_id = static_cast<CommitID>(2 + thread_index);
+        const auto slot_id = registry.register_snapshot(snapshot_commit_id);
+        EXPECT_EQ(registry.lowest(), CommitID{1});
+        registry.deregister_snapshot(slot_id, snapshot_commit_id);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(registry.snapshot_commit_ids(), std::vector<CommitID>{CommitID{1}});
+  registry.deregister_snapshot(long_running_slot, CommitID{1});
+  EXPECT_EQ(registry.lowest(), std::nullopt);
+}
+
+}  // namespace opossum
@@ -1,9 +1,11 @@
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/commit_context.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 
@@ -13,23 +15,36 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::vector<CommitID> get_active_snapshot_commit_ids() {
+    return Hyrise::get().transaction_manager._active_snapshot_registry.snapshot_commit_ids();
   }
 
-  static void register_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  static std::shared_ptr<CommitContext> new_commit_context() {
+    return Hyrise::get().transaction_manager._new_commit_context();
   }
-  static void deregister_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id);
+
+  static void try_increment_last_commit_id(const std::shared_ptr<CommitContext>& commit_context) {
+    Hyrise::get().transaction_manager._try_increment_last_commit_id(commit_context);
+  }
+
+  // Increments the last commit id, so that the following transactions get a new snapshot commit id
+  static void commit_empty_transaction() {
+    const auto commit_context = new_commit_context();
+    commit_context->make_pending(TransactionID{0});
+    try_increment_last_commit_id(commit_context);
+  }
+
+  static bool is_active(const CommitID snapshot_commit_id) {
+    const auto snapshot_commit_ids = get_active_snapshot_commit_ids();
+    return std::find(snapshot_commit_ids.cbegin(), snapshot_commit_ids.cend(), snapshot_commit_id) !=
+           snapshot_commit_ids.cend();
   }
 };
 
-/** Check if all active snapshot commit ids of uncommitted
+/** Check if all active snapshot commit ids of unfinished
  * transaction contexts are tracked correctly.
- * Normally, deregister_transaction() is called in the
- * destructor of the transaction context but is called
- * manually for this test.
+ * Transactions are deregistered in the destructor of the
+ * transaction context.
  */
 TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   auto& manager = Hyrise::get().transaction_manager;
@@ -37,52 +52,62 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 
-  const auto t1_context = manager.new_transaction_context();
-  const auto t2_context = manager.new_transaction_context();
-  const auto t3_context = manager.new_transaction_context();
+  auto t1_context = manager.new_transaction_context();
+  commit_empty_transaction();
+  auto t2_context = manager.new_transaction_context();
+  commit_empty_transaction();
+  auto t3_context = manager.new_transaction_context();
 
-  const CommitID t1_snapshot_commit_id = t1_context->snapshot_commit_id();
-  const CommitID t2_snapshot_commit_id = t2_context->snapshot_commit_id();
-  const CommitID t3_snapshot_commit_id = t3_context->snapshot_commit_id();
-  const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
+  const auto t1_snapshot_commit_id = t1_context->snapshot_commit_id();
+  const auto t2_snapshot_commit_id = t2_context->snapshot_commit_id();
+  const auto t3_snapshot_commit_id = t3_context->snapshot_commit_id();
+  EXPECT_LT(t1_snapshot_commit_id, t2_snapshot_commit_id);
+  EXPECT_LT(t2_snapshot_commit_id, t3_snapshot_commit_id);
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
+  EXPECT_TRUE(is_active(t1_snapshot_commit_id));
+  EXPECT_TRUE(is_active(t2_snapshot_commit_id));
+  EXPECT_TRUE(is_active(t3_snapshot_commit_id));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t1_snapshot_commit_id);
 
   t1_context->commit();
-  deregister_transaction(t1_context->snapshot_commit_id());
+  t1_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+  EXPECT_FALSE(is_active(t1_snapshot_commit_id));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_snapshot_commit_id);
 
   t3_context->commit();
-  deregister_transaction(t3_context->snapshot_commit_id());
+  t3_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+  EXPECT_TRUE(is_active(t2_snapshot_commit_id));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_snapshot_commit_id);
 
   t2_context->commit();
-  deregister_transaction(t2_context->snapshot_commit_id());
+  t2_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, CommitInOrderOfCommitIDs) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto last_commit_id = manager.last_commit_id();
+
+  const auto first_context = new_commit_context();
+  const auto second_context = new_commit_context();
+  EXPECT_EQ(first_context->commit_id(), last_commit_id + 1);
+  EXPECT_EQ(second_context->commit_id(), last_commit_id + 2);
+
+  // The second context cannot be committed before the first one
+  second_context->make_pending(TransactionID{0});
+  try_increment_last_commit_id(second_context);
+  EXPECT_EQ(manager.last_commit_id(), last_commit_id);
 
-  // To prevent exceptions in TransactionContext destructor
-  register_transaction(t1_snapshot_commit_id);
-  register_transaction(t2_snapshot_commit_id);
-  register_transaction(t3_snapshot_commit_id);
+  first_context->make_pending(TransactionID{0});
+  try_increment_last_commit_id(first_context);
+  EXPECT_EQ(manager.last_commit_id(), last_commit_id + 2);
 }
 
 }  // namespace opossum
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "constant_mappings.hpp"
+#include "hyrise.hpp"
+#include "import_export/checkpoint.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  // Returns the table as seen by a new transaction
+  static std::shared_ptr<const Table> _validated(const std::string& table_name) {
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context());
+    validate->execute();
+    return validate->get_output();
+  }
+
+  const std::string _file_name = test_data_path + "checkpoint_test.ckpt";
+};
+
+class CheckpointEncodingTest : public CheckpointTest, public ::testing::WithParamInterface<SegmentEncodingSpec> {};
+
+TEST_P(CheckpointEncodingTest, ReadEncodedTable) {
+  const auto table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 3);
+
+  // Columns whose data type is not supported by the encoding are dictionary-encoded
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    if (encoding_supports_data_type(GetParam().encoding_type, table->column_data_type(column_id))) {
+      chunk_encoding_spec.emplace_back(GetParam());
+    } else {
+      chunk_encoding_spec.emplace_back(SegmentEncodingSpec{EncodingType::Dictionary});
+    }
+  }
+  ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+
+  Checkpoint::write_table(*table, _file_name);
+  const auto loaded_table = Checkpoint::read_table(_file_name);
+
+  EXPECT_TABLE_EQ_ORDERED(loaded_table, table);
+  EXPECT_EQ(loaded_table->max_chunk_size(), table->max_chunk_size());
+  ASSERT_EQ(loaded_table->chunk_count(), table->chunk_count());
+
+  // The segments are not re-encoded
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto loaded_chunk = loaded_table->get_chunk(chunk_id);
+    EXPECT_FALSE(loaded_chunk->is_mutable());
+    EXPECT_TRUE(loaded_chunk->pruning_statistics());
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+      const auto loaded_segment =
+          std::dynamic_pointer_cast<const BaseEncodedSegment>(loaded_chunk->get_segment(column_id));
+      ASSERT_EQ(static_cast<bool>(loaded_segment), static_cast<bool>(segment));
+      if (!segment) continue;
+
+      EXPECT_EQ(loaded_segment->encoding_type(), segment->encoding_type());
+      EXPECT_EQ(loaded_segment->compressed_vector_type(), segment->compressed_vector_type());
+    }
+  }
+}
+
+auto checkpoint_test_formatter = [](const ::testing::TestParamInfo<SegmentEncodingSpec> info) {
+  auto stream = std::stringstream{};
+  stream << info.param;
+  auto name = stream.str();
+  name.erase(std::remove_if(name.begin(), name.end(), [](const auto character) { return !std::isalnum(character); }),
+             name.end());
+  return name;
+};
+
+INSTANTIATE_TEST_SUITE_P(CheckpointEncodingTestInstances, CheckpointEncodingTest,
+                         ::testing::ValuesIn(std::begin(all_segment_encoding_specs),
+                                             std::end(all_segment_encoding_specs)),
+                         checkpoint_test_formatter);
+
+TEST_F(CheckpointTest, OnlyVisibleRowsAreRestored) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  // Rows that were deleted and rows whose insert has not committed yet are invisible after loading the checkpoint
+  table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->end_cids[1] = CommitID{0};
+  table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->begin_cids[0] = MvccData::MAX_COMMIT_ID;
+  Hyrise::get().storage_manager.add_table("table", table);
+  const auto expected_table = _validated("table");
+  EXPECT_EQ(expected_table->row_count(), 2u);
+
+  Checkpoint::write_table(*table, _file_name);
+  Hyrise::get().storage_manager.drop_table("table");
+  const auto loaded_table = Checkpoint::read_table(_file_name);
+  Hyrise::get().storage_manager.add_table("table", loaded_table);
+
+  EXPECT_EQ(loaded_table->row_count(), 4u);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{0})->invalid_row_count(), 1u);
+  EXPECT_FALSE(loaded_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(loaded_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TABLE_EQ_ORDERED(_validated("table"), expected_table);
+}
+
+TEST_F(CheckpointTest, CommittedUpdatesAreWritten) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+
+  // Values written by Update are stored in the ColumnVersionStore until they are installed. Only the committed ones are
+  // written to the checkpoint.
+  {
+    auto mvcc_data = table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+    mvcc_data->column_versions.add(ColumnID{1}, ChunkOffset{0}, 1.5f, TransactionID{7});
+    mvcc_data->column_versions.commit(TransactionID{7}, CommitID{0});
+    mvcc_data->column_versions.add(ColumnID{0}, ChunkOffset{0}, 17, TransactionID{8});
+  }
+
+  Checkpoint::write_table(*table, _file_name);
+  const auto loaded_table = Checkpoint::read_table(_file_name);
+
+  EXPECT_EQ(loaded_table->get_value<int32_t>(ColumnID{0}, 2u), 1234);
+  EXPECT_EQ(loaded_table->get_value<float>(ColumnID{1}, 2u), 1.5f);
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 2u), 457.7f);
+}
+
+TEST_F(CheckpointTest, RemovedChunksAreSkipped) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::RunLength});
+  table->remove_chunk(ChunkID{1});
+
+  Checkpoint::write_table(*table, _file_name);
+  const auto loaded_table = Checkpoint::read_table(_file_name);
+
+  EXPECT_EQ(loaded_table->chunk_count(), 2u);
+  EXPECT_EQ(loaded_table->get_value<int32_t>(ColumnID{0}, 0u), 12345);
+  EXPECT_EQ(loaded_table->get_value<int32_t>(ColumnID{0}, 1u), 1234);
+}
+
+TEST_F(CheckpointTest, RejectInvalidFiles) {
+  EXPECT_THROW(Checkpoint::read_table("resources/test_data/tbl/int_float.tbl"), std::logic_error);
+  EXPECT_THROW(Checkpoint::read_table(test_data_path + "does_not_exist.ckpt"), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logging/log_recovery.hpp"
+#include "logging/logger.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LoggerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove(_log_file);
+    _load_base_table();
+  }
+
+  void TearDown() override { std::filesystem::remove(_log_file); }
+
+  // Tables that were not created by a logged CREATE TABLE have to be loaded before the recovery
+  static void _load_base_table() {
+    Hyrise::get().storage_manager.add_table("base", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  static void _execute(const std::string& sql) {
+    const auto [pipeline_status, table] = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> _query(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table().second;
+  }
+
+  // Simulates a restart: all in-memory data is lost and the log is replayed
+  size_t _restart() {
+    Hyrise::reset();
+    _load_base_table();
+    return LogRecovery::recover(_log_file);
+  }
+
+  const std::string _log_file = test_data_path + "logger_test.log";
+};
+
+TEST_F(LoggerTest, RecoverCommittedTransactions) {
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+
+  _execute("CREATE TABLE created (a INT, b FLOAT)");
+  _execute("INSERT INTO created VALUES (1, 1.5)");
+  _execute("INSERT INTO created VALUES (2, 2.5)");
+  _execute("INSERT INTO base VALUES (17, 17.5)");
+  _execute("DELETE FROM base WHERE a = 123");
+  _execute("UPDATE created SET b = 3.5 WHERE a = 2");
+
+  // Read-only transactions are not logged
+  _execute("SELECT * FROM created");
+
+  const auto expected_created = _query("SELECT * FROM created");
+  const auto expected_base = _query("SELECT * FROM base");
+  EXPECT_EQ(expected_created->row_count(), 2u);
+  EXPECT_EQ(expected_base->row_count(), 3u);
+
+  EXPECT_EQ(_restart(), 6u);
+
+  EXPECT_TRUE(Hyrise::get().storage_manager.has_table("created"));
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM created"), expected_created);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+
+  // The recovered rows can be modified and are logged again
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+  _execute("DELETE FROM created WHERE a = 1");
+  const auto expected_after_delete = _query("SELECT * FROM created");
+  EXPECT_EQ(expected_after_delete->row_count(), 1u);
+
+  EXPECT_EQ(_restart(), 7u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM created"), expected_after_delete);
+}
+
+TEST_F(LoggerTest, AsynchronousFlushPolicy) {
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::Asynchronous));
+
+  _execute("INSERT INTO base VALUES (17, 17.5)");
+  _execute("INSERT INTO base VALUES (18, 18.5)");
+  const auto expected_base = _query("SELECT * FROM base");
+
+  Hyrise::get().logger()->flush();
+  EXPECT_EQ(_restart(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+}
+
+TEST_F(LoggerTest, IgnorePartiallyWrittenEntry) {
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+
+  _execute("INSERT INTO base VALUES (17, 17.5)");
+  const auto expected_base = _query("SELECT * FROM base");
+  _execute("INSERT INTO base VALUES (18, 18.5)");
+  Hyrise::get().logger()->flush();
+
+  // Simulate a crash while the second entry was written
+  std::filesystem::resize_file(_log_file, std::filesystem::file_size(_log_file) - 3);
+
+  EXPECT_EQ(_restart(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+}
+
+TEST_F(LoggerTest, AppendAfterPartiallyWrittenEntry) {
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+  _execute("INSERT INTO base VALUES (17, 17.5)");
+  _execute("INSERT INTO base VALUES (18, 18.5)");
+  Hyrise::get().logger()->flush();
+  std::filesystem::resize_file(_log_file, std::filesystem::file_size(_log_file) - 3);
+
+  // The recovery removes the partially written entry, so that the entries written after the restart are replayed
+  EXPECT_EQ(_restart(), 1u);
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+  _execute("INSERT INTO base VALUES (19, 19.5)");
+  const auto expected_base = _query("SELECT * FROM base");
+  EXPECT_EQ(expected_base->row_count(), 5u);
+
+  EXPECT_EQ(_restart(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+}
+
+TEST_F(LoggerTest, DetectCorruptedEntryHeader) {
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+  _execute("INSERT INTO base VALUES (17, 17.5)");
+  const auto expected_base = _query("SELECT * FROM base");
+  _execute("INSERT INTO base VALUES (18, 18.5)");
+  Hyrise::get().logger()->flush();
+
+  // Change the commit id in the header of the second entry, which the checksum covers
+  const auto entry_size = std::filesystem::file_size(_log_file) / 2;
+  {
+    auto file = std::fstream{_log_file, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(static_cast<std::streamoff>(entry_size + sizeof(uint32_t)));
+    file.put(static_cast<char>(0x7f));
+  }
+
+  EXPECT_EQ(_restart(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+}
+
+TEST_F(LoggerTest, LoggerSetAfterDeleteWasExecuted) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("base");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto table_scan = std::make_shared<TableScan>(
+      validate, equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 123));
+  const auto delete_op = std::make_shared<Delete>("base", table_scan);
+  delete_op->set_transaction_context_recursively(transaction_context);
+  get_table->execute();
+  validate->execute();
+  table_scan->execute();
+  delete_op->execute();
+
+  // The deleted rows are logged even though no logger was set when the Delete was executed
+  Hyrise::get().set_logger(std::make_shared<Logger>(_log_file, LogFlushPolicy::GroupCommit));
+  transaction_context->commit();
+  const auto expected_base = _query("SELECT * FROM base");
+  EXPECT_EQ(expected_base->row_count(), 2u);
+
+  EXPECT_EQ(_restart(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_query("SELECT * FROM base"), expected_base);
+}
+
+}  // namespace opossum
@@ -19,22 +19,37 @@ class LimitNodeTest : public ::testing::Test {
   std::shared_ptr<LimitNode> _limit_node;
 };
 
-TEST_F(LimitNodeTest, Description) { EXPECT_EQ(_limit_node->description(), "[Limit] 10"); }
+TEST_F(LimitNodeTest, Description) {
+  EXPECT_EQ(_limit_node->description(), "[Limit] 10");
+  EXPECT_EQ(LimitNode::make(value_(10), value_(5))->description(), "[Limit] 10 Offset: 5");
+}
 
 TEST_F(LimitNodeTest, HashingAndEqualityCheck) {
   EXPECT_EQ(*_limit_node, *_limit_node);
   EXPECT_EQ(*LimitNode::make(value_(10)), *_limit_node);
   EXPECT_NE(*LimitNode::make(value_(11)), *_limit_node);
+  EXPECT_NE(*LimitNode::make(value_(10), value_(5)), *_limit_node);
+  EXPECT_EQ(*LimitNode::make(value_(10), value_(5)), *LimitNode::make(value_(10), value_(5)));
 
   EXPECT_EQ(LimitNode::make(value_(10))->hash(), _limit_node->hash());
   EXPECT_NE(LimitNode::make(value_(11))->hash(), _limit_node->hash());
 }
 
-TEST_F(LimitNodeTest, Copy) { EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node); }
+TEST_F(LimitNodeTest, Copy) {
+  EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node);
+
+  const auto limit_node_with_offset = LimitNode::make(value_(10), value_(5));
+  EXPECT_EQ(*limit_node_with_offset->deep_copy(), *limit_node_with_offset);
+}
 
 TEST_F(LimitNodeTest, NodeExpressions) {
   ASSERT_EQ(_limit_node->node_expressions.size(), 1u);
   EXPECT_EQ(*_limit_node->node_expressions.at(0u), *value_(10));
+  EXPECT_EQ(_limit_node->offset_expression(), nullptr);
+
+  const auto limit_node_with_offset = LimitNode::make(value_(10), value_(5));
+  ASSERT_EQ(limit_node_with_offset->node_expressions.size(), 2u);
+  EXPECT_EQ(*limit_node_with_offset->offset_expression(), *value_(5));
 }
 
 }  // namespace opossum
@@ -26,11 +26,13 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/static_table_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -42,9 +44,11 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
 #include "storage/table.hpp"
@@ -320,22 +324,19 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
 
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
+  const auto& sort_definitions = sort->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 3u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[2].column, ColumnID{2});
+  EXPECT_EQ(sort_definitions[2].order_by_mode, OrderByMode::AscendingNullsLast);
 
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -366,6 +367,35 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, TopN) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC LIMIT 10 OFFSET 5
+   */
+  const auto lqp = TopNNode::make(expression_vector(int_float_b), std::vector<OrderByMode>{OrderByMode::Descending},
+                                  value_(int64_t{10}), value_(int64_t{5}), int_float_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_n = std::dynamic_pointer_cast<TopN>(pqp);
+  ASSERT_TRUE(top_n);
+
+  const auto& sort_definitions = top_n->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 1u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(*top_n->row_count_expression(), *value_(int64_t{10}));
+  ASSERT_TRUE(top_n->offset_expression());
+  EXPECT_EQ(*top_n->offset_expression(), *value_(int64_t{5}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_n->input_left());
+  ASSERT_TRUE(get_table);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -468,9 +498,7 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_inclusive_(b, 42, 1337));
 }
 
-TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
-  if (!HYRISE_DEBUG) GTEST_SKIP();
-
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanOnReferenceInput) {
   /**
    * Build LQP and translate to PQP
    */
@@ -482,14 +510,58 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   table->get_chunk(index_chunk_ids[0])->create_index<GroupKeyIndex>(index_column_ids);
   table->get_chunk(index_chunk_ids[1])->create_index<GroupKeyIndex>(index_column_ids);
 
-  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  auto predicate_node = PredicateNode::make(less_than_(stored_table_node->get_column("a"), 42));
   predicate_node->set_left_input(stored_table_node);
-  auto predicate_node2 = PredicateNode::make(less_than_(stored_table_node->get_column("a"), 42));
+  auto predicate_node2 = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
   predicate_node2->set_left_input(predicate_node);
-
-  // The optimizer should not set this ScanType in this situation
   predicate_node2->scan_type = ScanType::IndexScan;
-  EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
+  const auto op = LQPTranslator{}.translate_node(predicate_node2);
+
+  /**
+   * Check PQP - the IndexScan on the output of the TableScan handles all chunks by itself
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(index_scan_op->included_chunk_ids.empty());
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::TableScan);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodesMultiColumnIndexScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = Hyrise::get().storage_manager.get_table("int_float_chunked");
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}});
+
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+  auto predicate_node_a = PredicateNode::make(equals_(a, 12345), stored_table_node);
+  predicate_node_a->scan_type = ScanType::IndexScan;
+  auto predicate_node_b = PredicateNode::make(equals_(b, 458.7f), predicate_node_a);
+  predicate_node_b->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node_b);
+
+  /**
+   * Check PQP - both PredicateNodes are handled by a single IndexScan
+   */
+  const auto union_op = std::dynamic_pointer_cast<UnionAll>(op);
+  ASSERT_TRUE(union_op);
+
+  const auto index_chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}};
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(index_scan_op->included_chunk_ids, index_chunk_ids);
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op->input_right());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->excluded_chunk_ids, index_chunk_ids);
+  EXPECT_EQ(table_scan_op->input_left(), index_scan_op->input_left());
+  const auto pqp_a = PQPColumnExpression::from_table(*table, "a");
+  const auto pqp_b = PQPColumnExpression::from_table(*table, "b");
+  EXPECT_EQ(*table_scan_op->predicate(), *and_(equals_(pqp_b, 458.7f), equals_(pqp_a, 12345)));
 }
 
 TEST_F(LQPTranslatorTest, ProjectionNode) {
@@ -562,6 +634,25 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndex) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float2_b, int_float_b), int_float_node, int_float2_node);
+  join_node->join_type = JoinType::Index;
+  join_node->index_side = IndexSide::Left;
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - the IndexJoinRule requested a JoinIndex
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::Equals);
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
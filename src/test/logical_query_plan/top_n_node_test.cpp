@@ -0,0 +1,84 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopNNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    _a = _mock_node->get_column("a");
+    _b = _mock_node->get_column("b");
+
+    _top_n_node = TopNNode::make(expression_vector(_a, _b),
+                                 std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::AscendingNullsLast},
+                                 value_(10), _mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<TopNNode> _top_n_node;
+  LQPColumnReference _a, _b;
+};
+
+TEST_F(TopNNodeTest, Description) {
+  EXPECT_EQ(_top_n_node->description(), "[TopN] a (DescendingNullsFirst), b (AscendingNullsLast) Limit: 10");
+
+  const auto top_n_node_with_offset = TopNNode::make(
+      expression_vector(_a), std::vector<OrderByMode>{OrderByMode::Ascending}, value_(10), value_(5), _mock_node);
+  EXPECT_EQ(top_n_node_with_offset->description(), "[TopN] a (AscendingNullsFirst) Limit: 10 Offset: 5");
+}
+
+TEST_F(TopNNodeTest, NodeExpressions) {
+  ASSERT_EQ(_top_n_node->node_expressions.size(), 3u);
+  EXPECT_EQ(_top_n_node->sort_expressions(), expression_vector(_a, _b));
+  EXPECT_EQ(*_top_n_node->num_rows_expression(), *value_(10));
+  EXPECT_EQ(_top_n_node->offset_expression(), nullptr);
+
+  const auto top_n_node_with_offset = TopNNode::make(
+      expression_vector(_a), std::vector<OrderByMode>{OrderByMode::Ascending}, value_(10), value_(5), _mock_node);
+  ASSERT_EQ(top_n_node_with_offset->node_expressions.size(), 3u);
+  EXPECT_EQ(top_n_node_with_offset->sort_expressions(), expression_vector(_a));
+  EXPECT_EQ(*top_n_node_with_offset->num_rows_expression(), *value_(10));
+  EXPECT_EQ(*top_n_node_with_offset->offset_expression(), *value_(5));
+}
+
+TEST_F(TopNNodeTest, HashingAndEqualityCheck) {
+  const auto same_top_n_node = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::AscendingNullsLast},
+      value_(10), _mock_node);
+  const auto different_order_by_modes = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::AscendingNullsLast},
+      value_(10), _mock_node);
+  const auto different_num_rows = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::AscendingNullsLast},
+      value_(11), _mock_node);
+  const auto with_offset = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::AscendingNullsLast},
+      value_(10), value_(1), _mock_node);
+
+  EXPECT_EQ(*_top_n_node, *same_top_n_node);
+  EXPECT_NE(*_top_n_node, *different_order_by_modes);
+  EXPECT_NE(*_top_n_node, *different_num_rows);
+  EXPECT_NE(*_top_n_node, *with_offset);
+
+  EXPECT_EQ(_top_n_node->hash(), same_top_n_node->hash());
+  EXPECT_NE(_top_n_node->hash(), different_order_by_modes->hash());
+}
+
+TEST_F(TopNNodeTest, Copy) {
+  EXPECT_EQ(*_top_n_node->deep_copy(), *_top_n_node);
+
+  const auto top_n_node_with_offset = TopNNode::make(
+      expression_vector(_a), std::vector<OrderByMode>{OrderByMode::Ascending}, value_(10), value_(5), _mock_node);
+  EXPECT_EQ(*top_n_node_with_offset->deep_copy(), *top_n_node_with_offset);
+}
+
+}  // namespace opossum
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <set>
 #include <string>
@@ -10,6 +13,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
@@ -18,6 +22,8 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -728,4 +734,110 @@ TYPED_TEST(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+/**
+ * Tests for the parallel aggregation (the input needs to be large enough to be split into multiple tasks)
+ */
+
+TYPED_TEST(OperatorsAggregateTest, ParallelAggregationFewGroups) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Ten groups with 4'000 rows each, spread across all chunks. Every 13th value is NULL.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  auto input_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  auto values_per_group = std::map<int32_t, std::vector<int32_t>>{};
+  for (auto row_id = 0; row_id < 40'000; ++row_id) {
+    const auto group = row_id % 10;
+    if (row_id % 13 == 0) {
+      input_table->append({group, NullValue{}});
+      continue;
+    }
+    const auto value = (row_id * 7919) % 1'000;
+    input_table->append({group, value});
+    values_per_group[group].emplace_back(value);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<TypeParam>(table_wrapper,
+                                                     std::vector<AggregateColumnDefinition>{
+                                                         {ColumnID{1}, AggregateFunction::Sum},
+                                                         {ColumnID{1}, AggregateFunction::Min},
+                                                         {ColumnID{1}, AggregateFunction::Max},
+                                                         {ColumnID{1}, AggregateFunction::Avg},
+                                                         {ColumnID{1}, AggregateFunction::Count},
+                                                         {ColumnID{1}, AggregateFunction::CountDistinct},
+                                                         {std::nullopt, AggregateFunction::Count},
+                                                         {ColumnID{1}, AggregateFunction::StandardDeviationSample}},
+                                                     std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto expected_column_definitions = TableColumnDefinitions{{"a", DataType::Int, false},
+                                                                  {"SUM(b)", DataType::Long, true},
+                                                                  {"MIN(b)", DataType::Int, true},
+                                                                  {"MAX(b)", DataType::Int, true},
+                                                                  {"AVG(b)", DataType::Double, true},
+                                                                  {"COUNT(b)", DataType::Long, false},
+                                                                  {"COUNT(DISTINCT b)", DataType::Long, false},
+                                                                  {"COUNT(*)", DataType::Long, false},
+                                                                  {"STDDEV_SAMP(b)", DataType::Double, true}};
+  auto expected_table = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  for (const auto& [group, values] : values_per_group) {
+    const auto sum = std::accumulate(values.begin(), values.end(), int64_t{0});
+    const auto count = static_cast<int64_t>(values.size());
+    const auto mean = static_cast<double>(sum) / static_cast<double>(count);
+    auto squared_distance_from_mean = 0.0;
+    for (const auto value : values) {
+      squared_distance_from_mean += (value - mean) * (value - mean);
+    }
+    const auto distinct_count = static_cast<int64_t>(std::set<int32_t>(values.begin(), values.end()).size());
+
+    expected_table->append({group, sum, *std::min_element(values.begin(), values.end()),
+                            *std::max_element(values.begin(), values.end()), mean, count, distinct_count,
+                            int64_t{4'000}, std::sqrt(squared_distance_from_mean / static_cast<double>(count - 1))});
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_table);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+TYPED_TEST(OperatorsAggregateTest, ParallelAggregationManyGroups) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Every row forms its own group, so AggregateHash stops pre-aggregating and only partitions the rows
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  auto input_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{
+          {"a", DataType::Int, false}, {"b", DataType::Int, false}, {"SUM(b)", DataType::Long, true}},
+      TableType::Data);
+  auto expected_distinct_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row_id = 0; row_id < 40'000; ++row_id) {
+    input_table->append({row_id % 10, row_id});
+    expected_table->append({row_id % 10, row_id, int64_t{row_id}});
+    expected_distinct_table->append({row_id % 10, row_id});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<TypeParam>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_table);
+
+  const auto distinct = std::make_shared<TypeParam>(table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                                    std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  distinct->execute();
+  EXPECT_TABLE_EQ_UNORDERED(distinct->get_output(), expected_distinct_table);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
 }  // namespace opossum
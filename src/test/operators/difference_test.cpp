@@ -26,10 +26,33 @@ class OperatorsDifferenceTest : public BaseTest {
 
     _table_wrapper_a->execute();
     _table_wrapper_b->execute();
+
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}};
+
+    const auto left_table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+    left_table->append({1, "x"});
+    left_table->append({1, "x"});
+    left_table->append({NullValue{}, "y"});
+    left_table->append({2, "z"});
+    left_table->append({NullValue{}, "y"});
+    left_table->append({3, NullValue{}});
+    _table_wrapper_left_with_null = std::make_shared<TableWrapper>(left_table);
+    _table_wrapper_left_with_null->execute();
+
+    const auto right_table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+    right_table->append({1, "x"});
+    right_table->append({NullValue{}, "y"});
+    right_table->append({3, NullValue{}});
+    right_table->append({3, NullValue{}});
+    _table_wrapper_right_with_null = std::make_shared<TableWrapper>(right_table);
+    _table_wrapper_right_with_null->execute();
   }
 
   std::shared_ptr<TableWrapper> _table_wrapper_a;
   std::shared_ptr<TableWrapper> _table_wrapper_b;
+  std::shared_ptr<TableWrapper> _table_wrapper_left_with_null;
+  std::shared_ptr<TableWrapper> _table_wrapper_right_with_null;
+  TableColumnDefinitions _column_definitions;
 };
 
 TEST_F(OperatorsDifferenceTest, DifferenceOnValueTables) {
@@ -59,6 +82,58 @@ TEST_F(OperatorsDifferenceTest, DifferneceOnReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
 }
 
+TEST_F(OperatorsDifferenceTest, DifferenceWithNullAndDuplicates) {
+  // NULL equals NULL, duplicates of the left input are kept
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({2, "z"});
+
+  auto difference = std::make_shared<Difference>(_table_wrapper_left_with_null, _table_wrapper_right_with_null);
+  difference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+}
+
+TEST_F(OperatorsDifferenceTest, DifferenceAll) {
+  // Every right row removes one equal left row
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({1, "x"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({2, "z"});
+
+  auto difference = std::make_shared<Difference>(_table_wrapper_left_with_null, _table_wrapper_right_with_null,
+                                                 SetOperationMode::All);
+  difference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+}
+
+TEST_F(OperatorsDifferenceTest, DifferenceAllOnReferenceTables) {
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({1, "x"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({2, "z"});
+
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_left_with_null->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_left_with_null->get_output(), "b");
+
+  auto projection1 = std::make_shared<Projection>(_table_wrapper_left_with_null, expression_vector(a, b));
+  projection1->execute();
+
+  auto projection2 = std::make_shared<Projection>(_table_wrapper_right_with_null, expression_vector(a, b));
+  projection2->execute();
+
+  auto difference = std::make_shared<Difference>(projection1, projection2, SetOperationMode::All);
+  difference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+}
+
+TEST_F(OperatorsDifferenceTest, Description) {
+  auto difference = std::make_shared<Difference>(_table_wrapper_a, _table_wrapper_b, SetOperationMode::All);
+  EXPECT_EQ(difference->description(DescriptionMode::SingleLine), "Difference (All)");
+  EXPECT_EQ(difference->description(DescriptionMode::MultiLine), "Difference\n(All)");
+}
+
 TEST_F(OperatorsDifferenceTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
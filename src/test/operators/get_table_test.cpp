@@ -103,6 +103,40 @@ TEST_F(OperatorsGetTableTest, PrunedColumns) {
   EXPECT_EQ(table->get_chunk(ChunkID{3})->get_indexes(column_ids_1).size(), 0u);
 }
 
+TEST_F(OperatorsGetTableTest, PrunedColumnsKeepZoneMaps) {
+  const auto stored_table = Hyrise::get().storage_manager.get_table("int_int_float");
+  const auto stored_zone_maps = stored_table->get_chunk(ChunkID{0})->zone_maps();
+  ASSERT_TRUE(stored_zone_maps);
+
+  // The zone maps are remapped to the output columns
+  auto get_table =
+      std::make_shared<opossum::GetTable>("int_int_float", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table->execute();
+
+  const auto zone_maps = get_table->get_output()->get_chunk(ChunkID{0})->zone_maps();
+  ASSERT_TRUE(zone_maps);
+  ASSERT_EQ(zone_maps->size(), 2u);
+  EXPECT_EQ((*zone_maps)[0], (*stored_zone_maps)[0]);
+  EXPECT_EQ((*zone_maps)[1], (*stored_zone_maps)[2]);
+
+  // A column with versions is copied, the zone map of the stored segment does not apply to the copy
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  auto& column_versions = stored_table->get_chunk(ChunkID{0})->mvcc_data()->column_versions;
+  ASSERT_TRUE(column_versions.add(ColumnID{0}, ChunkOffset{0}, 17, transaction_context->transaction_id()));
+
+  get_table = std::make_shared<opossum::GetTable>("int_int_float", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  const auto versioned_zone_maps = get_table->get_output()->get_chunk(ChunkID{0})->zone_maps();
+  ASSERT_TRUE(versioned_zone_maps);
+  EXPECT_FALSE((*versioned_zone_maps)[0]);
+  EXPECT_EQ((*versioned_zone_maps)[1], (*stored_zone_maps)[2]);
+  EXPECT_EQ(get_table->get_output()->get_value<int>(ColumnID{0}, 0u), 17);
+
+  column_versions.rollback(transaction_context->transaction_id());
+}
+
 TEST_F(OperatorsGetTableTest, PrunedColumnsAndChunks) {
   auto get_table = std::make_shared<opossum::GetTable>("int_int_float", std::vector{ChunkID{0}, ChunkID{2}},
                                                        std::vector{ColumnID{0}});
@@ -154,7 +188,7 @@ TEST_F(OperatorsGetTableTest, ExcludePhysicallyDeletedChunks) {
   vt->execute();
 
   // Delete all rows from table so calling original_table->remove_chunk() below is legal
-  auto delete_all = std::make_shared<opossum::Delete>(vt);
+  auto delete_all = std::make_shared<opossum::Delete>("int_int_float", vt);
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
@@ -196,7 +230,7 @@ TEST_F(OperatorsGetTableTest, PrunedChunksCombined) {
   vt->execute();
 
   // Delete all rows from table so calling original_table->remove_chunk() below is legal
-  auto delete_all = std::make_shared<opossum::Delete>(vt);
+  auto delete_all = std::make_shared<opossum::Delete>("int_int_float", vt);
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
@@ -234,6 +234,71 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnReferenceTable) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  // Rows with b >= 108 are removed by the TableScan, so that the IndexScan has to map the matches of the indexes of
+  // the referenced chunks to the positions of its input
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto table_scan = std::make_shared<TableScan>(this->_int_int, less_than_(b, 108));
+  table_scan->execute();
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 100, 102, 106};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 104, 106};
+  tests[PredicateCondition::BetweenInclusive] = {104, 106, 104, 106};
+  tests[PredicateCondition::BetweenExclusive] = {106, 106};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_scan, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+    scan->execute();
+
+    // The output references the data table, not the output of the TableScan
+    const auto& segment = static_cast<const ReferenceSegment&>(*scan->get_output()->get_chunk(ChunkID{0})->get_segment(
+        ColumnID{0}));
+    EXPECT_EQ(segment.referenced_table(), this->_int_int->get_output());
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, ScanOnReferenceTableWithoutIndexOnSomeChunks) {
+  // Only the second chunk of the table has an index. The first chunk is scanned without an index.
+  const auto get_table = std::make_shared<GetTable>("index_test_table");
+  get_table->execute();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, not_equals_(a, 2));
+  table_scan->execute();
+
+  const auto scan = std::make_shared<IndexScan>(table_scan, this->_index_type, this->_column_ids,
+                                                PredicateCondition::LessThanEquals, std::vector<AllTypeVariant>{4});
+  scan->execute();
+
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {100, 104, 100, 104});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, ScanOnDataTableWithoutIndexOnSomeChunks) {
+  // Chunks whose segments are not indexed (e.g., while the ChunkCompressionTask rebuilds the indexes of an encoded
+  // chunk) are scanned without an index
+  const auto table_wrapper =
+      std::make_shared<TableWrapper>(Hyrise::get().storage_manager.get_table("index_test_table"));
+  table_wrapper->execute();
+
+  const auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                PredicateCondition::LessThanEquals, std::vector<AllTypeVariant>{4});
+  scan->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, less_than_equals_(a, 4));
+  table_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), table_scan->get_output());
+}
+
 TYPED_TEST(OperatorsIndexScanTest, PosListGuarenteesSingleChunkReference) {
   const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
   const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
@@ -309,4 +374,63 @@ TYPED_TEST(OperatorsIndexScanTest, AddedChunk) {
                             load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
 }
 
+class OperatorsMultiColumnIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+    ChunkEncoder::encode_all_chunks(table);
+
+    // Only the first chunk has a multi-column index
+    table->get_chunk(ChunkID{0})->create_index<AdaptiveRadixTreeIndex>(_column_ids);
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  const std::vector<ColumnID> _column_ids{ColumnID{0}, ColumnID{1}};
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMultiColumnIndexScanTest, ScanOnDataTable) {
+  const auto scan = std::make_shared<IndexScan>(_table_wrapper, SegmentIndexType::AdaptiveRadixTree, _column_ids,
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{10, 110});
+  scan->included_chunk_ids = {ChunkID{0}};
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 2u);
+
+  const auto scan_no_match = std::make_shared<IndexScan>(_table_wrapper, SegmentIndexType::AdaptiveRadixTree,
+                                                         _column_ids, PredicateCondition::Equals,
+                                                         std::vector<AllTypeVariant>{10, 112});
+  scan_no_match->included_chunk_ids = {ChunkID{0}};
+  scan_no_match->execute();
+  EXPECT_EQ(scan_no_match->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsMultiColumnIndexScanTest, ScanOnReferenceTable) {
+  // The first chunk is scanned using the index, the second one falls back to a scan of both columns
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, not_equals_(a, 2));
+  table_scan->execute();
+
+  const auto scan = std::make_shared<IndexScan>(table_scan, SegmentIndexType::AdaptiveRadixTree, _column_ids,
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{4, 104});
+  scan->execute();
+
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 2u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{4});
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{104});
+    }
+  }
+
+  const auto scan_no_match = std::make_shared<IndexScan>(table_scan, SegmentIndexType::AdaptiveRadixTree, _column_ids,
+                                                         PredicateCondition::Equals,
+                                                         std::vector<AllTypeVariant>{4, 106});
+  scan_no_match->execute();
+  EXPECT_EQ(scan_no_match->get_output()->row_count(), 0u);
+}
+
 }  // namespace opossum
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -282,4 +284,57 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, ConcurrentSingleRowInserts) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+
+  const auto max_chunk_size = ChunkOffset{10};
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("target_table", target_table);
+
+  const auto thread_count = 8;
+  const auto inserts_per_thread = 50;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto insert_index = 0; insert_index < inserts_per_thread; ++insert_index) {
+        const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+        values->append({thread_index * inserts_per_thread + insert_index});
+        const auto table_wrapper = std::make_shared<TableWrapper>(values);
+        table_wrapper->execute();
+
+        const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+        const auto context = Hyrise::get().transaction_manager.new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+        context->commit();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // All rows are stored exactly once, and no chunk exceeds the maximum chunk size
+  const auto row_count = thread_count * inserts_per_thread;
+  EXPECT_EQ(target_table->row_count(), row_count);
+  EXPECT_EQ(target_table->chunk_count(), row_count / max_chunk_size);
+
+  auto values = std::vector<int32_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < target_table->chunk_count(); ++chunk_id) {
+    const auto chunk = target_table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), max_chunk_size);
+    EXPECT_EQ(chunk->get_scoped_mvcc_data_lock()->pending_insert_count(), 0u);
+
+    const auto& segment = static_cast<const ValueSegment<int32_t>&>(*chunk->get_segment(ColumnID{0}));
+    values.insert(values.end(), segment.values().begin(), segment.values().end());
+  }
+
+  std::sort(values.begin(), values.end());
+  for (auto value = 0; value < row_count; ++value) {
+    EXPECT_EQ(values[value], value);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,131 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/intersect.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+class OperatorsIntersectTest : public BaseTest {
+ protected:
+  virtual void SetUp() {
+    _table_wrapper_a = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+    _table_wrapper_b = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float3.tbl", 2));
+
+    _table_wrapper_a->execute();
+    _table_wrapper_b->execute();
+
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}};
+
+    const auto left_table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+    left_table->append({1, "x"});
+    left_table->append({1, "x"});
+    left_table->append({NullValue{}, "y"});
+    left_table->append({2, "z"});
+    left_table->append({NullValue{}, "y"});
+    left_table->append({3, NullValue{}});
+    _table_wrapper_left_with_null = std::make_shared<TableWrapper>(left_table);
+    _table_wrapper_left_with_null->execute();
+
+    const auto right_table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+    right_table->append({1, "x"});
+    right_table->append({NullValue{}, "y"});
+    right_table->append({3, NullValue{}});
+    right_table->append({3, NullValue{}});
+    _table_wrapper_right_with_null = std::make_shared<TableWrapper>(right_table);
+    _table_wrapper_right_with_null->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_a;
+  std::shared_ptr<TableWrapper> _table_wrapper_b;
+  std::shared_ptr<TableWrapper> _table_wrapper_left_with_null;
+  std::shared_ptr<TableWrapper> _table_wrapper_right_with_null;
+  TableColumnDefinitions _column_definitions;
+};
+
+TEST_F(OperatorsIntersectTest, IntersectOnValueTables) {
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false},
+                                                                        {"b", DataType::Float, false}},
+                                                 TableType::Data);
+  expected_result->append({123, 456.7f});
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_a, _table_wrapper_b);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, IntersectWithNullAndDuplicates) {
+  // NULL equals NULL, duplicates of the left input are kept
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({1, "x"});
+  expected_result->append({1, "x"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({3, NullValue{}});
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left_with_null, _table_wrapper_right_with_null);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, IntersectAll) {
+  // Every right row matches at most one equal left row
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({1, "x"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({3, NullValue{}});
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left_with_null, _table_wrapper_right_with_null,
+                                               SetOperationMode::All);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, IntersectAllOnReferenceTables) {
+  auto expected_result = std::make_shared<Table>(_column_definitions, TableType::Data);
+  expected_result->append({1, "x"});
+  expected_result->append({NullValue{}, "y"});
+  expected_result->append({3, NullValue{}});
+
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_left_with_null->get_output(), "a");
+  const auto b = PQPColumnExpression::from_table(*_table_wrapper_left_with_null->get_output(), "b");
+
+  auto projection1 = std::make_shared<Projection>(_table_wrapper_left_with_null, expression_vector(a, b));
+  projection1->execute();
+
+  auto projection2 = std::make_shared<Projection>(_table_wrapper_right_with_null, expression_vector(a, b));
+  projection2->execute();
+
+  auto intersect = std::make_shared<Intersect>(projection1, projection2, SetOperationMode::All);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(), expected_result);
+}
+
+TEST_F(OperatorsIntersectTest, ThrowWrongColumnOrderException) {
+  if (!HYRISE_DEBUG) GTEST_SKIP();
+
+  auto table_wrapper_d = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/float_int.tbl", 2));
+  table_wrapper_d->execute();
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_a, table_wrapper_d);
+
+  EXPECT_THROW(intersect->execute(), std::exception);
+}
+
+}  // namespace opossum
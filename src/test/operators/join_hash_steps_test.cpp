@@ -99,6 +99,36 @@ TEST_F(JoinHashStepsTest, LargeHashTableSinglePositions) {
   }
 }
 
+TEST_F(JoinHashStepsTest, HashTableFindBatch) {
+  // Large enough to use the probing layout. The values are multiples of 1'000, so that their (identity) hashes share
+  // their lowest bits.
+  auto table = PosHashTable<int>{JoinHashBuildMode::AllPositions, 1'000};
+  for (auto i = 0; i < 1'000; ++i) {
+    table.emplace(i * 1'000, RowID{ChunkID{1}, static_cast<ChunkOffset>(i)});
+  }
+  table.shrink_to_fit();
+
+  // Look up existing and missing values in alternating order, including a batch that is not completely filled
+  const auto probe_values = std::vector<int64_t>{0, 1, 2'000, 2'001, 999'000, 1'000'000, 500'000, 42};
+  const auto expected_offsets =
+      std::vector<std::optional<ChunkOffset>>{0, std::nullopt, 2, std::nullopt, 999, std::nullopt, 500, std::nullopt};
+  auto results = PosHashTable<int>::BatchResult{};
+  table.find_batch(
+      probe_values.size(), [&](const size_t index) -> const int64_t& { return probe_values[index]; }, results);
+
+  for (auto index = size_t{0}; index < probe_values.size(); ++index) {
+    EXPECT_EQ(results[index], table.find(probe_values[index]));
+    if (expected_offsets[index]) {
+      ASSERT_NE(results[index], table.end());
+      const auto expected_pos_list =
+          boost::container::small_vector<RowID, 1>{RowID{ChunkID{1}, *expected_offsets[index]}};
+      EXPECT_EQ(*results[index], expected_pos_list);
+    } else {
+      EXPECT_EQ(results[index], table.end());
+    }
+  }
+}
+
 TEST_F(JoinHashStepsTest, MaterializeInput) {
   std::vector<std::vector<size_t>> histograms;
   const auto chunk_offsets = determine_chunk_offsets(_table_with_nulls_and_zeros_scanned->get_output());
@@ -207,6 +237,53 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   EXPECT_EQ(empty_cluster_count, 2);
 }
 
+TEST_F(JoinHashStepsTest, BlockedBloomFilter) {
+  const std::hash<int> hash_function;
+  auto bloom_filter = BlockedBloomFilter{1'000};
+  for (auto value = 0; value < 1'000; ++value) {
+    bloom_filter.insert(hash_function(value * 2));
+  }
+
+  // No false negatives
+  for (auto value = 0; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(hash_function(value * 2)));
+  }
+
+  // Few false positives
+  auto false_positive_count = size_t{0};
+  for (auto value = 0; value < 1'000; ++value) {
+    if (bloom_filter.may_contain(hash_function(value * 2 + 1))) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 50);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputWithBloomFilter) {
+  const auto table = _table_with_nulls_and_zeros->get_output();
+  const auto chunk_offsets = determine_chunk_offsets(table);
+
+  // Materialize the build side into a Bloom filter. As the filter may be larger than required, only values that have
+  // been inserted are expected to be materialized on the probe side.
+  auto bloom_filter = BlockedBloomFilter{table->row_count()};
+  std::vector<std::vector<size_t>> build_histograms;
+  materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, determine_chunk_offsets(_table_zero_one),
+                                     build_histograms, 0, &bloom_filter);
+
+  std::vector<std::vector<size_t>> probe_histograms;
+  const auto radix_container = materialize_input<int, int, false>(table, ColumnID{0}, chunk_offsets, probe_histograms,
+                                                                  0, nullptr, &bloom_filter);
+
+  // The elements are pre-sized, rows that were dropped leave a NULL_ROW_ID behind
+  ASSERT_EQ(radix_container.elements->size(), table->row_count());
+  auto materialized_values = std::vector<int>{};
+  for (const auto& element : *radix_container.elements) {
+    if (element.row_id == NULL_ROW_ID) continue;
+    materialized_values.emplace_back(element.value);
+  }
+
+  // int_int4_with_null.tbl contains a single 0 and no 1 in its first column
+  EXPECT_EQ(materialized_values, std::vector<int>({0}));
+}
+
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   size_t radix_bit_count = 1;
   std::vector<std::vector<size_t>> histograms;
@@ -1,8 +1,12 @@
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace opossum {
 
@@ -54,4 +58,47 @@ TEST_F(OperatorsJoinSortMergeTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->input_right(), nullptr);
 }
 
+TEST_F(OperatorsJoinSortMergeTest, ParallelNonEquiOuterJoins) {
+  // The unmatched rows of non-equi outer joins are determined per cluster in parallel. Use enough chunks to get
+  // multiple clusters and compare the results to those of the nested loop join.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto value = 0; value < 100; ++value) {
+    left_table->append({(value * 7) % 100, value % 3});
+    right_table->append({(value * 13) % 100 + 20, value % 5});
+  }
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  left_input->execute();
+  right_input->execute();
+
+  const auto secondary_predicates = std::vector<std::vector<OperatorJoinPredicate>>{
+      {}, {OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}}};
+
+  for (const auto mode : {JoinMode::Left, JoinMode::Right, JoinMode::FullOuter}) {
+    for (const auto predicate_condition : {PredicateCondition::LessThan, PredicateCondition::GreaterThanEquals}) {
+      for (const auto& secondary_predicate : secondary_predicates) {
+        const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+
+        const auto join_sort_merge =
+            std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate, secondary_predicate);
+        join_sort_merge->execute();
+        const auto join_nested_loop =
+            std::make_shared<JoinNestedLoop>(left_input, right_input, mode, primary_predicate, secondary_predicate);
+        join_nested_loop->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(join_sort_merge->get_output(), join_nested_loop->get_output());
+      }
+    }
+  }
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
 }  // namespace opossum
@@ -62,6 +62,17 @@ class OperatorsLimitTest : public BaseTest {
     EXPECT_TABLE_EQ_ORDERED(limit->get_output(), expected_result);
   }
 
+  /**
+   * Limit with an offset that skips an entire chunk and the beginning of the next one.
+   */
+  void test_limit_3_offset_2() {
+    auto limit = std::make_shared<Limit>(_input_operator, to_expression(int64_t{3}), to_expression(int64_t{2}));
+    limit->execute();
+
+    auto expected_result = load_table("resources/test_data/tbl/int_int3_limit_3_offset_2.tbl", 3);
+    EXPECT_TABLE_EQ_ORDERED(limit->get_output(), expected_result);
+  }
+
   std::shared_ptr<TableWrapper> _table_wrapper;
   std::shared_ptr<AbstractOperator> _input_operator;
 };
@@ -118,4 +129,23 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceSegment) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, Limit3Offset2ValueSegment) {
+  _input_operator = _table_wrapper;
+  test_limit_3_offset_2();
+}
+
+TEST_F(OperatorsLimitTest, Limit3Offset2ReferenceSegment) {
+  // Filter accepts all rows in table.
+  auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, -1);
+  table_scan->execute();
+  _input_operator = table_scan;
+  test_limit_3_offset_2();
+}
+
+TEST_F(OperatorsLimitTest, OffsetLargerThanInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, to_expression(int64_t{3}), to_expression(int64_t{10}));
+  limit->execute();
+  EXPECT_EQ(limit->get_output()->row_count(), 0u);
+}
+
 }  // namespace opossum
@@ -5,6 +5,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
@@ -12,6 +13,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -148,6 +151,105 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultiColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2);
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultiColumnSortMixedOrder) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2);
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultiColumnSortWithLongStringsAndNulls) {
+  // The strings share a prefix that is longer than what is stored in the normalized keys
+  const auto column_definitions = TableColumnDefinitions{{"s", DataType::String, true}, {"i", DataType::Int, true}};
+
+  auto input_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  input_table->append({pmr_string{"prefix_shared_by_all_a"}, 2});
+  input_table->append({pmr_string{"prefix_shared_by_all_b"}, 1});
+  input_table->append({NULL_VALUE, 5});
+  input_table->append({pmr_string{"prefix_shared_by_all_a"}, 1});
+  input_table->append({pmr_string{"short"}, NULL_VALUE});
+  input_table->append({pmr_string{"prefix_shared_by_all_a"}, NULL_VALUE});
+  ChunkEncoder::encode_all_chunks(input_table, _encoding_type);
+
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  expected_result->append({pmr_string{"short"}, NULL_VALUE});
+  expected_result->append({pmr_string{"prefix_shared_by_all_b"}, 1});
+  expected_result->append({pmr_string{"prefix_shared_by_all_a"}, NULL_VALUE});
+  expected_result->append({pmr_string{"prefix_shared_by_all_a"}, 1});
+  expected_result->append({pmr_string{"prefix_shared_by_all_a"}, 2});
+  expected_result->append({NULL_VALUE, 5});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, ParallelSortIsStable) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Use enough rows and chunks so that the runs are merged in multiple partitions
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto row_count = 10'000;
+
+  auto input_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  auto expected_values = std::vector<std::pair<int32_t, int32_t>>{};
+  for (auto row_id = 0; row_id < row_count; ++row_id) {
+    const auto value = (row_id * 7919) % 97;
+    input_table->append({value, row_id});
+    expected_values.emplace_back(value, row_id);
+  }
+
+  std::stable_sort(expected_values.begin(), expected_values.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (const auto& [value, row_id] : expected_values) {
+    expected_result->append({value, row_id});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Descending, 1'000u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
@@ -310,4 +310,29 @@ TEST_P(OperatorsTableScanStringTest, ScanNotLikeUnderscoreWildcardOnDict) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanNotLikeStartingOnDict) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", 1);
+  auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_P(OperatorsTableScanStringTest, ScanLikeStartingBoundariesOnDict) {
+  // Prefixes that select the first, the last, or no values of the dictionary (for dictionary segments, prefix patterns
+  // are translated to a range of value IDs). The last one contains non-ASCII characters.
+  const auto expected_row_counts = std::vector<std::pair<pmr_string, size_t>>{
+      {"1%", 1}, {"S%", 1}, {"T%", 0}, {"0%", 0}, {"Dampfschifffahrtsgesellschaftskapitän%", 2}, {"Schiffe%", 0}};
+
+  for (const auto& [prefix, expected_row_count] : expected_row_counts) {
+    auto like_scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::Like, prefix);
+    like_scan->execute();
+    EXPECT_EQ(like_scan->get_output()->row_count(), expected_row_count) << prefix;
+
+    // NULL neither matches LIKE nor NOT LIKE
+    auto not_like_scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::NotLike, prefix);
+    not_like_scan->execute();
+    EXPECT_EQ(not_like_scan->get_output()->row_count(), 6u - expected_row_count) << prefix;
+  }
+}
+
 }  // namespace opossum
@@ -1,9 +1,11 @@
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -23,6 +25,7 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -1029,4 +1032,140 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanWithZoneMaps) {
+  // A single chunk spanning several zone map blocks. Every seventh row is NULL, the other values ascend with the row
+  // index so that most blocks can be skipped for selective predicates.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+
+  for (auto i = 0; i < 10'000; ++i) {
+    if (i % 7 == 0) {
+      table->append({NullValue{}});
+    } else {
+      table->append({i / 100});
+    }
+  }
+
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  const auto zone_maps = table->get_chunk(ChunkID{0})->zone_maps();
+  ASSERT_TRUE(zone_maps);
+  ASSERT_EQ(zone_maps->size(), 1u);
+  ASSERT_TRUE(zone_maps->at(0));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_row_count = [](const auto& predicate) {
+    auto row_count = size_t{0};
+    for (auto i = 0; i < 10'000; ++i) {
+      if (i % 7 != 0 && predicate(i / 100)) ++row_count;
+    }
+    return row_count;
+  };
+
+  const auto scan_row_count = [&](const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                  const std::optional<AllTypeVariant>& value2 = std::nullopt) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value, value2);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+
+  EXPECT_EQ(scan_row_count(PredicateCondition::Equals, 42), expected_row_count([](auto a) { return a == 42; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::Equals, 100), 0u);
+  EXPECT_EQ(scan_row_count(PredicateCondition::NotEquals, 42), expected_row_count([](auto a) { return a != 42; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::LessThan, 21), expected_row_count([](auto a) { return a < 21; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::GreaterThanEquals, 80),
+            expected_row_count([](auto a) { return a >= 80; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::BetweenInclusive, 19, 61),
+            expected_row_count([](auto a) { return a >= 19 && a <= 61; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::BetweenExclusive, 19, 61),
+            expected_row_count([](auto a) { return a > 19 && a < 61; }));
+}
+
+TEST_P(OperatorsTableScanTest, PruneChunksWithParameters) {
+  // Values of parameters are unknown to the ChunkPruningRule. Once they are set, the TableScan uses the pruning
+  // statistics to skip chunks. Chunk 0 holds the values 0..4, chunk 1 the values 5..9.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5);
+  for (auto i = 0; i < 10; ++i) {
+    table->append({i});
+  }
+
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{{ParameterID{0}, AllTypeVariant{7}}};
+
+  const auto scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_equals_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  scan->set_parameters(parameters);
+
+  const auto impl = scan->create_impl();
+  EXPECT_TRUE(impl->can_prune_chunk(ChunkID{0}));
+  EXPECT_FALSE(impl->can_prune_chunk(ChunkID{1}));
+
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 3u);
+
+  // Values of other data types are used if they can be converted losslessly
+  const auto long_scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_equals_(column_a, correlated_parameter_(ParameterID{0}, column_a)));
+  long_scan->set_parameters({{ParameterID{0}, AllTypeVariant{int64_t{7}}}});
+  EXPECT_TRUE(long_scan->create_impl()->can_prune_chunk(ChunkID{0}));
+
+  // The same works for between predicates and for inputs that reference a single chunk per chunk (e.g., the output of
+  // a Validate)
+  auto full_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_a, 0));
+  full_scan->execute();
+
+  const auto between_scan = std::make_shared<TableScan>(
+      full_scan, between_inclusive_(column_a, 1, correlated_parameter_(ParameterID{0}, column_a)));
+  between_scan->set_parameters({{ParameterID{0}, AllTypeVariant{3}}});
+
+  const auto between_impl = between_scan->create_impl();
+  EXPECT_FALSE(between_impl->can_prune_chunk(ChunkID{0}));
+  EXPECT_TRUE(between_impl->can_prune_chunk(ChunkID{1}));
+
+  between_scan->execute();
+  EXPECT_EQ(between_scan->get_output()->row_count(), 3u);
+}
+
+TEST_P(OperatorsTableScanTest, PruneChunksWhileStatisticsAreReplaced) {
+  // The pruning statistics and zone maps of a chunk might be replaced (e.g., by the ChunkCompressionTask) while it is
+  // scanned. Scans use a snapshot of them and return correct results either way.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5);
+  for (auto i = 0; i < 10; ++i) {
+    table->append({i});
+  }
+
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scans_done = std::atomic_bool{false};
+  auto statistics_thread = std::thread([&]() {
+    while (!scans_done) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        chunk->set_pruning_statistics(std::nullopt);
+        chunk->set_zone_maps(std::nullopt);
+        generate_chunk_pruning_statistics(chunk);
+      }
+    }
+  });
+
+  for (auto scan_index = 0; scan_index < 500; ++scan_index) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 7);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), 3u);
+  }
+  scans_done = true;
+  statistics_thread.join();
+}
+
 }  // namespace opossum
@@ -0,0 +1,109 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopNTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    _table_wrapper_null =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float_with_null.tbl", 2));
+    _table_wrapper_null->execute();
+  }
+
+  // TopN has to return the same rows in the same order as a Sort followed by a Limit
+  void test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                   const std::vector<SortColumnDefinition>& sort_definitions, const int64_t num_rows,
+                                   const int64_t offset = 0) {
+    auto top_n = std::make_shared<TopN>(input, sort_definitions, value_(num_rows), value_(offset));
+    top_n->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, value_(num_rows), value_(offset));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_n->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null;
+};
+
+TEST_F(OperatorsTopNTest, SingleColumn) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    for (auto num_rows = int64_t{0}; num_rows < 10; ++num_rows) {
+      test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, order_by_mode}}, num_rows);
+    }
+  }
+}
+
+TEST_F(OperatorsTopNTest, MultiColumn) {
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}};
+  for (auto num_rows = int64_t{0}; num_rows < 10; ++num_rows) {
+    test_against_sort_and_limit(_table_wrapper, sort_definitions, num_rows);
+  }
+}
+
+TEST_F(OperatorsTopNTest, Offset) {
+  for (auto offset = int64_t{0}; offset < 10; ++offset) {
+    test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}}}, 3, offset);
+  }
+}
+
+TEST_F(OperatorsTopNTest, NullValues) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::AscendingNullsLast, OrderByMode::Descending,
+                                   OrderByMode::DescendingNullsLast}) {
+    test_against_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{0}, order_by_mode}}, 3, 1);
+  }
+}
+
+TEST_F(OperatorsTopNTest, ReferenceSegments) {
+  auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 100);
+  table_scan->execute();
+
+  test_against_sort_and_limit(table_scan, {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}}, 2, 1);
+}
+
+TEST_F(OperatorsTopNTest, TiesKeepInputOrder) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  auto input_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto row_id = 0; row_id < 10'000; ++row_id) {
+    input_table->append({(row_id * 7919) % 97, row_id});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  test_against_sort_and_limit(table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 250, 50);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -8,12 +10,15 @@
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -52,11 +57,48 @@ class OperatorsUpdateTest : public BaseTest {
 
     // Get validated table which should have the same row twice.
     const auto post_update_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    EXPECT_TABLE_EQ_UNORDERED(visible_rows(post_update_transaction_context), load_table(expected_result_path));
+  }
+
+  // Returns the rows of the table to update that are visible to the transaction
+  std::shared_ptr<const Table> visible_rows(const std::shared_ptr<TransactionContext>& transaction_context) const {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
     const auto validate = std::make_shared<Validate>(get_table);
-    validate->set_transaction_context(post_update_transaction_context);
+    validate->set_transaction_context(transaction_context);
     validate->execute();
+    return validate->get_output();
+  }
+
+  // Sets b to the given value in all rows with the given value of a
+  std::shared_ptr<Update> update_b(const std::shared_ptr<TransactionContext>& transaction_context, const int32_t a,
+                                   const float b) const {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, a));
+    const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, b));
+    const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+
+    update->set_transaction_context_recursively(transaction_context);
+    get_table->execute();
+    validate->execute();
+    where_scan->execute();
+    updated_values_projection->execute();
+    update->execute();
+    return update;
+  }
 
-    EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), load_table(expected_result_path));
+  // int_float2.tbl with b = 1.5 where a = 123
+  std::shared_ptr<Table> updated_table() const {
+    const auto table = load_table("resources/test_data/tbl/int_float2.tbl");
+    auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+    expected_table->append({12345, 456.7f});
+    expected_table->append({12345, 457.7f});
+    expected_table->append({123, 1.5f});
+    expected_table->append({12, 350.7f});
+    return expected_table;
   }
 
   std::string table_to_update_name{"updateTestTable"};
@@ -81,4 +123,212 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateInPlace) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto update = update_b(transaction_context, 123, 1.5f);
+  EXPECT_FALSE(update->execute_failed());
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(transaction_context), updated_table());
+  transaction_context->commit();
+
+  // The row is neither deleted nor inserted again
+  EXPECT_EQ(table->row_count(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->invalid_row_count(), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->tids[0], TransactionID{0});
+
+  // Older snapshots still see the previous value, which remains in the segment for now
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(old_transaction_context),
+                            load_table("resources/test_data/tbl/int_float2.tbl"));
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(Hyrise::get().transaction_manager.new_transaction_context()),
+                            updated_table());
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 2u), 458.7f);
+
+  // Even if all transactions can see the new value, it is not installed while Inserts might write to the chunk
+  old_transaction_context.reset();
+  transaction_context.reset();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(Hyrise::get().transaction_manager.new_transaction_context()),
+                            updated_table());
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 2u), 458.7f);
+
+  // Once the chunk is immutable, GetTable installs the new value into a copy of the segment. Operators that still read
+  // the previous segment are not affected.
+  const auto chunk = table->get_chunk(ChunkID{1});
+  const auto previous_segment = chunk->get_segment(ColumnID{1});
+  chunk->mark_immutable();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(Hyrise::get().transaction_manager.new_transaction_context()),
+                            updated_table());
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 2u), 1.5f);
+  EXPECT_TRUE(chunk->get_scoped_mvcc_data_lock()->column_versions.empty());
+  EXPECT_NE(chunk->get_segment(ColumnID{1}), previous_segment);
+  EXPECT_EQ(boost::get<float>((*previous_segment)[0]), 458.7f);
+}
+
+TEST_F(OperatorsUpdateTest, RollbackInPlaceUpdate) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  update_b(transaction_context, 123, 1.5f);
+  transaction_context->rollback();
+
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(Hyrise::get().transaction_manager.new_transaction_context()),
+                            load_table("resources/test_data/tbl/int_float2.tbl"));
+  const auto mvcc_data = table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+  EXPECT_TRUE(mvcc_data->column_versions.empty());
+  EXPECT_EQ(mvcc_data->tids[0], TransactionID{0});
+}
+
+TEST_F(OperatorsUpdateTest, ConflictingInPlaceUpdates) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto first_context = transaction_manager.new_transaction_context();
+  const auto second_context = transaction_manager.new_transaction_context();
+  const auto third_context = transaction_manager.new_transaction_context();
+  const auto fourth_context = transaction_manager.new_transaction_context();
+
+  EXPECT_FALSE(update_b(first_context, 123, 1.5f)->execute_failed());
+
+  // The row is locked by the first transaction
+  EXPECT_TRUE(update_b(second_context, 123, 2.5f)->execute_failed());
+  second_context->rollback();
+
+  // The row is not locked anymore, but its new value is not visible to transactions that started earlier
+  first_context->commit();
+  EXPECT_TRUE(update_b(third_context, 123, 2.5f)->execute_failed());
+  third_context->rollback();
+
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto delete_op = std::make_shared<Delete>(table_to_update_name, validate);
+  delete_op->set_transaction_context_recursively(fourth_context);
+  get_table->execute();
+  validate->execute();
+  delete_op->execute();
+  EXPECT_TRUE(delete_op->execute_failed());
+  fourth_context->rollback();
+
+  // Transactions that see the new value can update the row
+  const auto fifth_context = transaction_manager.new_transaction_context();
+  EXPECT_FALSE(update_b(fifth_context, 123, 1.5f)->execute_failed());
+  fifth_context->commit();
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(transaction_manager.new_transaction_context()), updated_table());
+}
+
+TEST_F(OperatorsUpdateTest, ReadUpdateAndDeleteInSameTransaction) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->create_primary_key_index(ColumnID{0});
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_FALSE(update_b(transaction_context, 123, 2.5f)->execute_failed());
+
+  // The updated row remains visible to the updating transaction, also when it is looked up in the PrimaryKeyIndex
+  auto row_ids = PosList{};
+  table->primary_key_index()->lookup(*table, 123, transaction_context, row_ids);
+  EXPECT_EQ(row_ids, PosList({RowID{ChunkID{1}, ChunkOffset{0}}}));
+
+  EXPECT_FALSE(update_b(transaction_context, 123, 1.5f)->execute_failed());
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(transaction_context), updated_table());
+
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, 123));
+  const auto delete_op = std::make_shared<Delete>(table_to_update_name, where_scan);
+  delete_op->set_transaction_context_recursively(transaction_context);
+  get_table->execute();
+  validate->execute();
+  where_scan->execute();
+  EXPECT_EQ(where_scan->get_output()->row_count(), 1u);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+  EXPECT_EQ(visible_rows(transaction_context)->row_count(), 3u);
+  transaction_context->commit();
+
+  EXPECT_EQ(visible_rows(Hyrise::get().transaction_manager.new_transaction_context())->row_count(), 3u);
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateConflictsWithDelete) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto delete_rows = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto delete_op = std::make_shared<Delete>(table_to_update_name, validate);
+    delete_op->set_transaction_context_recursively(transaction_context);
+    get_table->execute();
+    validate->execute();
+    delete_op->execute();
+    return delete_op;
+  };
+
+  // Rows that are updated by another transaction cannot be deleted
+  const auto first_context = transaction_manager.new_transaction_context();
+  const auto second_context = transaction_manager.new_transaction_context();
+  EXPECT_FALSE(update_b(first_context, 123, 1.5f)->execute_failed());
+  EXPECT_TRUE(delete_rows(second_context)->execute_failed());
+  second_context->rollback();
+  first_context->rollback();
+
+  // Rows that are deleted by another transaction cannot be updated
+  const auto third_context = transaction_manager.new_transaction_context();
+  const auto fourth_context = transaction_manager.new_transaction_context();
+  EXPECT_FALSE(delete_rows(third_context)->execute_failed());
+  EXPECT_TRUE(update_b(fourth_context, 123, 1.5f)->execute_failed());
+  fourth_context->rollback();
+  third_context->rollback();
+
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows(transaction_manager.new_transaction_context()),
+                            load_table("resources/test_data/tbl/int_float2.tbl"));
+}
+
+TEST_F(OperatorsUpdateTest, InstallDoesNotOverwriteValuesOfStartingTransactions) {
+  // Installing committed versions into the segment must not race with transactions that are starting. Otherwise, a
+  // transaction could see a value that was committed after its snapshot, and two reads within it would differ.
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->get_chunk(ChunkID{1})->mark_immutable();
+
+  const auto value_of_b = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto rows = visible_rows(transaction_context);
+    for (auto row_id = size_t{0}; row_id < rows->row_count(); ++row_id) {
+      if (rows->get_value<int32_t>(ColumnID{0}, row_id) == 123) return rows->get_value<float>(ColumnID{1}, row_id);
+    }
+    Fail("Row not found");
+  };
+
+  const auto update_count = 300;
+  auto updates_done = std::atomic_bool{false};
+  auto readers = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    readers.emplace_back([&]() {
+      while (!updates_done) {
+        const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+        const auto first_value = value_of_b(transaction_context);
+        const auto second_value = value_of_b(transaction_context);
+        EXPECT_EQ(first_value, second_value);
+        transaction_context->commit();
+      }
+    });
+  }
+
+  for (auto update_index = 0; update_index < update_count; ++update_index) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    EXPECT_FALSE(update_b(transaction_context, 123, static_cast<float>(update_index))->execute_failed());
+    transaction_context->commit();
+  }
+  updates_done = true;
+
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(value_of_b(Hyrise::get().transaction_manager.new_transaction_context()),
+            static_cast<float>(update_count - 1));
+}
+
+TEST_F(OperatorsUpdateTest, UpdateEncodedChunk) {
+  // Values of immutable chunks are not updated in place, the rows are deleted and inserted again
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  helper(greater_than_(column_a, 1000), expression_vector(column_a, cast_(add_(column_a, 100), DataType::Float)),
+         "resources/test_data/tbl/int_float2_updated_1.tbl");
+  EXPECT_EQ(table->row_count(), 6u);
+}
+
 }  // namespace opossum
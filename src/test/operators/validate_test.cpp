@@ -8,11 +8,15 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -121,4 +125,52 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ChunkVisibilitySummaries) {
+  // Immutable chunks are accepted or discarded as a whole if the visibility summaries of their MVCC data allow it
+  auto table = load_table("resources/test_data/tbl/validate_input.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(table);
+  Hyrise::get().storage_manager.add_table("validate_table", table);
+
+  const auto validated_row_count = [](const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("validate_table");
+    get_table->set_transaction_context(context);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  const auto old_context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_EQ(validated_row_count(old_context), 4);
+
+  // Delete all rows of the first chunk
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("validate_table");
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+  auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::LessThan, 5);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("validate_table", table_scan);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+
+  const auto first_mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  const auto second_mvcc_data = table->get_chunk(ChunkID{1})->mvcc_data();
+  EXPECT_TRUE(first_mvcc_data->has_deletes());
+  EXPECT_EQ(first_mvcc_data->deleted_row_count(), 0);
+  EXPECT_FALSE(second_mvcc_data->has_deletes());
+
+  EXPECT_EQ(validated_row_count(delete_context), 2);
+  EXPECT_EQ(validated_row_count(old_context), 4);
+
+  delete_context->commit();
+  EXPECT_EQ(first_mvcc_data->deleted_row_count(), 2);
+  EXPECT_EQ(first_mvcc_data->max_end_cid(), delete_context->commit_id());
+
+  EXPECT_EQ(validated_row_count(old_context), 4);
+  EXPECT_EQ(validated_row_count(Hyrise::get().transaction_manager.new_transaction_context()), 2);
+}
+
 }  // namespace opossum
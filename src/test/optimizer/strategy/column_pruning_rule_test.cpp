@@ -180,7 +180,7 @@ TEST_F(ColumnPruningRuleTest, DoNotPruneDeleteInputs) {
 
   // clang-format off
   const auto lqp =
-  DeleteNode::make(
+  DeleteNode::make("node_a",
     PredicateNode::make(greater_than_(a, 5),
       node_a));
   // clang-format on
@@ -0,0 +1,139 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/index_join_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IndexJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // GroupKeyIndexes require dictionary segments
+    table = load_table("resources/test_data/tbl/int_int_int.tbl", 2);
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("a", table);
+
+    // The stored table is large according to its statistics
+    const auto table_statistics = table->table_statistics();
+    table_statistics->row_count = 1'000'000;
+    for (const auto& column_statistics : table_statistics->column_statistics) {
+      column_statistics->set_statistics_object(
+          GenericHistogram<int32_t>::with_single_bin(0, 1'000'000, 1'000'000, 1'000'000));
+    }
+
+    rule = std::make_shared<IndexJoinRule>();
+
+    stored_table_node = StoredTableNode::make("a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+  }
+
+  std::shared_ptr<MockNode> create_probe_node(const size_t row_count) {
+    const auto probe_node = create_mock_node_with_statistics(
+        MockNode::ColumnDefinitions{{DataType::Int, "x"}}, row_count,
+        {GenericHistogram<int32_t>::with_single_bin(0, 1'000'000, row_count, row_count)});
+    x = probe_node->get_column("x");
+    return probe_node;
+  }
+
+  std::shared_ptr<IndexJoinRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<Table> table;
+  LQPColumnReference a, b, x;
+};
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinWithoutIndex) {
+  const auto probe_node = create_probe_node(10);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinWithIndexOnOtherColumn) {
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+
+  const auto probe_node = create_probe_node(10);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(IndexJoinRuleTest, IndexJoinForSmallProbeSide) {
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto probe_node = create_probe_node(10);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Index);
+  EXPECT_EQ(join_node->index_side, IndexSide::Right);
+
+  const auto join_node_swapped = JoinNode::make(JoinMode::Inner, equals_(a, x), stored_table_node, probe_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node_swapped);
+  EXPECT_EQ(join_node_swapped->join_type, JoinType::Index);
+  EXPECT_EQ(join_node_swapped->index_side, IndexSide::Left);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinForLargeProbeSide) {
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  table->table_statistics()->row_count = 100;
+
+  const auto probe_node = create_probe_node(10'000);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinIfFewChunksAreIndexed) {
+  // The JoinIndex joins chunks without an index with a nested loop, here half of the large table
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  const auto chunk = table->get_chunk(ChunkID{1});
+  chunk->remove_index(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+
+  const auto probe_node = create_probe_node(10);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Default);
+}
+
+TEST_F(IndexJoinRuleTest, IndexJoinAboveValidate) {
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto probe_node = create_probe_node(10);
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, ValidateNode::make(stored_table_node));
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->join_type, JoinType::Index);
+  EXPECT_EQ(join_node->index_side, IndexSide::Right);
+
+  // The JoinIndex supports only inner joins if the index side is a reference table
+  const auto semi_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(x, a), probe_node, ValidateNode::make(stored_table_node));
+
+  StrategyBaseTest::apply_rule(rule, semi_join_node);
+  EXPECT_EQ(semi_join_node->join_type, JoinType::Default);
+}
+
+}  // namespace opossum
@@ -13,6 +13,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/attribute_statistics.hpp"
@@ -178,4 +179,92 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanAboveValidate) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  generate_mock_statistics(1'000'000);
+
+  auto validate_node = ValidateNode::make(stored_table_node);
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_0->set_left_input(validate_node);
+
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyIndexScanBelowValidate) {
+  table->create_primary_key_index(ColumnID{1});
+
+  // The PredicateNode is moved below the ValidateNode, so that the IndexScan can use the PrimaryKeyIndex of the output
+  // of the GetTable. The selectivity is not relevant for the PrimaryKeyIndex.
+  auto validate_node = ValidateNode::make(stored_table_node);
+  auto predicate_node = PredicateNode::make(equals_(b, 5), validate_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node);
+  EXPECT_EQ(reordered, validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node);
+  EXPECT_EQ(predicate_node->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyIndexScanPrunedColumn) {
+  table->create_primary_key_index(ColumnID{1});
+  stored_table_node->set_pruned_column_ids({ColumnID{0}});
+
+  auto predicate_node = PredicateNode::make(equals_(b, 5), stored_table_node);
+
+  StrategyBaseTest::apply_rule(rule, predicate_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoPrimaryKeyIndexScanWithoutEquality) {
+  table->create_primary_key_index(ColumnID{1});
+
+  generate_mock_statistics();
+
+  auto predicate_node_0 = PredicateNode::make(greater_than_(b, 5), stored_table_node);
+  auto predicate_node_1 = PredicateNode::make(equals_(c, 5), predicate_node_0);
+
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, MultiColumnIndexScan) {
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}});
+
+  generate_mock_statistics(1'000'000);
+  table->table_statistics()->column_statistics.at(1)->set_statistics_object(
+      GenericHistogram<int32_t>::with_single_bin(0, 20'000, 1'000'000, 1'000));
+
+  // The predicates on the indexed columns are moved below the predicate on c
+  auto predicate_node_a = PredicateNode::make(equals_(a, 5), stored_table_node);
+  auto predicate_node_c = PredicateNode::make(greater_than_(c, 10), predicate_node_a);
+  auto predicate_node_b = PredicateNode::make(equals_(b, 5), predicate_node_c);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_b);
+  EXPECT_EQ(reordered, predicate_node_c);
+  EXPECT_EQ(predicate_node_c->left_input(), predicate_node_b);
+  EXPECT_EQ(predicate_node_b->left_input(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->left_input(), stored_table_node);
+
+  EXPECT_EQ(predicate_node_a->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(predicate_node_b->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(predicate_node_c->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, NoMultiColumnIndexScanWithoutPredicateOnEachColumn) {
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}});
+
+  generate_mock_statistics(1'000'000);
+
+  auto predicate_node_a = PredicateNode::make(equals_(a, 5), stored_table_node);
+  auto predicate_node_b = PredicateNode::make(greater_than_(b, 5), predicate_node_a);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_b);
+  EXPECT_EQ(predicate_node_a->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_b->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,105 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/top_n_rule.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopNRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+
+    rule = std::make_shared<TopNRule>();
+  }
+
+  std::shared_ptr<MockNode> node_a;
+  LQPColumnReference a, b;
+  std::shared_ptr<TopNRule> rule;
+};
+
+TEST_F(TopNRuleTest, FuseSortAndLimit) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    SortNode::make(expression_vector(a, b), std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::Ascending},
+      node_a));
+
+  const auto expected_lqp =
+  TopNNode::make(expression_vector(a, b), std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::Ascending}, value_(10),  // NOLINT
+    node_a);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(TopNRuleTest, FuseSortAndLimitWithOffsetAcrossProjection) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(greater_than_(a, 5),
+    LimitNode::make(value_(10), value_(3),
+      ProjectionNode::make(expression_vector(a),
+        SortNode::make(expression_vector(b), std::vector<OrderByMode>{OrderByMode::Ascending},
+          node_a))));
+
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(a, 5),
+    ProjectionNode::make(expression_vector(a),
+      TopNNode::make(expression_vector(b), std::vector<OrderByMode>{OrderByMode::Ascending}, value_(10), value_(3),
+        node_a)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(TopNRuleTest, DoNotFuseAcrossFilteringNodes) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    PredicateNode::make(greater_than_(a, 5),
+      SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+        node_a)));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(TopNRuleTest, DoNotFuseSortWithMultipleOutputs) {
+  // clang-format off
+  const auto sort_node =
+  SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+    node_a);
+
+  const auto input_lqp =
+  UnionNode::make(UnionMode::Positions,
+    LimitNode::make(value_(10),
+      sort_node),
+    sort_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
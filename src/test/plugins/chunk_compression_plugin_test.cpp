@@ -0,0 +1,132 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "../../plugins/chunk_compression_plugin.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class ChunkCompressionPluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, CHUNK_SIZE, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(TABLE_NAME, _table);
+  }
+
+  // Inserts the given number of rows within a new transaction, which is returned without being committed
+  std::shared_ptr<TransactionContext> insert_rows(const int32_t row_count) {
+    const auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      values->append({value, value / 2});
+    }
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(TABLE_NAME, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  void compression_loop() { _plugin._compression_loop(); }
+
+  bool is_encoded(const ChunkID chunk_id, const ColumnID column_id) const {
+    return !std::dynamic_pointer_cast<ValueSegment<int32_t>>(_table->get_chunk(chunk_id)->get_segment(column_id));
+  }
+
+  static constexpr auto CHUNK_SIZE = ChunkOffset{3};
+  inline static const auto TABLE_NAME = std::string{"chunk_compression_table"};
+
+  ChunkCompressionPlugin _plugin;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompressionPluginTest, EncodeFilledChunks) {
+  const auto transaction_context = insert_rows(5);
+
+  // Insert marks the filled chunk immutable
+  ASSERT_EQ(_table->chunk_count(), 2);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  // The insert is still pending
+  compression_loop();
+  EXPECT_FALSE(is_encoded(ChunkID{0}, ColumnID{0}));
+
+  transaction_context->commit();
+  compression_loop();
+
+  // Without an encoding set for the table, the encodings are chosen by the EncodingAdvisor
+  EXPECT_TRUE(is_encoded(ChunkID{0}, ColumnID{0}));
+  EXPECT_TRUE(is_encoded(ChunkID{0}, ColumnID{1}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->pruning_statistics());
+  EXPECT_FALSE(is_encoded(ChunkID{1}, ColumnID{0}));
+
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 2), 2);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{1}, 2), 1);
+}
+
+TEST_F(ChunkCompressionPluginTest, EncodingSpecAndIndexes) {
+  _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  _plugin.set_chunk_encoding_spec(TABLE_NAME, {SegmentEncodingSpec{EncodingType::Dictionary},
+                                               SegmentEncodingSpec{EncodingType::RunLength}});
+
+  insert_rows(6)->commit();
+  compression_loop();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{2}; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+  }
+}
+
+TEST_F(ChunkCompressionPluginTest, DictionaryEncodingForIndexedColumns) {
+  // Without an encoding set for the table, the EncodingAdvisor must not choose an encoding the index cannot be built on
+  _table->create_index<GroupKeyIndex>({ColumnID{1}});
+
+  insert_rows(6)->commit();
+  compression_loop();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{2}; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_TRUE(is_encoded(chunk_id, ColumnID{0}));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{1}}));
+  }
+}
+
+TEST_F(ChunkCompressionPluginTest, UncommittedUpdatesPreventEncoding) {
+  insert_rows(3)->commit();
+
+  // An uncommitted Update cannot be installed into encoded segments
+  const auto mvcc_data = _table->get_chunk(ChunkID{0})->mvcc_data();
+  const auto transaction_id = TransactionID{42};
+  EXPECT_TRUE(mvcc_data->column_versions.add(ColumnID{0}, ChunkOffset{1}, int32_t{17}, transaction_id));
+
+  compression_loop();
+  EXPECT_FALSE(is_encoded(ChunkID{0}, ColumnID{0}));
+
+  mvcc_data->column_versions.rollback(transaction_id);
+  compression_loop();
+  EXPECT_TRUE(is_encoded(ChunkID{0}, ColumnID{0}));
+
+  // Updates of encoded chunks are refused
+  EXPECT_FALSE(mvcc_data->column_versions.add(ColumnID{0}, ChunkOffset{1}, int32_t{17}, transaction_id));
+}
+
+}  // namespace opossum
@@ -0,0 +1,159 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+
+#include "../../plugins/mvcc_delete_plugin.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MvccDeletePluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, CHUNK_SIZE, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 3 * static_cast<int32_t>(CHUNK_SIZE); ++value) {
+      _table->append({value});
+    }
+    Hyrise::get().storage_manager.add_table(TABLE_NAME, _table);
+  }
+
+  // Deletes all rows with a value less than the given one
+  void delete_rows_less_than(const int32_t value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>(TABLE_NAME);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::LessThan, value);
+    table_scan->execute();
+
+    auto validate = std::make_shared<Validate>(table_scan);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    auto delete_op = std::make_shared<Delete>(TABLE_NAME, validate);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+    transaction_context->commit();
+  }
+
+  size_t validated_row_count() {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>(TABLE_NAME);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  bool try_logical_delete(const ChunkID chunk_id) {
+    return MvccDeletePlugin::_try_logical_delete(TABLE_NAME, _table, chunk_id);
+  }
+
+  bool try_physical_delete(const ChunkID chunk_id) { return MvccDeletePlugin::_try_physical_delete(*_table, chunk_id); }
+
+  static constexpr auto CHUNK_SIZE = ChunkOffset{10};
+  inline static const auto TABLE_NAME = std::string{"mvcc_delete_table"};
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MvccDeletePluginTest, LogicalAndPhysicalDelete) {
+  // Invalidate all rows of the first chunk but one
+  delete_rows_less_than(9);
+  EXPECT_EQ(validated_row_count(), 21);
+
+  EXPECT_TRUE(try_logical_delete(ChunkID{0}));
+  const auto cleanup_commit_id = _table->get_chunk(ChunkID{0})->get_cleanup_commit_id();
+  ASSERT_TRUE(cleanup_commit_id);
+  EXPECT_EQ(*cleanup_commit_id, Hyrise::get().transaction_manager.last_commit_id());
+
+  // The remaining row was moved to a new chunk
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->invalid_row_count(), CHUNK_SIZE);
+  EXPECT_EQ(_table->chunk_count(), 4);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 1);
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 3 * CHUNK_SIZE), 9);
+  EXPECT_EQ(validated_row_count(), 21);
+
+  EXPECT_TRUE(try_physical_delete(ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(validated_row_count(), 21);
+}
+
+TEST_F(MvccDeletePluginTest, PhysicalDeleteWaitsForActiveTransactions) {
+  delete_rows_less_than(10);
+
+  // This transaction might still see the rows of the chunk
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+  EXPECT_TRUE(try_logical_delete(ChunkID{0}));
+  EXPECT_FALSE(try_physical_delete(ChunkID{0}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+
+  transaction_context = nullptr;
+  EXPECT_TRUE(try_physical_delete(ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+}
+
+TEST_F(MvccDeletePluginTest, PhysicalDeleteWaitsForTransactionAtCleanupCommitId) {
+  delete_rows_less_than(10);
+  EXPECT_TRUE(try_logical_delete(ChunkID{0}));
+
+  // The snapshot of this transaction equals the cleanup commit id
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_EQ(transaction_context->snapshot_commit_id(), *_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  EXPECT_FALSE(try_physical_delete(ChunkID{0}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+
+  transaction_context = nullptr;
+  EXPECT_TRUE(try_physical_delete(ChunkID{0}));
+}
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteConflict) {
+  delete_rows_less_than(9);
+
+  // A pending transaction locks the remaining row of the chunk, so that it cannot be moved
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  auto get_table = std::make_shared<GetTable>(TABLE_NAME);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, 9);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>(TABLE_NAME, table_scan);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+
+  EXPECT_FALSE(try_logical_delete(ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  transaction_context->rollback();
+  EXPECT_TRUE(try_logical_delete(ChunkID{0}));
+}
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteSkipsDroppedTable) {
+  delete_rows_less_than(9);
+
+  // The loop works on a copy of the tables, which might have been dropped or replaced in the meantime
+  Hyrise::get().storage_manager.drop_table(TABLE_NAME);
+  EXPECT_FALSE(try_logical_delete(ChunkID{0}));
+
+  Hyrise::get().storage_manager.add_table(TABLE_NAME, load_table("resources/test_data/tbl/int.tbl", CHUNK_SIZE));
+  EXPECT_FALSE(try_logical_delete(ChunkID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+}
+
+}  // namespace opossum
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -257,4 +260,33 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, WaitingWorkerDoesNotSleepUntilTimeout) {
+  // A Worker that waits for a job executed by another Worker is not notified when the job is done. It must not sleep
+  // on its queue until the Worker sleep time (300us) expires, but back off in shorter steps. The job is scheduled to
+  // the other node and cannot be stolen, so that the waiting Worker finds nothing to do.
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto ITERATIONS = size_t{51};
+  auto wait_durations = std::vector<std::chrono::nanoseconds>{};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    for (auto iteration = size_t{0}; iteration < ITERATIONS; ++iteration) {
+      const auto begin = std::chrono::steady_clock::now();
+      const auto job = std::make_shared<JobTask>([]() {}, SchedulePriority::Default, false);
+      job->schedule(NodeID{1});
+      Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{job});
+      wait_durations.emplace_back(std::chrono::steady_clock::now() - begin);
+    }
+  });
+  task->schedule(NodeID{0});
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  // The median is used, as single waits can take longer if the machine is busy
+  std::sort(wait_durations.begin(), wait_durations.end());
+  EXPECT_LT(wait_durations[ITERATIONS / 2], std::chrono::microseconds{300});
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
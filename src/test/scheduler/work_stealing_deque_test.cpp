@@ -0,0 +1,101 @@
+#include <atomic>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  const auto tasks = create_tasks(4);
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  const auto tasks = create_tasks(100);
+  auto deque = WorkStealingDeque{4};
+
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+
+  for (auto task_id = size_t{0}; task_id < tasks.size(); ++task_id) {
+    EXPECT_EQ(deque.pop(), tasks[tasks.size() - 1 - task_id]);
+  }
+  EXPECT_EQ(deque.pop(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentSteal) {
+  // The owner pushes and pops tasks while other threads steal. Every task must be taken exactly once.
+  const auto tasks = create_tasks(10'000);
+  auto deque = WorkStealingDeque{16};
+
+  constexpr auto THIEF_COUNT = size_t{4};
+  auto stolen_tasks = std::vector<std::vector<std::shared_ptr<AbstractTask>>>(THIEF_COUNT);
+  auto owner_done = std::atomic_bool{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&, thief_id]() {
+      while (!owner_done || !deque.empty()) {
+        if (auto task = deque.steal()) stolen_tasks[thief_id].emplace_back(std::move(task));
+      }
+    });
+  }
+
+  auto popped_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = size_t{0}; task_id < tasks.size(); ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) {
+      if (auto task = deque.pop()) popped_tasks.emplace_back(std::move(task));
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  auto taken_tasks = std::multiset<std::shared_ptr<AbstractTask>>{popped_tasks.begin(), popped_tasks.end()};
+  for (const auto& thief_tasks : stolen_tasks) {
+    taken_tasks.insert(thief_tasks.begin(), thief_tasks.end());
+  }
+
+  EXPECT_EQ(taken_tasks.size(), tasks.size());
+  for (const auto& task : tasks) {
+    EXPECT_EQ(taken_tasks.count(task), 1);
+  }
+}
+
+}  // namespace opossum
@@ -11,12 +11,16 @@
 #include "hyrise.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/validate.hpp"
+#include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/column_pruning_rule.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinOrderingRule and
@@ -504,9 +508,10 @@ TEST_F(SQLPipelineTest, UpdateWithTransactionFailureAutoCommit) {
   EXPECT_EQ(tables.size(), 1);
   EXPECT_EQ(sql_pipeline.failed_pipeline_statement()->get_sql_string(), "UPDATE table_a SET a = 1 WHERE a = 123;");
 
-  // This time, the first row should have been updated before the second statement failed
-  EXPECT_EQ(first_chunk_tids[0], TransactionID{1});
-  EXPECT_EQ(first_chunk_end_cids[0], CommitID{2});  // initial commit ID + 1
+  // This time, the first row should have been updated (in place) before the second statement failed
+  EXPECT_EQ(first_chunk_tids[0], TransactionID{0});
+  EXPECT_EQ(first_chunk_end_cids[0], MvccData::MAX_COMMIT_ID);
+  EXPECT_TRUE(first_chunk_mvcc_data_lock->column_versions.committed_after(ChunkOffset{0}, CommitID{1}));
 
   // This row was being modified by a different transaction, so it should not have been touched
   EXPECT_EQ(first_chunk_tids[1], TransactionID{17});
@@ -686,4 +691,33 @@ TEST_F(SQLPipelineTest, DefaultPlanCaches) {
   EXPECT_FALSE(sql_pipeline_statement_3.lqp_cache);
 }
 
+TEST_F(SQLPipelineTest, PreparedStatementSkipsChunksInTableScan) {
+  // Chunk 0 of table_a holds the values 12345 and 123 in column a, chunk 1 holds the value 1234
+  ChunkEncoder::encode_all_chunks(_table_a);
+
+  // Without the ChunkPruningRule, which would already exclude the chunk in GetTable, the TableScan skips it using the
+  // pruning statistics. As column b is pruned, GetTable rebuilds the chunks, which must keep their statistics.
+  const auto optimizer = std::make_shared<Optimizer>();
+  optimizer->add_rule(std::make_unique<ColumnPruningRule>());
+
+  auto prepare_pipeline = SQLPipelineBuilder{"PREPARE prepared_scan FROM 'SELECT a FROM table_a WHERE a < ?'"}
+                              .with_optimizer(optimizer)
+                              .create_pipeline();
+  ASSERT_EQ(prepare_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  auto execute_pipeline = SQLPipelineBuilder{"EXECUTE prepared_scan (200)"}.with_optimizer(optimizer).create_pipeline();
+  const auto [pipeline_status, table] = execute_pipeline.get_result_table();
+  ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(table->row_count(), 1u);
+
+  auto table_scan = std::shared_ptr<const AbstractOperator>{execute_pipeline.get_physical_plans().at(0)};
+  while (table_scan && table_scan->type() != OperatorType::TableScan) {
+    table_scan = table_scan->input_left();
+  }
+  ASSERT_TRUE(table_scan);
+
+  const auto& performance_data = static_cast<const TableScan::PerformanceData&>(table_scan->performance_data());
+  EXPECT_EQ(performance_data.chunk_scans_skipped, 1u);
+}
+
 }  // namespace opossum
@@ -1537,6 +1537,12 @@ TEST_F(SQLTranslatorTest, LimitExpression) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, LimitOffset) {
+  const auto actual_lqp = compile_query("SELECT * FROM int_float LIMIT 2 OFFSET 1;");
+  const auto expected_lqp = LimitNode::make(value_(2), value_(1), stored_table_node_int_float);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, Extract) {
   std::vector<DatetimeComponent> components{DatetimeComponent::Year,   DatetimeComponent::Month,
                                             DatetimeComponent::Day,    DatetimeComponent::Hour,
@@ -1910,7 +1916,7 @@ TEST_F(SQLTranslatorTest, DeleteSimple) {
 
   // clang-format off
   const auto expected_lqp =
-  DeleteNode::make(
+  DeleteNode::make("int_float",
     ValidateNode::make(
       StoredTableNode::make("int_float")));
   // clang-format on
@@ -1923,7 +1929,7 @@ TEST_F(SQLTranslatorTest, DeleteConditional) {
 
   // clang-format off
   const auto expected_lqp =
-  DeleteNode::make(
+  DeleteNode::make("int_float",
     PredicateNode::make(greater_than_(int_float_a, 5),
       ValidateNode::make(
         stored_table_node_int_float)));
@@ -2295,7 +2301,6 @@ TEST_F(SQLTranslatorTest, CatchInputErrors) {
   EXPECT_THROW(compile_query("SELECT a AS b, b AS a FROM int_float WHERE a > 5"), InvalidInputException);
   EXPECT_THROW(compile_query("INSERT INTO int_float VALUES (1, 2, 3, 4)"), InvalidInputException);
   EXPECT_THROW(compile_query("SELECT a, SUM(b) FROM int_float GROUP BY a HAVING b > 10;"), InvalidInputException);
-  EXPECT_THROW(compile_query("SELECT * FROM int_float LIMIT 1 OFFSET 1;"), InvalidInputException);
   EXPECT_THROW(compile_query("INSERT INTO no_such_table (a) VALUES (1);"), InvalidInputException);
   EXPECT_THROW(compile_query("DELETE FROM no_such_table"), InvalidInputException);
   EXPECT_THROW(compile_query("DELETE FROM no_such_table WHERE a = 1"), InvalidInputException);
@@ -867,7 +867,7 @@ TEST_F(CardinalityEstimatorTest, NonQueryNodes) {
   const auto insert_lqp = InsertNode::make("t", node_a);
   EXPECT_EQ(estimator.estimate_cardinality(insert_lqp), 0.0f);
 
-  EXPECT_EQ(estimator.estimate_cardinality(DeleteNode::make(node_a)), 0.0f);
+  EXPECT_EQ(estimator.estimate_cardinality(DeleteNode::make("node_a", node_a)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DropViewNode::make("v", false)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DropTableNode::make("t", false)), 0.0f);
   EXPECT_EQ(estimator.estimate_cardinality(DummyTableNode::make()), 0.0f);
@@ -240,4 +240,65 @@ TEST_F(AdaptiveRadixTreeIndexTest, DenseVectorOfRandomInts) {
   _search_elements(values);
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, MultiColumnLookup) {
+  // Rows sorted by (first, second): 3 (1, "a"), 0 (1, "b"), 5 (1, "b"), 1 (2, "a"), 6 (4, "c"), 2 (NULL, "a"),
+  // 4 (2, NULL)
+  const auto first = create_dict_segment_by_type<int32_t>(DataType::Int, {1, 2, std::nullopt, 1, 2, 1, 4});
+  const auto second = create_dict_segment_by_type<pmr_string>(DataType::String, {"b", "a", "a", "a", std::nullopt,
+                                                                                 "b", "c"});
+  const auto index =
+      std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({first, second}));
+
+  const auto offsets = [](const auto begin, const auto end) { return std::vector<ChunkOffset>(begin, end); };
+
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), std::vector<ChunkOffset>({3, 0, 5, 1, 6}));
+  EXPECT_EQ(offsets(index->null_cbegin(), index->null_cend()), std::vector<ChunkOffset>({2, 4}));
+
+  // Full keys
+  EXPECT_EQ(offsets(index->lower_bound({1, "b"}), index->upper_bound({1, "b"})), std::vector<ChunkOffset>({0, 5}));
+  EXPECT_EQ(offsets(index->lower_bound({2, "a"}), index->upper_bound({2, "a"})), std::vector<ChunkOffset>({1}));
+  EXPECT_EQ(index->lower_bound({2, "b"}), index->upper_bound({2, "b"}));
+  EXPECT_EQ(index->lower_bound({4, "c"}), index->cbegin() + 4);
+  EXPECT_EQ(index->upper_bound({4, "c"}), index->cend());
+
+  // Values that do not exist in one of the segments
+  EXPECT_EQ(index->lower_bound({3, "a"}), index->cbegin() + 4);
+  EXPECT_EQ(index->upper_bound({3, "a"}), index->cbegin() + 4);
+  EXPECT_EQ(index->lower_bound({0, "z"}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({5, "a"}), index->cend());
+  EXPECT_EQ(index->lower_bound({1, "aa"}), index->cbegin() + 1);
+  EXPECT_EQ(index->upper_bound({2, "z"}), index->cbegin() + 4);
+
+  // Prefixes
+  EXPECT_EQ(offsets(index->lower_bound({1}), index->upper_bound({1})), std::vector<ChunkOffset>({3, 0, 5}));
+  EXPECT_EQ(offsets(index->lower_bound({2}), index->upper_bound({2})), std::vector<ChunkOffset>({1}));
+  EXPECT_EQ(index->lower_bound({3}), index->upper_bound({3}));
+
+  // Range on the first column
+  EXPECT_EQ(offsets(index->lower_bound({2}), index->upper_bound({4})), std::vector<ChunkOffset>({1, 6}));
+  EXPECT_EQ(offsets(index->lower_bound({0}), index->upper_bound({1})), std::vector<ChunkOffset>({3, 0, 5}));
+
+  EXPECT_THROW(index->lower_bound({1, "a", 3}), std::logic_error);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, RangeOnManyValues) {
+  // Builds a tree with large inner nodes and checks lookups of existing and missing values against the sorted values
+  auto values = std::vector<std::optional<int32_t>>{};
+  for (auto value = int32_t{0}; value < 2'000; ++value) {
+    values.emplace_back(value * 2);
+  }
+  std::shuffle(values.begin(), values.end(), _rng);
+
+  const auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  const auto index =
+      std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  for (const auto search_value : {-1, 0, 1, 255, 256, 511, 512, 1'001, 2'222, 3'998, 3'999, 4'000}) {
+    const auto expected_lower = std::min((search_value + 1) / 2, 2'000);
+    const auto expected_upper = search_value < 0 ? 0 : std::min(search_value / 2 + 1, 2'000);
+    EXPECT_EQ(std::distance(index->cbegin(), index->lower_bound({search_value})), expected_lower);
+    EXPECT_EQ(std::distance(index->cbegin(), index->upper_bound({search_value})), expected_upper);
+  }
+}
+
 }  // namespace opossum
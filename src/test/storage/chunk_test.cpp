@@ -1,4 +1,7 @@
+#include <chrono>
 #include <memory>
+#include <thread>
+#include <utility>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -49,6 +52,41 @@ TEST_F(StorageChunkTest, AddSegmentToChunk) {
   EXPECT_EQ(chunk->size(), 3u);
 }
 
+TEST_F(StorageChunkTest, ReserveAndGrowRows) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}), std::make_shared<MvccData>(3, CommitID{0}));
+  chunk->append({2, "two"});
+
+  // Rows are reserved after the existing ones, but at most up to the maximum chunk size
+  EXPECT_EQ(chunk->reserve_rows(2, 7), (std::pair<ChunkOffset, ChunkOffset>{4, 6}));
+  EXPECT_EQ(chunk->reserve_rows(2, 7), (std::pair<ChunkOffset, ChunkOffset>{6, 7}));
+  EXPECT_EQ(chunk->reserve_rows(2, 7), (std::pair<ChunkOffset, ChunkOffset>{7, 7}));
+  EXPECT_EQ(chunk->size(), 4u);
+
+  chunk->grow_reserved_rows(4, 6, TransactionID{17});
+  EXPECT_EQ(chunk->size(), 6u);
+
+  // The new rows are locked by the inserting transaction and not yet visible
+  const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  EXPECT_EQ(mvcc_data->size(), 6u);
+  EXPECT_EQ(mvcc_data->tids[5], TransactionID{17});
+  EXPECT_EQ(mvcc_data->begin_cids[5], MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->pending_insert_count(), 2u);
+}
+
+TEST_F(StorageChunkTest, GrowReservedRowsInOrder) {
+  // Rows reserved later are grown after the rows reserved before, even if their thread is faster
+  const auto first_rows = chunk->reserve_rows(2, 10);
+  const auto second_rows = chunk->reserve_rows(3, 10);
+
+  auto second_thread = std::thread{[&]() { chunk->grow_reserved_rows(second_rows.first, second_rows.second, 0); }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(chunk->size(), 0u);
+
+  chunk->grow_reserved_rows(first_rows.first, first_rows.second, 0);
+  second_thread.join();
+  EXPECT_EQ(chunk->size(), 5u);
+}
+
 TEST_F(StorageChunkTest, AddValuesToChunk) {
   chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
   chunk->append({2, "two"});
@@ -203,6 +241,34 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indexes_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, ReplaceIndexes) {
+  chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+  const auto index_int = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  const auto index_str = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+
+  const auto new_index_int = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseSegment>>{ds_int});
+  chunk->replace_indexes({index_int}, {new_index_int});
+
+  EXPECT_EQ(chunk->get_indexes(std::vector<ColumnID>{ColumnID{0}}),
+            std::vector<std::shared_ptr<AbstractIndex>>{new_index_int});
+  EXPECT_EQ(chunk->get_indexes(std::vector<ColumnID>{ColumnID{1}}),
+            std::vector<std::shared_ptr<AbstractIndex>>{index_str});
+}
+
+TEST_F(StorageChunkTest, ZoneMapsAreSnapshots) {
+  chunk->mark_immutable();
+  EXPECT_FALSE(chunk->zone_maps());
+
+  chunk->set_zone_maps(ChunkZoneMaps{chunk->column_count()});
+  const auto zone_maps = chunk->zone_maps();
+  ASSERT_TRUE(zone_maps);
+
+  // Readers keep the zone maps they loaded when new ones are set
+  chunk->set_zone_maps(std::nullopt);
+  EXPECT_FALSE(chunk->zone_maps());
+  EXPECT_EQ(zone_maps->size(), chunk->column_count());
+}
+
 TEST_F(StorageChunkTest, OrderedBy) {
   EXPECT_EQ(chunk->ordered_by(), std::nullopt);
   const auto ordered_by = std::make_pair(ColumnID(0), OrderByMode::Ascending);
@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  template <typename T, typename ValueGenerator>
+  static std::shared_ptr<ValueSegment<T>> create_segment(const size_t row_count, const ValueGenerator& generator) {
+    auto values = pmr_concurrent_vector<T>(row_count);
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      values[row_index] = generator(row_index);
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+  static void expect_encoding(const SegmentEncodingSpec& actual, const SegmentEncodingSpec& expected) {
+    EXPECT_EQ(actual.encoding_type, expected.encoding_type);
+    EXPECT_EQ(actual.vector_compression_type, expected.vector_compression_type);
+  }
+};
+
+TEST_F(EncodingAdvisorTest, AnalyzeSmallSegment) {
+  // Small segments are analyzed entirely
+  auto values = pmr_concurrent_vector<int32_t>{3, 3, 1, 0, 1};
+  auto null_values = pmr_concurrent_vector<bool>{false, false, false, true, false};
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+  const auto characteristics = EncodingAdvisor::analyze_segment(segment, DataType::Int);
+
+  EXPECT_EQ(characteristics.row_count, 5);
+  EXPECT_EQ(characteristics.null_count, 1);
+  EXPECT_EQ(characteristics.distinct_count, 2);
+  EXPECT_EQ(characteristics.run_count, 4);
+  EXPECT_FALSE(characteristics.is_sorted);
+  EXPECT_EQ(characteristics.block_value_range_bits, 2);
+}
+
+TEST_F(EncodingAdvisorTest, AnalyzeSampledSegment) {
+  const auto row_count = size_t{100'000};
+  const auto segment = create_segment<int32_t>(row_count, [](const auto row_index) { return row_index; });
+  const auto characteristics = EncodingAdvisor::analyze_segment(segment, DataType::Int);
+
+  EXPECT_EQ(characteristics.row_count, row_count);
+  EXPECT_EQ(characteristics.null_count, 0);
+  EXPECT_TRUE(characteristics.is_sorted);
+
+  // The sample only contains unique values, so most values of the segment are estimated to be unique as well
+  EXPECT_GT(characteristics.distinct_count, EncodingAdvisor::SAMPLE_BLOCK_COUNT * EncodingAdvisor::SAMPLE_BLOCK_SIZE);
+  EXPECT_LE(characteristics.distinct_count, row_count);
+  EXPECT_EQ(characteristics.run_count, characteristics.distinct_count);
+
+  // Each sample block covers a range of 2047 values
+  EXPECT_EQ(characteristics.block_value_range_bits, 11);
+}
+
+TEST_F(EncodingAdvisorTest, AnalyzeStrings) {
+  const auto segment = create_segment<pmr_string>(
+      1'000, [](const auto row_index) { return pmr_string(row_index % 2 == 0 ? "a" : "abc"); });
+  const auto characteristics = EncodingAdvisor::analyze_segment(segment, DataType::String);
+
+  EXPECT_EQ(characteristics.distinct_count, 2);
+  EXPECT_EQ(characteristics.run_count, 1'000);
+  EXPECT_DOUBLE_EQ(characteristics.average_string_length, 2.0);
+  EXPECT_EQ(characteristics.max_string_length, 3);
+  EXPECT_GT(characteristics.lz4_compression_ratio, 1.0);
+}
+
+TEST_F(EncodingAdvisorTest, AdviseRunLengthForSortedLowCardinality) {
+  const auto segment = create_segment<int32_t>(10'000, [](const auto row_index) { return row_index / 1'000; });
+  expect_encoding(EncodingAdvisor::advise_segment_encoding(segment, DataType::Int),
+                  SegmentEncodingSpec{EncodingType::RunLength});
+}
+
+TEST_F(EncodingAdvisorTest, AdviseFrameOfReferenceForUniqueIntegers) {
+  // A permutation of the values 0 to 19,999
+  const auto segment =
+      create_segment<int32_t>(20'000, [](const auto row_index) { return (row_index * 7'919) % 20'000; });
+  expect_encoding(EncodingAdvisor::advise_segment_encoding(segment, DataType::Int),
+                  SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned});
+}
+
+TEST_F(EncodingAdvisorTest, AdviseFixedStringDictionaryForFewStrings) {
+  const auto segment = create_segment<pmr_string>(
+      10'000, [](const auto row_index) { return pmr_string{"value_" + std::to_string(row_index % 5)}; });
+  expect_encoding(EncodingAdvisor::advise_segment_encoding(segment, DataType::String),
+                  SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128});
+}
+
+TEST_F(EncodingAdvisorTest, EncodeChunkAutomatically) {
+  const auto table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 4);
+  const auto expected_table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 4);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    ChunkEncoder::encode_chunk_automatically(chunk, table->column_data_types());
+
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      EXPECT_FALSE(std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id)));
+    }
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,256 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"id", DataType::Int, false}, {"value", DataType::Float, false}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    _table->append({1, 1.5f});
+    _table->append({2, 2.5f});
+    _table->append({3, 3.5f});
+    _table->create_primary_key_index(ColumnID{0});
+    Hyrise::get().storage_manager.add_table("table", _table);
+  }
+
+  PosList lookup(const AllTypeVariant& key, const std::shared_ptr<TransactionContext>& transaction_context) const {
+    auto row_ids = PosList{};
+    _table->primary_key_index()->lookup(*_table, key, transaction_context, row_ids);
+    return row_ids;
+  }
+
+  void insert(const std::vector<AllTypeVariant>& values,
+              const std::shared_ptr<TransactionContext>& transaction_context) const {
+    const auto values_to_insert = std::make_shared<Table>(_column_definitions, TableType::Data);
+    values_to_insert->append(values);
+    const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("table", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(PrimaryKeyIndexTest, CreateOnExistingRows) {
+  EXPECT_EQ(_table->primary_key_index()->size(), 3u);
+  EXPECT_EQ(lookup(1, nullptr), PosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_EQ(lookup(3, nullptr), PosList({RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_TRUE(lookup(4, nullptr).empty());
+
+  // Keys are cast to the data type of the column
+  EXPECT_EQ(lookup(int64_t{2}, nullptr), PosList({RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_TRUE(lookup(2.5f, nullptr).empty());
+  EXPECT_TRUE(lookup(NullValue{}, nullptr).empty());
+
+  _table->append({4, 4.5f});
+  EXPECT_EQ(lookup(4, nullptr), PosList({RowID{ChunkID{1}, ChunkOffset{1}}}));
+}
+
+TEST_F(PrimaryKeyIndexTest, InvalidColumns) {
+  const auto nullable_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"id", DataType::Int, true}}, TableType::Data);
+  EXPECT_THROW(nullable_table->create_primary_key_index(ColumnID{0}), std::logic_error);
+  EXPECT_THROW(_table->create_primary_key_index(ColumnID{1}), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, InsertedRowsVisibleAfterCommit) {
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context();
+  insert({4, 4.5f}, insert_context);
+
+  const auto other_context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_EQ(lookup(4, insert_context).size(), 1u);
+  EXPECT_TRUE(lookup(4, other_context).empty());
+
+  insert_context->commit();
+  EXPECT_TRUE(lookup(4, other_context).empty());
+  EXPECT_EQ(lookup(4, Hyrise::get().transaction_manager.new_transaction_context()).size(), 1u);
+}
+
+TEST_F(PrimaryKeyIndexTest, RolledBackInsertNotVisible) {
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context();
+  insert({4, 4.5f}, insert_context);
+  insert_context->rollback();
+
+  EXPECT_TRUE(lookup(4, Hyrise::get().transaction_manager.new_transaction_context()).empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, UpdateOfKeyColumn) {
+  const auto update_context = Hyrise::get().transaction_manager.new_transaction_context();
+
+  const auto id = pqp_column_(ColumnID{0}, DataType::Int, false, "id");
+  const auto value = pqp_column_(ColumnID{1}, DataType::Float, false, "value");
+  const auto get_table = std::make_shared<GetTable>("table");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto where_scan = std::make_shared<TableScan>(validate, equals_(id, 1));
+  const auto updated_values = std::make_shared<Projection>(where_scan, expression_vector(5, value));
+  const auto update = std::make_shared<Update>("table", where_scan, updated_values);
+  update->set_transaction_context_recursively(update_context);
+  get_table->execute();
+  validate->execute();
+  where_scan->execute();
+  updated_values->execute();
+  update->execute();
+  ASSERT_FALSE(update->execute_failed());
+  update_context->commit();
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context();
+  EXPECT_TRUE(lookup(1, context).empty());
+  const auto row_ids = lookup(5, context);
+  ASSERT_EQ(row_ids.size(), 1u);
+  EXPECT_EQ(_table->get_chunk(row_ids[0].chunk_id)->get_segment(ColumnID{1})->operator[](row_ids[0].chunk_offset),
+            AllTypeVariant{1.5f});
+}
+
+TEST_F(PrimaryKeyIndexTest, IndexScan) {
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+
+  const auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey,
+                                                      std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                      std::vector<AllTypeVariant>{2});
+  index_scan->set_transaction_context(delete_context);
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 1u);
+  EXPECT_EQ(index_scan->get_output()->get_value<float>(ColumnID{1}, 0u), 2.5f);
+
+  const auto delete_operator = std::make_shared<Delete>("table", index_scan);
+  delete_operator->set_transaction_context(delete_context);
+  delete_operator->execute();
+  delete_context->commit();
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto index_scan_after_delete = std::make_shared<IndexScan>(
+      get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+      std::vector<AllTypeVariant>{2});
+  index_scan_after_delete->set_transaction_context(context);
+  index_scan_after_delete->execute();
+  EXPECT_EQ(index_scan_after_delete->get_output()->row_count(), 0u);
+}
+
+TEST_F(PrimaryKeyIndexTest, GetTableSharesIndex) {
+  // Without pruning, the stored table itself is the output
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->primary_key_index(), _table->primary_key_index());
+
+  // The output of a GetTable with pruned chunks gets an index that shares the entries and maps the ChunkIDs
+  const auto get_table_pruned_chunk =
+      std::make_shared<GetTable>("table", std::vector{ChunkID{0}}, std::vector<ColumnID>{});
+  get_table_pruned_chunk->execute();
+  const auto output = get_table_pruned_chunk->get_output();
+  const auto derived_index = output->primary_key_index();
+  ASSERT_TRUE(derived_index);
+  EXPECT_EQ(derived_index->column_id(), ColumnID{0});
+  EXPECT_EQ(derived_index->size(), 3u);
+
+  auto row_ids = PosList{};
+  derived_index->lookup(*output, 3, nullptr, row_ids);
+  EXPECT_EQ(row_ids, PosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  row_ids.clear();
+  derived_index->lookup(*output, 1, nullptr, row_ids);
+  EXPECT_TRUE(row_ids.empty());
+
+  EXPECT_THROW(derived_index->derive(ColumnID{0}, {}), std::logic_error);
+
+  // The ColumnID is adapted to pruned columns. The index is dropped if its column is pruned.
+  const auto get_table_pruned_column =
+      std::make_shared<GetTable>("table", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table_pruned_column->execute();
+  EXPECT_EQ(get_table_pruned_column->get_output()->primary_key_index()->column_id(), ColumnID{0});
+
+  const auto get_table_pruned_key =
+      std::make_shared<GetTable>("table", std::vector<ChunkID>{}, std::vector{ColumnID{0}});
+  get_table_pruned_key->execute();
+  EXPECT_FALSE(get_table_pruned_key->get_output()->primary_key_index());
+}
+
+TEST_F(PrimaryKeyIndexTest, SQLPipelineUsesIndexScan) {
+  Hyrise::get().storage_manager.add_table("table_with_key", _table);
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT value FROM table_with_key WHERE id = 2"}.create_pipeline();
+  const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  ASSERT_EQ(result_table->row_count(), 1u);
+  EXPECT_EQ(result_table->get_value<float>(ColumnID{0}, 0u), 2.5f);
+
+  auto index_scan_count = size_t{0};
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{sql_pipeline.get_physical_plans().at(0)};
+  while (!operators.empty()) {
+    const auto op = operators.back();
+    operators.pop_back();
+    if (std::dynamic_pointer_cast<const IndexScan>(op)) ++index_scan_count;
+    if (op->input_left()) operators.emplace_back(op->input_left());
+    if (op->input_right()) operators.emplace_back(op->input_right());
+  }
+  EXPECT_EQ(index_scan_count, 1u);
+}
+
+TEST_F(PrimaryKeyIndexTest, JoinIndex) {
+  const auto probe_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  probe_table->append({3});
+  probe_table->append({NullValue{}});
+  probe_table->append({1});
+  probe_table->append({7});
+  probe_table->append({3});
+  const auto probe = std::make_shared<TableWrapper>(probe_table);
+  probe->execute();
+
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  const auto inner_join = std::make_shared<JoinIndex>(probe, get_table, JoinMode::Inner, primary_predicate);
+  inner_join->execute();
+
+  const auto expected_column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"id", DataType::Int, false}, {"value", DataType::Float, false}};
+  auto expected_inner = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  expected_inner->append({3, 3, 3.5f});
+  expected_inner->append({1, 1, 1.5f});
+  expected_inner->append({3, 3, 3.5f});
+  EXPECT_TABLE_EQ_UNORDERED(inner_join->get_output(), expected_inner);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(inner_join->performance_data());
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 2u);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+
+  const auto semi_join = std::make_shared<JoinIndex>(probe, get_table, JoinMode::Semi, primary_predicate);
+  semi_join->execute();
+  EXPECT_EQ(semi_join->get_output()->row_count(), 3u);
+
+  const auto anti_join = std::make_shared<JoinIndex>(probe, get_table, JoinMode::AntiNullAsFalse, primary_predicate);
+  anti_join->execute();
+  EXPECT_EQ(anti_join->get_output()->row_count(), 2u);
+}
+
+}  // namespace opossum
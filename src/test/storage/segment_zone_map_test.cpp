@@ -0,0 +1,89 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/reference_segment.hpp"
+#include "storage/segment_zone_map.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three blocks: [0, 2048) holds the values 0..2047, [2048, 4096) is NULL, [4096, 5000) holds the values 4096..4999
+    _int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (auto row = int32_t{0}; row < 5000; ++row) {
+      if (row >= 2048 && row < 4096) {
+        _int_segment->append(NULL_VALUE);
+      } else {
+        _int_segment->append(row);
+      }
+    }
+
+    _zone_map = create_segment_zone_map(*_int_segment);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _int_segment;
+  std::shared_ptr<BaseSegmentZoneMap> _zone_map;
+};
+
+TEST_F(SegmentZoneMapTest, BlockMinMax) {
+  ASSERT_TRUE(_zone_map);
+  EXPECT_EQ(_zone_map->block_count(), 3u);
+
+  const auto& block_min_max = std::dynamic_pointer_cast<SegmentZoneMap<int32_t>>(_zone_map)->block_min_max();
+  ASSERT_EQ(block_min_max.size(), 3u);
+  EXPECT_EQ(block_min_max[0], std::make_pair(0, 2047));
+  EXPECT_FALSE(block_min_max[1]);
+  EXPECT_EQ(block_min_max[2], std::make_pair(4096, 4999));
+}
+
+TEST_F(SegmentZoneMapTest, CandidateRanges) {
+  const auto first_block = ChunkOffsetRanges{{ChunkOffset{0}, ChunkOffset{2048}}};
+  const auto last_block = ChunkOffsetRanges{{ChunkOffset{4096}, ChunkOffset{5000}}};
+  const auto both_blocks =
+      ChunkOffsetRanges{{ChunkOffset{0}, ChunkOffset{2048}}, {ChunkOffset{4096}, ChunkOffset{5000}}};
+  const auto no_blocks = ChunkOffsetRanges{};
+
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::Equals, 17), first_block);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::Equals, 3000), no_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::NotEquals, 17), both_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::LessThan, 0), no_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::LessThanEquals, 0), first_block);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::GreaterThan, 4999), no_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::GreaterThanEquals, 2047), both_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::GreaterThan, 2047), last_block);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::BetweenInclusive, 2100, 4000), no_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::BetweenInclusive, 2047, 4096), both_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::BetweenExclusive, 2047, 4096), no_blocks);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::BetweenUpperExclusive, 2047, 4096), first_block);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::BetweenLowerExclusive, 2047, 4096), last_block);
+}
+
+TEST_F(SegmentZoneMapTest, UnsupportedPredicatesReturnEntireSegment) {
+  const auto entire_segment = ChunkOffsetRanges{{ChunkOffset{0}, ChunkOffset{5000}}};
+
+  // Values of another data type and NULL cannot be evaluated using the zone map
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::Equals, int64_t{3000}), entire_segment);
+  EXPECT_EQ(_zone_map->candidate_ranges(PredicateCondition::Equals, NULL_VALUE), entire_segment);
+
+  const auto string_segment = std::make_shared<ValueSegment<pmr_string>>(std::vector<pmr_string>{"b", "c", "d"});
+  const auto string_zone_map = create_segment_zone_map(*string_segment);
+  EXPECT_EQ(string_zone_map->candidate_ranges(PredicateCondition::Like, pmr_string{"a%"}),
+            (ChunkOffsetRanges{{ChunkOffset{0}, ChunkOffset{3}}}));
+  EXPECT_EQ(string_zone_map->candidate_ranges(PredicateCondition::LessThan, pmr_string{"b"}), ChunkOffsetRanges{});
+}
+
+TEST_F(SegmentZoneMapTest, NoZoneMapForReferenceSegments) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl");
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, ChunkOffset{0}}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  EXPECT_FALSE(create_segment_zone_map(reference_segment));
+}
+
+}  // namespace opossum
@@ -113,4 +113,19 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, CompressionOfDroppedTable) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  Hyrise::get().storage_manager.add_table("table_dict", table);
+
+  // The task holds the table, so that it can still be executed after the table was dropped
+  auto compression = std::make_shared<ChunkCompressionTask>(table, std::vector<ChunkID>{ChunkID{0}}, std::nullopt);
+  Hyrise::get().storage_manager.drop_table("table_dict");
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(
+      std::vector<std::shared_ptr<ChunkCompressionTask>>{compression});
+
+  const auto dict_segment =
+      std::dynamic_pointer_cast<const BaseDictionarySegment>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_NE(dict_segment, nullptr);
+}
+
 }  // namespace opossum